@@ -15,6 +15,14 @@
 #include "ccntr_man_list.h"
 #include "ccntr_list_template.h"
 
+#include "ccntr_man_ulist.h"
+#include "ccntr_ulist_template.h"
+
+#include "ccntr_epoch.h"
+#include "ccntr_rculist.h"
+#include "ccntr_man_rculist.h"
+#include "ccntr_rculist_template.h"
+
 #include "ccntr_queue.h"
 #include "ccntr_man_queue.h"
 #include "ccntr_queue_template.h"
@@ -26,5 +34,33 @@
 #include "ccntr_map.h"
 #include "ccntr_man_map.h"
 #include "ccntr_map_template.h"
+#include "ccntr_map_inline_template.h"
+#include "ccntr_man_smap.h"
+#include "ccntr_frozen_map.h"
+#include "ccntr_frozen_image.h"
+
+#include "ccntr_itree.h"
+
+#include "ccntr_man_btree.h"
+#include "ccntr_btree_template.h"
+
+#include "ccntr_lru.h"
+#include "ccntr_man_lru.h"
+#include "ccntr_lru_template.h"
+
+#include "ccntr_skipmap.h"
+#include "ccntr_man_skipmap.h"
+#include "ccntr_skipmap_template.h"
+
+#include "ccntr_hash.h"
+#include "ccntr_man_hash.h"
+#include "ccntr_hash_template.h"
+
+#include "ccntr_man_flathash.h"
+#include "ccntr_flathash_template.h"
+
+#include "ccntr_sharded_map.h"
+#include "ccntr_man_pmap.h"
+#include "ccntr_man_art.h"
 
 #endif
@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @brief     Epoch based memory reclamation.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_EPOCH_H_
+#define _CCNTR_EPOCH_H_
+
+#include "ccntr_spinlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @class ccntr_epoch_node_t
+ * @brief Node of retired object.
+ */
+typedef struct ccntr_epoch_node_t
+{
+    struct ccntr_epoch_node_t *next;  ///< READ ONLY for user!
+
+    /// Callback to release the retired object. READ ONLY for user!
+    void(*release)(struct ccntr_epoch_node_t *node);
+
+} ccntr_epoch_node_t;
+
+/**
+ * @brief Release retired object.
+ * @details Callback that will be called when there have no readers
+ *          can access the retired object any more.
+ *
+ * @param node The node of retired object.
+ */
+typedef void(*ccntr_epoch_release_t)(ccntr_epoch_node_t *node);
+
+/**
+ * @class ccntr_epoch_t
+ * @brief Epoch based memory reclamation.
+ * @details This object helps lock-free readers and writers
+ *          to share objects without use-after-free:
+ *          Readers mark their access sections by
+ *          ccntr_epoch_t::ccntr_epoch_read_lock and ccntr_epoch_t::ccntr_epoch_read_unlock,
+ *          and writers retire objects which are not reachable any more by
+ *          ccntr_epoch_t::ccntr_epoch_retire.
+ *          The retired objects will be released after all readers which
+ *          may still access them (the grace period) have left.
+ */
+typedef struct ccntr_epoch_t
+{
+    unsigned current;
+    unsigned readers[2];
+
+    ccntr_epoch_node_t *retired;  // Retired in the current epoch.
+    ccntr_epoch_node_t *waiting;  // Retired in the previous epoch.
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_epoch_t;
+
+void ccntr_epoch_init(ccntr_epoch_t *self);
+void ccntr_epoch_destroy(ccntr_epoch_t *self);
+
+unsigned ccntr_epoch_read_lock(ccntr_epoch_t *self);
+void ccntr_epoch_read_unlock(ccntr_epoch_t *self, unsigned ticket);
+
+void ccntr_epoch_retire(ccntr_epoch_t *self, ccntr_epoch_node_t *node, ccntr_epoch_release_t release);
+void ccntr_epoch_reclaim(ccntr_epoch_t *self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
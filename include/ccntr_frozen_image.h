@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @brief     Container: frozen key map image (position independent, read only).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_FROZEN_IMAGE_H_
+#define _CCNTR_FROZEN_IMAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_frozen_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_FROZEN_IMAGE_ENABLED
+
+/**
+ * @class ccntr_frozen_image_iter_t
+ * @brief Iterator of frozen key map image.
+ */
+typedef struct ccntr_frozen_image_iter_t
+{
+    const struct ccntr_frozen_image_t *container;
+    unsigned                           index;       // Index in the layout, and zero for no value.
+} ccntr_frozen_image_iter_t;
+
+static inline
+void ccntr_frozen_image_iter_init(ccntr_frozen_image_iter_t         *self,
+                                  const struct ccntr_frozen_image_t *container,
+                                  unsigned                           index)
+{
+    self->container = container;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_frozen_image_iter_have_value(const ccntr_frozen_image_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->index;
+}
+
+void ccntr_frozen_image_iter_move_prev(ccntr_frozen_image_iter_t *self);
+void ccntr_frozen_image_iter_move_next(ccntr_frozen_image_iter_t *self);
+
+int64_t     ccntr_frozen_image_iter_get_key(const ccntr_frozen_image_iter_t *self);
+const void* ccntr_frozen_image_iter_get_value(const ccntr_frozen_image_iter_t *self, size_t *size);
+
+/**
+ * @brief Location of a value in the image.
+ */
+typedef struct ccntr_frozen_image_entry_t
+{
+    uint64_t offset;    // Offset from the beginning of the value heap.
+    uint64_t size;      // Size of the value in bytes.
+} ccntr_frozen_image_entry_t;
+
+/**
+ * @class ccntr_frozen_image_t
+ * @brief Frozen key map image.
+ * @details An image is a block of bytes that holds a sorted key/value index
+ *          and refers to its parts by offsets instead of pointers,
+ *          so that it can be saved to a file, and be mapped to any address to use it directly.
+ *          The image consists of:
+ *          @li A header with the magic number, version, byte order mark, count, and offsets of the other parts.
+ *          @li Keys as 64 bits signed integers in the Eytzinger layout of the frozen key map.
+ *          @li Value entries (ccntr_frozen_image_entry_t) in the same order of keys.
+ *          @li The value heap, where each value is aligned to 8 bytes.
+ *
+ *          The image is written from a frozen key map (ccntr_frozen_map_t::ccntr_frozen_map_write_image),
+ *          and the image object is only a view of the image which does not copy or own it.
+ *          So the startup of a program can be only an open and a memory mapping of the file,
+ *          and pages of the image are loaded by the system when they be touched by searches.
+ *
+ * @code
+ * int   fd   = open(path, O_RDONLY);
+ * void *data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+ *
+ * ccntr_frozen_image_t image;
+ * if( !ccntr_frozen_image_open(&image, data, size) ) ... // Not a valid image.
+ * @endcode
+ *
+ * @remarks There are no locks in this container,
+ *          and it can be read by multiple threads concurrently.
+ */
+typedef struct ccntr_frozen_image_t
+{
+    const int64_t                    *keys;         // Keys in the layout order, and the first one is not used.
+    const ccntr_frozen_image_entry_t *entries;      // Value entries in the same order of keys.
+    const unsigned char              *heap;
+    uint64_t                          heap_size;
+    unsigned                          count;
+} ccntr_frozen_image_t;
+
+#ifdef CCNTR_FROZEN_MAP_ENABLED
+/**
+ * @brief Serialise value.
+ * @details Callback that will be called when a value be written to an image.
+ *
+ * @param value  The value to be written.
+ * @param buffer The buffer to receive the serialised value,
+ *               and it can be NULL to calculate the size only.
+ * @return Size of the serialised value in bytes.
+ */
+typedef size_t(*ccntr_frozen_image_serialise_t)(const void *value, void *buffer);
+
+size_t ccntr_frozen_map_write_image(const ccntr_frozen_map_t      *self,
+                                    ccntr_frozen_image_serialise_t serialise,
+                                    void                          *buffer,
+                                    size_t                         size);
+#endif
+
+bool ccntr_frozen_image_open(ccntr_frozen_image_t *self, const void *data, size_t size);
+
+static inline
+unsigned ccntr_frozen_image_get_count(const ccntr_frozen_image_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return self->count;
+}
+
+ccntr_frozen_image_iter_t ccntr_frozen_image_get_first(const ccntr_frozen_image_t *self);
+ccntr_frozen_image_iter_t ccntr_frozen_image_get_last(const ccntr_frozen_image_t *self);
+
+ccntr_frozen_image_iter_t ccntr_frozen_image_find(const ccntr_frozen_image_t *self, int64_t key);
+ccntr_frozen_image_iter_t ccntr_frozen_image_find_nearest_less(const ccntr_frozen_image_t *self, int64_t key);
+ccntr_frozen_image_iter_t ccntr_frozen_image_find_nearest_great(const ccntr_frozen_image_t *self, int64_t key);
+
+const void* ccntr_frozen_image_find_value(const ccntr_frozen_image_t *self, int64_t key, size_t *size);
+
+#endif  // CCNTR_FROZEN_IMAGE_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief     Container: frozen key map (read only).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_FROZEN_MAP_H_
+#define _CCNTR_FROZEN_MAP_H_
+
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_map.h"
+#include "ccntr_man_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_FROZEN_MAP_ENABLED
+
+/**
+ * @class ccntr_frozen_map_iter_t
+ * @brief Iterator of frozen key map.
+ */
+typedef struct ccntr_frozen_map_iter_t
+{
+    const struct ccntr_frozen_map_t *container;
+    unsigned                         index;     // Index in the layout, and zero for no value.
+} ccntr_frozen_map_iter_t;
+
+static inline
+void ccntr_frozen_map_iter_init(ccntr_frozen_map_iter_t         *self,
+                                const struct ccntr_frozen_map_t *container,
+                                unsigned                         index)
+{
+    self->container = container;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_frozen_map_iter_have_value(const ccntr_frozen_map_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->index;
+}
+
+void ccntr_frozen_map_iter_move_prev(ccntr_frozen_map_iter_t *self);
+void ccntr_frozen_map_iter_move_next(ccntr_frozen_map_iter_t *self);
+
+void* ccntr_frozen_map_iter_get_key(const ccntr_frozen_map_iter_t *self);
+void* ccntr_frozen_map_iter_get_value(const ccntr_frozen_map_iter_t *self);
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_frozen_map_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_frozen_map_release_value_t)(void *value);
+
+/**
+ * @class ccntr_frozen_map_t
+ * @brief Frozen key map container.
+ * @details A frozen map is built from a key map
+ *          (ccntr_map_t::ccntr_map_freeze or ccntr_man_map_t::ccntr_man_map_freeze),
+ *          and cannot be modified after that.
+ *          Keys are stored in a contiguous array with the Eytzinger (breadth first) layout,
+ *          so that a search walks down an implicit tree without pointers and branches,
+ *          and nodes of the next levels are prefetched.
+ *
+ * @remarks There are no locks in this container,
+ *          and it can be read by multiple threads concurrently.
+ */
+typedef struct ccntr_frozen_map_t
+{
+    void   **keys;      // Keys in the layout order, and the first one is not used.
+    void   **values;    // Values in the same order of keys.
+    unsigned count;
+
+    ccntr_map_compare_keys_t         compare;
+    ccntr_frozen_map_release_key_t   release_key;
+    ccntr_frozen_map_release_value_t release_value;
+
+} ccntr_frozen_map_t;
+
+void ccntr_map_freeze(ccntr_map_t *self, ccntr_frozen_map_t *frozen);
+
+#ifdef CCNTR_MAN_MAP_ENABLED
+void ccntr_man_map_freeze(ccntr_man_map_t *self, ccntr_frozen_map_t *frozen);
+#endif
+
+void ccntr_frozen_map_destroy(ccntr_frozen_map_t *self);
+
+static inline
+unsigned ccntr_frozen_map_get_count(const ccntr_frozen_map_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return self->count;
+}
+
+ccntr_frozen_map_iter_t ccntr_frozen_map_get_first(const ccntr_frozen_map_t *self);
+ccntr_frozen_map_iter_t ccntr_frozen_map_get_last(const ccntr_frozen_map_t *self);
+
+ccntr_frozen_map_iter_t ccntr_frozen_map_find(const ccntr_frozen_map_t *self, const void *key);
+ccntr_frozen_map_iter_t ccntr_frozen_map_find_nearest_less(const ccntr_frozen_map_t *self, const void *key);
+ccntr_frozen_map_iter_t ccntr_frozen_map_find_nearest_great(const ccntr_frozen_map_t *self, const void *key);
+
+void* ccntr_frozen_map_find_value(const ccntr_frozen_map_t *self, const void *key);
+
+#endif  // CCNTR_FROZEN_MAP_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
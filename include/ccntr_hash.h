@@ -0,0 +1,171 @@
+/**
+ * @file
+ * @brief     Container: hash map.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_HASH_H_
+#define _CCNTR_HASH_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_HASH_ENABLED
+
+/**
+ * @class ccntr_hash_node_t
+ * @brief Node of hash map.
+ */
+typedef struct ccntr_hash_node_t
+{
+    struct ccntr_hash_node_t *next;  ///< The next node in the same bucket. READ ONLY for user!
+    size_t                    hash;  ///< Hash value of the key. READ ONLY for user!
+
+    /**
+     * Key of the node.
+     *
+     * @attention:
+     * The @a key member need to be set and managed by user manually,
+     * but do not modify it when the node is linked in a container.
+     */
+    void *key;
+
+} ccntr_hash_node_t;
+
+/**
+ * @brief Calculate hash value of a key.
+ *
+ * @param key The key.
+ * @return The hash value, and equivalent keys must have the same hash value.
+ */
+typedef size_t(*ccntr_hash_hash_key_t)(const void *key);
+
+/**
+ * @brief Compare keys.
+ *
+ * @param key1 The first key.
+ * @param key2 The second key.
+ * @retval ZERO     The first key is equivalent to the second key.
+ * @retval NONZERO  The keys are different.
+ *
+ * @remarks Functions of ccntr_map_compare_keys_t can be used as this function.
+ */
+typedef int(*ccntr_hash_compare_keys_t)(const void *key1, const void *key2);
+
+size_t ccntr_hash_hash_integral(const void *key);
+
+/**
+ * @class ccntr_hash_t
+ * @brief Hash map container.
+ * @details Nodes are linked in chains of buckets, and
+ *          the bucket table will be resized by the count of nodes.
+ *          Nodes are moved to the resized table incrementally
+ *          by a few buckets on each link and unlink operation,
+ *          so that a resizing will not stall a single operation.
+ *
+ * @attention Iterating nodes while linking or unlinking other nodes
+ *            may cause some nodes be skipped or be visited twice,
+ *            because nodes may be moved between tables.
+ */
+typedef struct ccntr_hash_t
+{
+    ccntr_hash_node_t **buckets[2];     // The main table, and the table being resized to.
+    size_t              sizes[2];
+    size_t              rehash_index;   // Buckets before this index of the main table are moved.
+    unsigned            count;
+
+    ccntr_hash_hash_key_t     hash;
+    ccntr_hash_compare_keys_t compare;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_hash_t;
+
+void ccntr_hash_init(ccntr_hash_t *self, ccntr_hash_hash_key_t hash, ccntr_hash_compare_keys_t compare);
+void ccntr_hash_destroy(ccntr_hash_t *self);
+
+static inline
+unsigned ccntr_hash_get_count(const ccntr_hash_t *self)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned count = self->count;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+
+ccntr_hash_node_t* ccntr_hash_get_first(ccntr_hash_t *self);
+ccntr_hash_node_t* ccntr_hash_get_next(ccntr_hash_t *self, const ccntr_hash_node_t *node);
+
+static inline
+const ccntr_hash_node_t* ccntr_hash_get_first_c(const ccntr_hash_t *self)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Get the first node.
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     *
+     * @remarks Nodes are not sorted in any particular order.
+     */
+    return ccntr_hash_get_first((ccntr_hash_t*)self);
+}
+
+static inline
+const ccntr_hash_node_t* ccntr_hash_get_next_c(const ccntr_hash_t *self, const ccntr_hash_node_t *node)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Get the next node of a specific node.
+     *
+     * @param self Object instance.
+     * @param node A node in the container.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    return ccntr_hash_get_next((ccntr_hash_t*)self, node);
+}
+
+ccntr_hash_node_t* ccntr_hash_find(ccntr_hash_t *self, const void *key);
+
+static inline
+const ccntr_hash_node_t* ccntr_hash_find_c(const ccntr_hash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_hash_find((ccntr_hash_t*)self, key);
+}
+
+ccntr_hash_node_t* ccntr_hash_link(ccntr_hash_t *self, ccntr_hash_node_t *node);
+void ccntr_hash_unlink(ccntr_hash_t *self, ccntr_hash_node_t *node);
+ccntr_hash_node_t* ccntr_hash_unlink_by_key(ccntr_hash_t *self, const void *key);
+
+void ccntr_hash_discard_all(ccntr_hash_t *self);
+
+#endif  // CCNTR_HASH_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
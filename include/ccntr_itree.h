@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @brief     Container: interval tree.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_ITREE_H_
+#define _CCNTR_ITREE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_ITREE_ENABLED
+
+/**
+ * @class ccntr_itree_node_t
+ * @brief Node of interval tree.
+ * @details Each node represents a half-open interval [low, high).
+ */
+typedef struct ccntr_itree_node_t
+{
+    ccntr_map_node_t map_node;  ///< Nodes are sorted by intervals. READ ONLY for user!
+
+    /**
+     * Bounds of the interval.
+     *
+     * @attention:
+     * The @a low and @a high members need to be set by user manually before be linked,
+     * and do not modify them when the node is linked in a container.
+     */
+    int64_t low;
+    int64_t high;
+
+    int64_t max;    ///< The maximum high bound of the subtree. READ ONLY for user!
+
+} ccntr_itree_node_t;
+
+static inline
+void ccntr_itree_node_init(ccntr_itree_node_t *self, int64_t low, int64_t high)
+{
+    /**
+     * @memberof ccntr_itree_node_t
+     * @brief Set bounds of the interval.
+     *
+     * @param self Object instance.
+     * @param low  The low bound of the interval (inclusive).
+     * @param high The high bound of the interval (exclusive).
+     */
+    self->low  = low;
+    self->high = high;
+}
+
+ccntr_itree_node_t* ccntr_itree_node_get_next(ccntr_itree_node_t *self);
+
+static inline
+const ccntr_itree_node_t* ccntr_itree_node_get_next_c(const ccntr_itree_node_t *self)
+{
+    /**
+     * @memberof ccntr_itree_node_t
+     * @brief Get the next node (in order).
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     *
+     * @remarks Nodes are ordered by low bounds, and then by high bounds.
+     */
+    return ccntr_itree_node_get_next((ccntr_itree_node_t*)self);
+}
+
+/**
+ * @class ccntr_itree_t
+ * @brief Interval tree container.
+ * @details The container is a key map sorted by intervals,
+ *          and each node maintains the maximum high bound of its subtree
+ *          by the augmentation of key map,
+ *          so that subtrees without overlapped intervals can be skipped on searching.
+ *          Nodes with the same interval can be linked together.
+ */
+typedef struct ccntr_itree_t
+{
+    ccntr_map_t super;
+} ccntr_itree_t;
+
+void ccntr_itree_init(ccntr_itree_t *self);
+
+static inline
+unsigned ccntr_itree_get_count(const ccntr_itree_t *self)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     */
+    return ccntr_map_get_count(&self->super);
+}
+
+ccntr_itree_node_t* ccntr_itree_get_first(ccntr_itree_t *self);
+
+static inline
+const ccntr_itree_node_t* ccntr_itree_get_first_c(const ccntr_itree_t *self)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Get the first node (in order).
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     */
+    return ccntr_itree_get_first((ccntr_itree_t*)self);
+}
+
+ccntr_itree_node_t* ccntr_itree_find_first_overlap(ccntr_itree_t *self, int64_t low, int64_t high);
+ccntr_itree_node_t* ccntr_itree_find_next_overlap(ccntr_itree_t      *self,
+                                                  ccntr_itree_node_t *node,
+                                                  int64_t             low,
+                                                  int64_t             high);
+
+ccntr_itree_node_t* ccntr_itree_find_first_stab(ccntr_itree_t *self, int64_t point);
+ccntr_itree_node_t* ccntr_itree_find_next_stab(ccntr_itree_t      *self,
+                                               ccntr_itree_node_t *node,
+                                               int64_t             point);
+
+void ccntr_itree_link(ccntr_itree_t *self, ccntr_itree_node_t *node);
+void ccntr_itree_unlink(ccntr_itree_t *self, ccntr_itree_node_t *node);
+
+static inline
+void ccntr_itree_discard_all(ccntr_itree_t *self)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Discard all linkage of nodes in the container.
+     *
+     * @param self Object instance.
+     */
+    ccntr_map_discard_all(&self->super);
+}
+
+#endif  // CCNTR_ITREE_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
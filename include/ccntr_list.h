@@ -135,6 +135,22 @@ const ccntr_list_node_t* ccntr_list_get_last_c(const ccntr_list_t *self)
 void ccntr_list_link  (ccntr_list_t *self, ccntr_list_node_t *pos, ccntr_list_node_t *node);
 void ccntr_list_unlink(ccntr_list_t *self, ccntr_list_node_t *node);
 
+/**
+ * A function that compare two nodes.
+ *
+ * @param node1 The first node.
+ * @param node2 The second node.
+ * @param arg   An user defined argument which is passed to the sort function.
+ * @retval NEGATIVE The first node goes before the second node.
+ * @retval ZERO     The first node is equivalent to the second node.
+ * @retval POSITIVE The first node goes after the second node.
+ */
+typedef int(*ccntr_list_compare_nodes_t)(const ccntr_list_node_t *node1,
+                                         const ccntr_list_node_t *node2,
+                                         void                    *arg);
+
+void ccntr_list_sort(ccntr_list_t *self, ccntr_list_compare_nodes_t compare, void *arg);
+
 static inline
 void ccntr_list_link_first(ccntr_list_t *self, ccntr_list_node_t *node)
 {
@@ -185,6 +185,12 @@ void clsname##_clear(clsname##_t *self)
 }                                                                               \
                                                                                 \
 static inline                                                                   \
+void clsname##_sort(clsname##_t *self, ccntr_man_list_compare_values_t compare) \
+{                                                                               \
+    ccntr_man_list_sort(&self->super, compare);                                 \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
 valtype clsname##_pop(clsname##_t *self, clsname##_iter_t *pos)                 \
 {                                                                               \
     return (valtype) ccntr_man_list_pop(&self->super, &pos->super);             \
@@ -0,0 +1,232 @@
+/**
+ * @file
+ * @brief     Container: LRU cache.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_LRU_H_
+#define _CCNTR_LRU_H_
+
+#include <stddef.h>
+#include "ccntr_spinlock.h"
+#include "ccntr_list.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @class ccntr_lru_node_t
+ * @brief Node of LRU cache.
+ */
+typedef struct ccntr_lru_node_t
+{
+    /**
+     * Key map node.
+     *
+     * @attention:
+     * The key (ccntr_map_node_t::key) of this member need to be set
+     * and managed by user manually,
+     * but do not modify it when the node is linked in a container.
+     * And all the other members are READ ONLY for user!
+     */
+    ccntr_map_node_t map_node;
+
+    ccntr_list_node_t list_node;  ///< Recently used order. READ ONLY for user!
+
+    /**
+     * Weight of the node.
+     *
+     * @attention:
+     * The @a weight member need to be set by user manually before be linked,
+     * and do not modify it when the node is linked in a container.
+     */
+    size_t weight;
+
+} ccntr_lru_node_t;
+
+static inline
+void ccntr_lru_node_init(ccntr_lru_node_t *self, void *key, size_t weight)
+{
+    /**
+     * @memberof ccntr_lru_node_t
+     * @brief Set key and weight of the node.
+     *
+     * @param self   Object instance.
+     * @param key    Key of the node.
+     * @param weight Weight of the node.
+     */
+    self->map_node.key = key;
+    self->weight       = weight;
+}
+
+/**
+ * @class ccntr_lru_stats_t
+ * @brief Statistics of LRU cache.
+ */
+typedef struct ccntr_lru_stats_t
+{
+    unsigned long long hits;       ///< Count of searches which found the node.
+    unsigned long long misses;     ///< Count of searches which did not found the node.
+    unsigned long long evictions;  ///< Count of nodes be evicted by capacity limitation.
+} ccntr_lru_stats_t;
+
+/**
+ * @class ccntr_lru_t
+ * @brief LRU cache container.
+ * @details The container combines a key map (for search) and
+ *          a linked list (for recently used order),
+ *          and both of them are protected by the container lock together.
+ */
+typedef struct ccntr_lru_t
+{
+    ccntr_map_t  map;
+    ccntr_list_t list;  // From the most recently used to the least.
+
+    size_t capacity;
+    size_t weight;
+
+    ccntr_lru_stats_t stats;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_lru_t;
+
+void ccntr_lru_init(ccntr_lru_t *self, ccntr_map_compare_keys_t compare, size_t capacity);
+
+static inline
+unsigned ccntr_lru_get_count(const ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     */
+    return ccntr_map_get_count(&self->map);
+}
+
+static inline
+size_t ccntr_lru_get_weight(const ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get total weight of nodes.
+     *
+     * @param self Object instance.
+     * @return The total weight of nodes.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    size_t weight = self->weight;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return weight;
+}
+
+static inline
+size_t ccntr_lru_get_capacity(const ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get capacity (the maximum total weight).
+     *
+     * @param self Object instance.
+     * @return The capacity; or ZERO if the capacity is unlimited.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    size_t capacity = self->capacity;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return capacity;
+}
+
+static inline
+void ccntr_lru_set_capacity(ccntr_lru_t *self, size_t capacity)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Set capacity (the maximum total weight).
+     *
+     * @param self     Object instance.
+     * @param capacity The capacity; or ZERO to be unlimited.
+     *
+     * @remarks Nodes will not be evicted by this function,
+     *          and please use ccntr_lru_t::ccntr_lru_unlink_overflow to evict nodes.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    self->capacity = capacity;
+    ccntr_spinlock_unlock(&self->lock);
+}
+
+static inline
+ccntr_lru_stats_t ccntr_lru_get_stats(const ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get statistics.
+     *
+     * @param self Object instance.
+     * @return The statistics.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    ccntr_lru_stats_t stats = self->stats;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return stats;
+}
+
+static inline
+void ccntr_lru_reset_stats(ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Reset statistics to zero.
+     *
+     * @param self Object instance.
+     */
+    static const ccntr_lru_stats_t stats0 = {0};
+
+    ccntr_spinlock_lock(&self->lock);
+    self->stats = stats0;
+    ccntr_spinlock_unlock(&self->lock);
+}
+
+ccntr_lru_node_t* ccntr_lru_get_newest(ccntr_lru_t *self);
+ccntr_lru_node_t* ccntr_lru_get_oldest(ccntr_lru_t *self);
+ccntr_lru_node_t* ccntr_lru_node_get_older(ccntr_lru_node_t *self);
+ccntr_lru_node_t* ccntr_lru_node_get_newer(ccntr_lru_node_t *self);
+
+ccntr_lru_node_t* ccntr_lru_find(ccntr_lru_t *self, const void *key);
+ccntr_lru_node_t* ccntr_lru_peek(ccntr_lru_t *self, const void *key);
+
+static inline
+const ccntr_lru_node_t* ccntr_lru_peek_c(const ccntr_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Find node by key without touch it.
+     * @details Similarly to ccntr_lru_t::ccntr_lru_find,
+     *          but the recently used order and statistics will not be changed.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_lru_peek((ccntr_lru_t*)self, key);
+}
+
+ccntr_lru_node_t* ccntr_lru_link(ccntr_lru_t *self, ccntr_lru_node_t *node);
+void ccntr_lru_unlink(ccntr_lru_t *self, ccntr_lru_node_t *node);
+ccntr_lru_node_t* ccntr_lru_unlink_by_key(ccntr_lru_t *self, const void *key);
+ccntr_lru_node_t* ccntr_lru_unlink_overflow(ccntr_lru_t *self);
+
+void ccntr_lru_discard_all(ccntr_lru_t *self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
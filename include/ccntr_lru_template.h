@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @brief     Container: LRU cache (template).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_LRU_TEMPLATE_H_
+#define _CCNTR_LRU_TEMPLATE_H_
+
+#include "ccntr_man_lru.h"
+
+#ifdef CCNTR_MAN_LRU_ENABLED
+
+#define CCNTR_DECLARE_LRU(clsname, keytype, valtype, compare, release_key, release_value) \
+                                                                                \
+                                                                                \
+                                                                                \
+                                                                                \
+typedef struct clsname##_t                                                      \
+{                                                                               \
+    ccntr_man_lru_t super;                                                      \
+} clsname##_t;                                                                  \
+                                                                                \
+static inline                                                                   \
+void clsname##_init(clsname##_t *self, size_t capacity)                         \
+{                                                                               \
+    ccntr_man_lru_init(&self->super, compare, capacity, release_key, release_value); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_destroy(clsname##_t *self)                                       \
+{                                                                               \
+    ccntr_man_lru_destroy(&self->super);                                        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+unsigned clsname##_get_count(const clsname##_t *self)                           \
+{                                                                               \
+    return ccntr_man_lru_get_count(&self->super);                               \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+size_t clsname##_get_weight(const clsname##_t *self)                            \
+{                                                                               \
+    return ccntr_man_lru_get_weight(&self->super);                              \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+size_t clsname##_get_capacity(const clsname##_t *self)                          \
+{                                                                               \
+    return ccntr_man_lru_get_capacity(&self->super);                            \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_set_capacity(clsname##_t *self, size_t capacity)                 \
+{                                                                               \
+    ccntr_man_lru_set_capacity(&self->super, capacity);                         \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+ccntr_lru_stats_t clsname##_get_stats(const clsname##_t *self)                  \
+{                                                                               \
+    return ccntr_man_lru_get_stats(&self->super);                               \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_reset_stats(clsname##_t *self)                                   \
+{                                                                               \
+    ccntr_man_lru_reset_stats(&self->super);                                    \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_find_value(clsname##_t *self, const keytype key)              \
+{                                                                               \
+    return (valtype) ccntr_man_lru_find_value(&self->super, (const void*)key);  \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_peek_value(clsname##_t *self, const keytype key)              \
+{                                                                               \
+    return (valtype) ccntr_man_lru_peek_value(&self->super, (const void*)key);  \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const valtype clsname##_peek_value_c(const clsname##_t *self, const keytype key) \
+{                                                                               \
+    return (const valtype) ccntr_man_lru_peek_value_c(&self->super, (const void*)key); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_insert(clsname##_t *self, keytype key, valtype value)            \
+{                                                                               \
+    ccntr_man_lru_insert(&self->super, (void*)key, (void*)value);               \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_insert_weighted(clsname##_t *self, keytype key, valtype value, size_t weight) \
+{                                                                               \
+    ccntr_man_lru_insert_weighted(&self->super, (void*)key, (void*)value, weight); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_erase_by_key(clsname##_t *self, const keytype key)               \
+{                                                                               \
+    ccntr_man_lru_erase_by_key(&self->super, (const void*)key);                 \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_clear(clsname##_t *self)                                         \
+{                                                                               \
+    ccntr_man_lru_clear(&self->super);                                          \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_pop_by_key(clsname##_t *self, const keytype key)              \
+{                                                                               \
+    return (valtype) ccntr_man_lru_pop_by_key(&self->super, (const void*)key);  \
+}
+
+#endif  // CCNTR_MAN_LRU_ENABLED
+
+#endif
@@ -0,0 +1,262 @@
+/**
+ * @file
+ * @brief     Container: adaptive radix tree key map of machine words (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_ART_H_
+#define _CCNTR_MAN_ART_H_
+
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_ART_ENABLED
+
+struct ccntr_man_art_node_t;
+struct ccntr_man_art_leaf_t;
+
+/**
+ * @class ccntr_man_art_iter_t
+ * @brief Iterator of adaptive radix tree key map.
+ */
+typedef struct ccntr_man_art_iter_t
+{
+    struct ccntr_man_art_t      *container;
+    struct ccntr_man_art_leaf_t *leaf;
+} ccntr_man_art_iter_t;
+
+static inline
+void ccntr_man_art_iter_init(ccntr_man_art_iter_t        *self,
+                             struct ccntr_man_art_t      *container,
+                             struct ccntr_man_art_leaf_t *leaf)
+{
+    self->container = container;
+    self->leaf      = leaf;
+}
+
+static inline
+bool ccntr_man_art_iter_have_value(const ccntr_man_art_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->leaf;
+}
+
+void ccntr_man_art_iter_move_prev(ccntr_man_art_iter_t *self);
+void ccntr_man_art_iter_move_next(ccntr_man_art_iter_t *self);
+
+void* ccntr_man_art_iter_get_key(ccntr_man_art_iter_t *self);
+void* ccntr_man_art_iter_get_value(ccntr_man_art_iter_t *self);
+
+/**
+ * @class ccntr_man_art_citer_t
+ * @brief Constant iterator of adaptive radix tree key map.
+ */
+typedef struct ccntr_man_art_citer_t
+{
+    const struct ccntr_man_art_t      *container;
+    const struct ccntr_man_art_leaf_t *leaf;
+} ccntr_man_art_citer_t;
+
+static inline
+void ccntr_man_art_citer_init(ccntr_man_art_citer_t             *self,
+                              const struct ccntr_man_art_t      *container,
+                              const struct ccntr_man_art_leaf_t *leaf)
+{
+    self->container = container;
+    self->leaf      = leaf;
+}
+
+static inline
+bool ccntr_man_art_citer_have_value(const ccntr_man_art_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->leaf;
+}
+
+void ccntr_man_art_citer_move_prev(ccntr_man_art_citer_t *self);
+void ccntr_man_art_citer_move_next(ccntr_man_art_citer_t *self);
+
+const void* ccntr_man_art_citer_get_key(const ccntr_man_art_citer_t *self);
+const void* ccntr_man_art_citer_get_value(const ccntr_man_art_citer_t *self);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_art_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_art_t
+ * @brief Adaptive radix tree key map container.
+ * @details Keys are machine words (integers or pointers casted to void pointers),
+ *          and are ordered as signed integers,
+ *          which is the same as the default comparison of other key maps.
+ *
+ *          Keys are split into bytes from the most significant one,
+ *          and each inner node dispatches one byte of keys by
+ *          a child array which grows and shrinks with its children count
+ *          (4, 16, 48, or 256 children).
+ *          Inner nodes with a single child are collapsed,
+ *          so that a search visits at most one node per byte of keys,
+ *          and costs a handful of cache misses regardless of the values count.
+ *
+ * @remarks Iterators stay valid until the value they pointed be erased,
+ *          and moving an iterator searches from the root again.
+ */
+typedef struct ccntr_man_art_t
+{
+    struct ccntr_man_art_node_t *root;
+    unsigned                     count;
+
+    ccntr_man_art_release_value_t release_value;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_man_art_t;
+
+void ccntr_man_art_init(ccntr_man_art_t *self, ccntr_man_art_release_value_t release_value);
+void ccntr_man_art_destroy(ccntr_man_art_t *self);
+
+static inline
+unsigned ccntr_man_art_get_count(const ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned count = self->count;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+
+ccntr_man_art_iter_t ccntr_man_art_get_first(ccntr_man_art_t *self);
+ccntr_man_art_iter_t ccntr_man_art_get_last(ccntr_man_art_t *self);
+
+ccntr_man_art_iter_t ccntr_man_art_find(ccntr_man_art_t *self, const void *key);
+ccntr_man_art_iter_t ccntr_man_art_find_nearest_less(ccntr_man_art_t *self, const void *key);
+ccntr_man_art_iter_t ccntr_man_art_find_nearest_great(ccntr_man_art_t *self, const void *key);
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_to_citer(ccntr_man_art_iter_t iter)
+{
+    ccntr_man_art_citer_t citer;
+    ccntr_man_art_citer_init(&citer, iter.container, iter.leaf);
+
+    return citer;
+}
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_get_first_c(const ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    return ccntr_man_art_to_citer(ccntr_man_art_get_first((ccntr_man_art_t*)self));
+}
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_get_last_c(const ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    return ccntr_man_art_to_citer(ccntr_man_art_get_last((ccntr_man_art_t*)self));
+}
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_find_c(const ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_art_to_citer(ccntr_man_art_find((ccntr_man_art_t*)self, key));
+}
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_find_nearest_less_c(const ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_art_to_citer(ccntr_man_art_find_nearest_less((ccntr_man_art_t*)self, key));
+}
+
+static inline
+ccntr_man_art_citer_t ccntr_man_art_find_nearest_great_c(const ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_art_to_citer(ccntr_man_art_find_nearest_great((ccntr_man_art_t*)self, key));
+}
+
+void* ccntr_man_art_find_value(ccntr_man_art_t *self, const void *key);
+const void* ccntr_man_art_find_value_c(const ccntr_man_art_t *self, const void *key);
+
+void ccntr_man_art_insert(ccntr_man_art_t *self, const void *key, void *value);
+void ccntr_man_art_erase(ccntr_man_art_t *self, ccntr_man_art_iter_t *pos);
+bool ccntr_man_art_erase_by_key(ccntr_man_art_t *self, const void *key);
+void ccntr_man_art_clear(ccntr_man_art_t *self);
+
+void* ccntr_man_art_pop(ccntr_man_art_t *self, ccntr_man_art_iter_t *pos);
+
+#endif  // CCNTR_MAN_ART_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,289 @@
+/**
+ * @file
+ * @brief     Container: B+ tree key map (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_BTREE_H_
+#define _CCNTR_MAN_BTREE_H_
+
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_BTREE_ENABLED
+
+struct ccntr_man_btree_node_t;
+struct ccntr_man_btree_leaf_t;
+
+/**
+ * @class ccntr_man_btree_iter_t
+ * @brief Iterator of B+ tree key map.
+ */
+typedef struct ccntr_man_btree_iter_t
+{
+    struct ccntr_man_btree_t      *container;
+    struct ccntr_man_btree_leaf_t *leaf;
+    unsigned                       index;
+} ccntr_man_btree_iter_t;
+
+static inline
+void ccntr_man_btree_iter_init(ccntr_man_btree_iter_t        *self,
+                               struct ccntr_man_btree_t      *container,
+                               struct ccntr_man_btree_leaf_t *leaf,
+                               unsigned                       index)
+{
+    self->container = container;
+    self->leaf      = leaf;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_man_btree_iter_have_value(const ccntr_man_btree_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->leaf;
+}
+
+void ccntr_man_btree_iter_move_prev(ccntr_man_btree_iter_t *self);
+void ccntr_man_btree_iter_move_next(ccntr_man_btree_iter_t *self);
+
+void* ccntr_man_btree_iter_get_key(ccntr_man_btree_iter_t *self);
+void* ccntr_man_btree_iter_get_value(ccntr_man_btree_iter_t *self);
+
+/**
+ * @class ccntr_man_btree_citer_t
+ * @brief Constant iterator of B+ tree key map.
+ */
+typedef struct ccntr_man_btree_citer_t
+{
+    const struct ccntr_man_btree_t      *container;
+    const struct ccntr_man_btree_leaf_t *leaf;
+    unsigned                             index;
+} ccntr_man_btree_citer_t;
+
+static inline
+void ccntr_man_btree_citer_init(ccntr_man_btree_citer_t             *self,
+                                const struct ccntr_man_btree_t      *container,
+                                const struct ccntr_man_btree_leaf_t *leaf,
+                                unsigned                             index)
+{
+    self->container = container;
+    self->leaf      = leaf;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_man_btree_citer_have_value(const ccntr_man_btree_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->leaf;
+}
+
+void ccntr_man_btree_citer_move_prev(ccntr_man_btree_citer_t *self);
+void ccntr_man_btree_citer_move_next(ccntr_man_btree_citer_t *self);
+
+const void* ccntr_man_btree_citer_get_key(const ccntr_man_btree_citer_t *self);
+const void* ccntr_man_btree_citer_get_value(const ccntr_man_btree_citer_t *self);
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_btree_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_btree_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_btree_t
+ * @brief B+ tree key map container.
+ * @details Keys and values are stored in leaf nodes which have
+ *          the size of a few cache lines, and leaf nodes are linked in key order.
+ *          Comparing to the red-black tree key map (ccntr_man_map_t),
+ *          there are much less allocations and cache misses for each value.
+ *
+ * @attention Values are moved between nodes when the tree is modified,
+ *            so that iterators are invalid after inserting or erasing values.
+ */
+typedef struct ccntr_man_btree_t
+{
+    struct ccntr_man_btree_node_t *root;
+    struct ccntr_man_btree_leaf_t *first;
+    struct ccntr_man_btree_leaf_t *last;
+    unsigned                       count;
+
+    ccntr_map_compare_keys_t        compare;
+    ccntr_man_btree_release_key_t   release_key;
+    ccntr_man_btree_release_value_t release_value;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_man_btree_t;
+
+void ccntr_man_btree_init(ccntr_man_btree_t              *self,
+                          ccntr_map_compare_keys_t        compare,
+                          ccntr_man_btree_release_key_t   release_key,
+                          ccntr_man_btree_release_value_t release_value);
+void ccntr_man_btree_destroy(ccntr_man_btree_t *self);
+
+static inline
+unsigned ccntr_man_btree_get_count(const ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned count = self->count;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+
+ccntr_man_btree_iter_t ccntr_man_btree_get_first(ccntr_man_btree_t *self);
+ccntr_man_btree_iter_t ccntr_man_btree_get_last(ccntr_man_btree_t *self);
+
+ccntr_man_btree_iter_t ccntr_man_btree_find(ccntr_man_btree_t *self, const void *key);
+ccntr_man_btree_iter_t ccntr_man_btree_find_nearest_less(ccntr_man_btree_t *self, const void *key);
+ccntr_man_btree_iter_t ccntr_man_btree_find_nearest_great(ccntr_man_btree_t *self, const void *key);
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_to_citer(ccntr_man_btree_iter_t iter)
+{
+    ccntr_man_btree_citer_t citer;
+    ccntr_man_btree_citer_init(&citer, iter.container, iter.leaf, iter.index);
+
+    return citer;
+}
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_get_first_c(const ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    return ccntr_man_btree_to_citer(ccntr_man_btree_get_first((ccntr_man_btree_t*)self));
+}
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_get_last_c(const ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    return ccntr_man_btree_to_citer(ccntr_man_btree_get_last((ccntr_man_btree_t*)self));
+}
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_find_c(const ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_btree_to_citer(ccntr_man_btree_find((ccntr_man_btree_t*)self, key));
+}
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_find_nearest_less_c(const ccntr_man_btree_t *self,
+                                                            const void              *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_btree_to_citer(ccntr_man_btree_find_nearest_less((ccntr_man_btree_t*)self, key));
+}
+
+static inline
+ccntr_man_btree_citer_t ccntr_man_btree_find_nearest_great_c(const ccntr_man_btree_t *self,
+                                                             const void              *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    return ccntr_man_btree_to_citer(ccntr_man_btree_find_nearest_great((ccntr_man_btree_t*)self, key));
+}
+
+void* ccntr_man_btree_find_value(ccntr_man_btree_t *self, const void *key);
+const void* ccntr_man_btree_find_value_c(const ccntr_man_btree_t *self, const void *key);
+
+void* ccntr_man_btree_find_value_nearest_less(ccntr_man_btree_t *self,
+                                              const void        *key);
+const void* ccntr_man_btree_find_value_nearest_less_c(const ccntr_man_btree_t *self,
+                                                      const void              *key);
+
+void* ccntr_man_btree_find_value_nearest_great(ccntr_man_btree_t *self,
+                                               const void        *key);
+const void* ccntr_man_btree_find_value_nearest_great_c(const ccntr_man_btree_t *self,
+                                                       const void              *key);
+
+void ccntr_man_btree_insert(ccntr_man_btree_t *self, void *key, void *value);
+void ccntr_man_btree_erase(ccntr_man_btree_t *self, ccntr_man_btree_iter_t *pos);
+void ccntr_man_btree_erase_by_key(ccntr_man_btree_t *self, const void *key);
+void ccntr_man_btree_clear(ccntr_man_btree_t *self);
+
+void* ccntr_man_btree_pop(ccntr_man_btree_t *self, ccntr_man_btree_iter_t *pos);
+
+#endif  // CCNTR_MAN_BTREE_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
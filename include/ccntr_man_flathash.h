@@ -0,0 +1,289 @@
+/**
+ * @file
+ * @brief     Container: open addressing hash map (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_FLATHASH_H_
+#define _CCNTR_MAN_FLATHASH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_FLATHASH_ENABLED
+
+/**
+ * @class ccntr_man_flathash_slot_t
+ * @brief Slot of open addressing hash map.
+ */
+typedef struct ccntr_man_flathash_slot_t
+{
+    void *key;
+    void *value;
+} ccntr_man_flathash_slot_t;
+
+/**
+ * @class ccntr_man_flathash_iter_t
+ * @brief Iterator of open addressing hash map.
+ */
+typedef struct ccntr_man_flathash_iter_t
+{
+    struct ccntr_man_flathash_t *container;
+    ccntr_man_flathash_slot_t   *slot;
+} ccntr_man_flathash_iter_t;
+
+static inline
+void ccntr_man_flathash_iter_init(ccntr_man_flathash_iter_t   *self,
+                                  struct ccntr_man_flathash_t *container,
+                                  ccntr_man_flathash_slot_t   *slot)
+{
+    self->container = container;
+    self->slot      = slot;
+}
+
+static inline
+bool ccntr_man_flathash_iter_have_value(const ccntr_man_flathash_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->slot;
+}
+
+void ccntr_man_flathash_iter_move_next(ccntr_man_flathash_iter_t *self);
+
+static inline
+void* ccntr_man_flathash_iter_get_key(ccntr_man_flathash_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     *
+     * @attention Do NOT modify the key directly, except
+     *            the key (and value) has already be popped from the container.
+     */
+    return self->slot ? self->slot->key : NULL;
+}
+
+static inline
+void* ccntr_man_flathash_iter_get_value(ccntr_man_flathash_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->slot ? self->slot->value : NULL;
+}
+
+/**
+ * @class ccntr_man_flathash_citer_t
+ * @brief Constant iterator of open addressing hash map.
+ */
+typedef struct ccntr_man_flathash_citer_t
+{
+    const struct ccntr_man_flathash_t *container;
+    const ccntr_man_flathash_slot_t   *slot;
+} ccntr_man_flathash_citer_t;
+
+static inline
+void ccntr_man_flathash_citer_init(ccntr_man_flathash_citer_t        *self,
+                                   const struct ccntr_man_flathash_t *container,
+                                   const ccntr_man_flathash_slot_t   *slot)
+{
+    self->container = container;
+    self->slot      = slot;
+}
+
+static inline
+bool ccntr_man_flathash_citer_have_value(const ccntr_man_flathash_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->slot;
+}
+
+void ccntr_man_flathash_citer_move_next(ccntr_man_flathash_citer_t *self);
+
+static inline
+const void* ccntr_man_flathash_citer_get_key(const ccntr_man_flathash_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->slot ? self->slot->key : NULL;
+}
+
+static inline
+const void* ccntr_man_flathash_citer_get_value(const ccntr_man_flathash_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->slot ? self->slot->value : NULL;
+}
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_flathash_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_flathash_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_flathash_t
+ * @brief Open addressing hash map container.
+ * @details Keys and values are stored in a flat array of slots,
+ *          and each slot has a control byte which stores
+ *          the state of the slot and seven bits of the hash value.
+ *          The control bytes are probed by groups of 16 slots
+ *          (by SSE2 instructions if available),
+ *          so that most of the unmatched slots will not be visited.
+ *
+ * @attention Slots will be moved when the table is resized,
+ *            so that iterators are invalid after inserting values.
+ */
+typedef struct ccntr_man_flathash_t
+{
+    uint8_t                   *ctrl;
+    ccntr_man_flathash_slot_t *slots;
+    size_t                     capacity;
+    size_t                     growth_left;     // Count of empty slots can be used before resizing.
+    unsigned                   count;
+
+    ccntr_hash_hash_key_t     hash;
+    ccntr_hash_compare_keys_t compare;
+
+    ccntr_man_flathash_release_key_t   release_key;
+    ccntr_man_flathash_release_value_t release_value;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_man_flathash_t;
+
+void ccntr_man_flathash_init(ccntr_man_flathash_t              *self,
+                             ccntr_hash_hash_key_t              hash,
+                             ccntr_hash_compare_keys_t          compare,
+                             ccntr_man_flathash_release_key_t   release_key,
+                             ccntr_man_flathash_release_value_t release_value);
+void ccntr_man_flathash_destroy(ccntr_man_flathash_t *self);
+
+static inline
+unsigned ccntr_man_flathash_get_count(const ccntr_man_flathash_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned count = self->count;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+
+ccntr_man_flathash_iter_t ccntr_man_flathash_get_first(ccntr_man_flathash_t *self);
+
+static inline
+ccntr_man_flathash_citer_t ccntr_man_flathash_get_first_c(const ccntr_man_flathash_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     *
+     * @remarks Values are not sorted in any particular order.
+     */
+    ccntr_man_flathash_iter_t iter = ccntr_man_flathash_get_first((ccntr_man_flathash_t*)self);
+
+    ccntr_man_flathash_citer_t citer;
+    ccntr_man_flathash_citer_init(&citer, iter.container, iter.slot);
+
+    return citer;
+}
+
+ccntr_man_flathash_iter_t ccntr_man_flathash_find(ccntr_man_flathash_t *self, const void *key);
+
+static inline
+ccntr_man_flathash_citer_t ccntr_man_flathash_find_c(const ccntr_man_flathash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_man_flathash_iter_t iter = ccntr_man_flathash_find((ccntr_man_flathash_t*)self, key);
+
+    ccntr_man_flathash_citer_t citer;
+    ccntr_man_flathash_citer_init(&citer, iter.container, iter.slot);
+
+    return citer;
+}
+
+void* ccntr_man_flathash_find_value(ccntr_man_flathash_t *self, const void *key);
+const void* ccntr_man_flathash_find_value_c(const ccntr_man_flathash_t *self, const void *key);
+
+void ccntr_man_flathash_insert(ccntr_man_flathash_t *self, void *key, void *value);
+void ccntr_man_flathash_erase(ccntr_man_flathash_t *self, ccntr_man_flathash_iter_t *pos);
+void ccntr_man_flathash_erase_by_key(ccntr_man_flathash_t *self, const void *key);
+void ccntr_man_flathash_clear(ccntr_man_flathash_t *self);
+
+void* ccntr_man_flathash_pop(ccntr_man_flathash_t *self, ccntr_man_flathash_iter_t *pos);
+
+#endif  // CCNTR_MAN_FLATHASH_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
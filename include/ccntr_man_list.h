@@ -146,6 +146,17 @@ const void* ccntr_man_list_citer_get_value(const ccntr_man_list_citer_t *self);
  */
 typedef void(*ccntr_man_list_release_value_t)(void *value);
 
+/**
+ * A function that compare two values.
+ *
+ * @param value1 The first value.
+ * @param value2 The second value.
+ * @retval NEGATIVE The first value goes before the second value.
+ * @retval ZERO     The first value is equivalent to the second value.
+ * @retval POSITIVE The first value goes after the second value.
+ */
+typedef int(*ccntr_man_list_compare_values_t)(const void *value1, const void *value2);
+
 /**
  * @class ccntr_man_list_t
  * @brief Linked list container.
@@ -253,6 +264,8 @@ void ccntr_man_list_erase_last (ccntr_man_list_t *self);
 
 void ccntr_man_list_clear(ccntr_man_list_t *self);
 
+void ccntr_man_list_sort(ccntr_man_list_t *self, ccntr_man_list_compare_values_t compare);
+
 void* ccntr_man_list_pop(ccntr_man_list_t *self, ccntr_man_list_iter_t *pos);
 
 #endif  // CCNTR_MAN_LIST_ENABLED
@@ -0,0 +1,157 @@
+/**
+ * @file
+ * @brief     Container: LRU cache (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_LRU_H_
+#define _CCNTR_MAN_LRU_H_
+
+#include "ccntr_config.h"
+#include "ccntr_lru.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_LRU_ENABLED
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_lru_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_lru_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_lru_t
+ * @brief LRU cache container.
+ * @details Values will be evicted (and released by the release callbacks)
+ *          from the least recently used one automatically,
+ *          when the total weight exceeds the capacity.
+ */
+typedef struct ccntr_man_lru_t
+{
+    ccntr_lru_t super;
+
+    ccntr_man_lru_release_key_t   release_key;
+    ccntr_man_lru_release_value_t release_value;
+
+} ccntr_man_lru_t;
+
+void ccntr_man_lru_init(ccntr_man_lru_t              *self,
+                        ccntr_map_compare_keys_t      compare,
+                        size_t                        capacity,
+                        ccntr_man_lru_release_key_t   release_key,
+                        ccntr_man_lru_release_value_t release_value);
+void ccntr_man_lru_destroy(ccntr_man_lru_t *self);
+
+static inline
+unsigned ccntr_man_lru_get_count(const ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return ccntr_lru_get_count(&self->super);
+}
+
+static inline
+size_t ccntr_man_lru_get_weight(const ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Get total weight of values.
+     *
+     * @param self Object instance.
+     * @return The total weight of values.
+     */
+    return ccntr_lru_get_weight(&self->super);
+}
+
+static inline
+size_t ccntr_man_lru_get_capacity(const ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Get capacity (the maximum total weight).
+     *
+     * @param self Object instance.
+     * @return The capacity; or ZERO if the capacity is unlimited.
+     */
+    return ccntr_lru_get_capacity(&self->super);
+}
+
+void ccntr_man_lru_set_capacity(ccntr_man_lru_t *self, size_t capacity);
+
+static inline
+ccntr_lru_stats_t ccntr_man_lru_get_stats(const ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Get statistics.
+     *
+     * @param self Object instance.
+     * @return The statistics.
+     */
+    return ccntr_lru_get_stats(&self->super);
+}
+
+static inline
+void ccntr_man_lru_reset_stats(ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Reset statistics to zero.
+     *
+     * @param self Object instance.
+     */
+    ccntr_lru_reset_stats(&self->super);
+}
+
+void* ccntr_man_lru_find_value(ccntr_man_lru_t *self, const void *key);
+void* ccntr_man_lru_peek_value(ccntr_man_lru_t *self, const void *key);
+
+static inline
+const void* ccntr_man_lru_peek_value_c(const ccntr_man_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Find value by key without touch it.
+     * @details Similarly to ccntr_man_lru_t::ccntr_man_lru_find_value,
+     *          but the recently used order and statistics will not be changed.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_lru_peek_value((ccntr_man_lru_t*)self, key);
+}
+
+void ccntr_man_lru_insert(ccntr_man_lru_t *self, void *key, void *value);
+void ccntr_man_lru_insert_weighted(ccntr_man_lru_t *self, void *key, void *value, size_t weight);
+void ccntr_man_lru_erase_by_key(ccntr_man_lru_t *self, const void *key);
+void ccntr_man_lru_clear(ccntr_man_lru_t *self);
+
+void* ccntr_man_lru_pop_by_key(ccntr_man_lru_t *self, const void *key);
+
+#endif  // CCNTR_MAN_LRU_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -187,6 +187,10 @@ typedef void(*ccntr_man_map_release_value_t)(void *value);
 /**
  * @class ccntr_man_map_t
  * @brief Key map container.
+ * @details Elements are allocated from slabs owned by the container,
+ *          and erased elements are reused by later insertions,
+ *          so that elements are close to each other in memory,
+ *          and clearing the container releases whole slabs.
  */
 typedef struct ccntr_man_map_t
 {
@@ -195,6 +199,9 @@ typedef struct ccntr_man_map_t
     ccntr_man_map_release_key_t   release_key;
     ccntr_man_map_release_value_t release_value;
 
+    struct ccntr_man_map_slab_t    *slabs;          // The newest slab is the first one.
+    struct ccntr_man_map_element_t *free_elements;
+
 } ccntr_man_map_t;
 
 void ccntr_man_map_init(ccntr_man_map_t              *self,
@@ -409,13 +416,103 @@ void* ccntr_man_map_find_value_nearest_great(ccntr_man_map_t *self,
 const void* ccntr_man_map_find_value_nearest_great_c(const ccntr_man_map_t *self,
                                                      const void            *key);
 
+static inline
+unsigned ccntr_man_map_count_range(const ccntr_man_map_t *self, const void *lower, const void *upper)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Get count of values which have keys in a range.
+     *
+     * @param self  Object instance.
+     * @param lower The lower bound of keys (inclusive).
+     * @param upper The upper bound of keys (exclusive).
+     * @return Count of values in the range.
+     *
+     * @remarks The cost is logarithmic if the order statistics option is enabled,
+     *          or it will be proportional to the count of values in the range.
+     */
+    return ccntr_map_count_range(&self->super, lower, upper);
+}
+
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+
+static inline
+ccntr_man_map_iter_t ccntr_man_map_select(ccntr_man_map_t *self, unsigned index)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Find value by its order.
+     *
+     * @param self  Object instance.
+     * @param index Zero based index of the value in key order.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if the index is out of range.
+     */
+    ccntr_man_map_iter_t iter;
+    ccntr_man_map_iter_init(&iter, self, ccntr_map_select(&self->super, index));
+
+    return iter;
+}
+
+static inline
+ccntr_man_map_citer_t ccntr_man_map_select_c(const ccntr_man_map_t *self, unsigned index)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Find value by its order.
+     *
+     * @param self  Object instance.
+     * @param index Zero based index of the value in key order.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if the index is out of range.
+     */
+    ccntr_man_map_citer_t iter;
+    ccntr_man_map_citer_init(&iter, self, ccntr_map_select_c(&self->super, index));
+
+    return iter;
+}
+
+static inline
+unsigned ccntr_man_map_rank(const ccntr_man_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Get count of values which have keys less than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be compared.
+     * @return Count of values which are less than the key.
+     */
+    return ccntr_map_rank(&self->super, key);
+}
+
+#endif
+
 void ccntr_man_map_insert(ccntr_man_map_t *self, void *key, void *value);
+bool ccntr_man_map_upsert(ccntr_man_map_t *self, void *key, void *value);
+void** ccntr_man_map_find_or_insert(ccntr_man_map_t *self, void *key, bool *inserted);
 void ccntr_man_map_erase(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos);
 void ccntr_man_map_erase_by_key(ccntr_man_map_t *self, const void *key);
+unsigned ccntr_man_map_erase_range(ccntr_man_map_t *self, const void *lower, const void *upper);
 void ccntr_man_map_clear(ccntr_man_map_t *self);
+void ccntr_man_map_discard_all(ccntr_man_map_t *self);
+
+void ccntr_man_map_build_sorted(ccntr_man_map_t *self,
+                                void *const     *keys,
+                                void *const     *values,
+                                unsigned         count);
 
 void* ccntr_man_map_pop(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos);
 
+// Low level operations for specialised containers (like CCNTR_DECLARE_MAP_INLINE).
+ccntr_map_node_t* ccntr_man_map_create_node_without_lock(ccntr_man_map_t *self, void *key, void *value);
+void ccntr_man_map_release_node(ccntr_man_map_t *self, ccntr_map_node_t *node);
+void ccntr_man_map_release_node_without_lock(ccntr_man_map_t  *self,
+                                             ccntr_map_node_t *node,
+                                             void            **key,
+                                             void            **value);
+void ccntr_man_map_release_key_value(ccntr_man_map_t *self, void *key, void *value);
+
 #endif  // CCNTR_MAN_MAP_ENABLED
 
 #ifdef __cplusplus
@@ -0,0 +1,154 @@
+/**
+ * @file
+ * @brief     Container: persistent key map (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_PMAP_H_
+#define _CCNTR_MAN_PMAP_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_epoch.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_PMAP_ENABLED
+
+/**
+ * The maximum height of trees, and is enough for any count of values.
+ */
+#define CCNTR_MAN_PMAP_MAX_HEIGHT 64
+
+/**
+ * @class ccntr_man_pmap_snap_t
+ * @brief Snapshot of persistent key map.
+ * @details A snapshot is an immutable version of the container,
+ *          and can be read without any locks.
+ */
+typedef struct ccntr_man_pmap_snap_t ccntr_man_pmap_snap_t;
+
+/**
+ * @class ccntr_man_pmap_citer_t
+ * @brief Constant iterator of persistent key map snapshot.
+ */
+typedef struct ccntr_man_pmap_citer_t
+{
+    const struct ccntr_man_pmap_node_t *stack[CCNTR_MAN_PMAP_MAX_HEIGHT];  // Path to the current node.
+    unsigned                            depth;
+} ccntr_man_pmap_citer_t;
+
+static inline
+bool ccntr_man_pmap_citer_have_value(const ccntr_man_pmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->depth;
+}
+
+void ccntr_man_pmap_citer_move_next(ccntr_man_pmap_citer_t *self);
+
+const void* ccntr_man_pmap_citer_get_key(const ccntr_man_pmap_citer_t *self);
+const void* ccntr_man_pmap_citer_get_value(const ccntr_man_pmap_citer_t *self);
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_pmap_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_pmap_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_pmap_t
+ * @brief Persistent key map container.
+ * @details This container is a red-black tree without parent links,
+ *          and each modification copies the path from the root to the modified node
+ *          to build a new version, and publishes the new version atomically.
+ *          Unmodified subtrees are shared between versions.
+ *
+ *          Readers get a snapshot (ccntr_man_pmap_t::ccntr_man_pmap_get_snapshot)
+ *          by constant time and without blocking writers,
+ *          and can read the snapshot without any locks until they release it.
+ *          Old versions are released when they are neither the current version
+ *          nor held by any snapshots.
+ *
+ * @remarks Writers are serialised by the container lock.
+ */
+typedef struct ccntr_man_pmap_t
+{
+    struct ccntr_man_pmap_snap_t *current;  // The current version.
+    ccntr_epoch_t                 epoch;    // Protects readers which are getting the current version.
+
+    ccntr_map_compare_keys_t       compare;
+    ccntr_man_pmap_release_key_t   release_key;
+    ccntr_man_pmap_release_value_t release_value;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_man_pmap_t;
+
+void ccntr_man_pmap_init(ccntr_man_pmap_t              *self,
+                         ccntr_map_compare_keys_t       compare,
+                         ccntr_man_pmap_release_key_t   release_key,
+                         ccntr_man_pmap_release_value_t release_value);
+void ccntr_man_pmap_destroy(ccntr_man_pmap_t *self);
+
+unsigned ccntr_man_pmap_get_count(const ccntr_man_pmap_t *self);
+
+static inline
+void ccntr_man_pmap_reclaim(ccntr_man_pmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Release old versions which are not accessible by any readers.
+     * @details Old versions are also released by further modifications automatically,
+     *          and this function can be used to release them without modifications.
+     *
+     * @param self Object instance.
+     */
+    ccntr_epoch_reclaim(&self->epoch);
+}
+
+void ccntr_man_pmap_insert(ccntr_man_pmap_t *self, void *key, void *value);
+bool ccntr_man_pmap_erase_by_key(ccntr_man_pmap_t *self, const void *key);
+void ccntr_man_pmap_clear(ccntr_man_pmap_t *self);
+
+ccntr_man_pmap_snap_t* ccntr_man_pmap_get_snapshot(ccntr_man_pmap_t *self);
+
+void ccntr_man_pmap_snap_release(ccntr_man_pmap_snap_t *self);
+
+unsigned ccntr_man_pmap_snap_get_count(const ccntr_man_pmap_snap_t *self);
+
+const void* ccntr_man_pmap_snap_find_value(const ccntr_man_pmap_snap_t *self, const void *key);
+
+ccntr_man_pmap_citer_t ccntr_man_pmap_snap_get_first(const ccntr_man_pmap_snap_t *self);
+ccntr_man_pmap_citer_t ccntr_man_pmap_snap_find_nearest_great(const ccntr_man_pmap_snap_t *self,
+                                                              const void                  *key);
+
+#endif  // CCNTR_MAN_PMAP_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/**
+ * @file
+ * @brief     Container: read-mostly linked list with lock-free traversal (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_RCULIST_H_
+#define _CCNTR_MAN_RCULIST_H_
+
+#include "ccntr_config.h"
+#include "ccntr_epoch.h"
+#include "ccntr_rculist.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_RCULIST_ENABLED
+
+/**
+ * @class ccntr_man_rculist_iter_t
+ * @brief Iterator of read-mostly list.
+ */
+typedef struct ccntr_man_rculist_iter_t
+{
+    struct ccntr_man_rculist_t *container;
+    ccntr_rculist_node_t       *node;
+} ccntr_man_rculist_iter_t;
+
+static inline
+void ccntr_man_rculist_iter_init(ccntr_man_rculist_iter_t   *self,
+                                 struct ccntr_man_rculist_t *container,
+                                 ccntr_rculist_node_t       *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_rculist_iter_have_value(const ccntr_man_rculist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+static inline
+void ccntr_man_rculist_iter_move_next(ccntr_man_rculist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_rculist_node_get_next(self->node);
+}
+
+void* ccntr_man_rculist_iter_get_value(ccntr_man_rculist_iter_t *self);
+
+/**
+ * @class ccntr_man_rculist_citer_t
+ * @brief Constant iterator of read-mostly list.
+ */
+typedef struct ccntr_man_rculist_citer_t
+{
+    const struct ccntr_man_rculist_t *container;
+    const ccntr_rculist_node_t       *node;
+} ccntr_man_rculist_citer_t;
+
+static inline
+void ccntr_man_rculist_citer_init(ccntr_man_rculist_citer_t        *self,
+                                  const struct ccntr_man_rculist_t *container,
+                                  const ccntr_rculist_node_t       *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_rculist_citer_have_value(const ccntr_man_rculist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+static inline
+void ccntr_man_rculist_citer_move_next(ccntr_man_rculist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_rculist_node_get_next_c(self->node);
+}
+
+const void* ccntr_man_rculist_citer_get_value(const ccntr_man_rculist_citer_t *self);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_rculist_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_rculist_t
+ * @brief Read-mostly list container.
+ * @details Values can be traversed by multiple readers concurrently with writers,
+ *          and erased values are released after
+ *          all concurrent read sections have left.
+ *
+ * @attention
+ * Readers must traverse the list (and access the values) in a read section
+ * (ccntr_man_rculist_t::ccntr_man_rculist_read_lock and
+ * ccntr_man_rculist_t::ccntr_man_rculist_read_unlock)
+ * if other threads may erase values at the same time.
+ */
+typedef struct ccntr_man_rculist_t
+{
+    ccntr_rculist_t super;
+    ccntr_epoch_t   epoch;
+
+    ccntr_man_rculist_release_value_t release_value;
+
+} ccntr_man_rculist_t;
+
+void ccntr_man_rculist_init(ccntr_man_rculist_t *self, ccntr_man_rculist_release_value_t release_value);
+void ccntr_man_rculist_destroy(ccntr_man_rculist_t *self);
+
+static inline
+unsigned ccntr_man_rculist_get_count(const ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return ccntr_rculist_get_count(&self->super);
+}
+
+static inline
+unsigned ccntr_man_rculist_read_lock(ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Enter a read section.
+     * @details Values (and iterators) which are got in the read section
+     *          will not be released until the section be left.
+     *
+     * @param self Object instance.
+     * @return A ticket to be passed to ccntr_man_rculist_t::ccntr_man_rculist_read_unlock.
+     */
+    return ccntr_epoch_read_lock(&self->epoch);
+}
+
+static inline
+void ccntr_man_rculist_read_unlock(ccntr_man_rculist_t *self, unsigned ticket)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Leave a read section.
+     *
+     * @param self   Object instance.
+     * @param ticket The ticket returned by ccntr_man_rculist_t::ccntr_man_rculist_read_lock.
+     */
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+}
+
+static inline
+void ccntr_man_rculist_reclaim(ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Release erased values which are not accessible by any readers.
+     * @details Erased values are also released by further erasing automatically,
+     *          and this function can be used to release them without erasing.
+     *
+     * @param self Object instance.
+     */
+    ccntr_epoch_reclaim(&self->epoch);
+}
+
+static inline
+ccntr_man_rculist_iter_t ccntr_man_rculist_get_first(ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator point to the first value.
+     */
+    ccntr_man_rculist_iter_t iter;
+    ccntr_man_rculist_iter_init(&iter, self, ccntr_rculist_get_first(&self->super));
+
+    return iter;
+}
+
+static inline
+ccntr_man_rculist_citer_t ccntr_man_rculist_get_first_c(const ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator point to the first value.
+     */
+    ccntr_man_rculist_citer_t iter;
+    ccntr_man_rculist_citer_init(&iter, self, ccntr_rculist_get_first_c(&self->super));
+
+    return iter;
+}
+
+void ccntr_man_rculist_insert      (ccntr_man_rculist_t *self, ccntr_man_rculist_iter_t *pos, void *value);
+void ccntr_man_rculist_insert_first(ccntr_man_rculist_t *self, void *value);
+void ccntr_man_rculist_insert_last (ccntr_man_rculist_t *self, void *value);
+
+void ccntr_man_rculist_erase      (ccntr_man_rculist_t *self, ccntr_man_rculist_iter_t *pos);
+bool ccntr_man_rculist_erase_value(ccntr_man_rculist_t *self, const void *value);
+
+void ccntr_man_rculist_clear(ccntr_man_rculist_t *self);
+
+#endif  // CCNTR_MAN_RCULIST_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,428 @@
+/**
+ * @file
+ * @brief     Container: concurrent skip list key map (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_SKIPMAP_H_
+#define _CCNTR_MAN_SKIPMAP_H_
+
+#include "ccntr_config.h"
+#include "ccntr_epoch.h"
+#include "ccntr_skipmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_SKIPMAP_ENABLED
+
+/**
+ * @class ccntr_man_skipmap_iter_t
+ * @brief Iterator of skip list key map.
+ */
+typedef struct ccntr_man_skipmap_iter_t
+{
+    struct ccntr_man_skipmap_t *container;
+    ccntr_skipmap_node_t       *node;
+} ccntr_man_skipmap_iter_t;
+
+static inline
+void ccntr_man_skipmap_iter_init(ccntr_man_skipmap_iter_t   *self,
+                                 struct ccntr_man_skipmap_t *container,
+                                 ccntr_skipmap_node_t       *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_skipmap_iter_have_value(const ccntr_man_skipmap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+void ccntr_man_skipmap_iter_move_prev(ccntr_man_skipmap_iter_t *self);
+
+static inline
+void ccntr_man_skipmap_iter_move_next(ccntr_man_skipmap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_skipmap_node_get_next(self->node);
+}
+
+static inline
+void* ccntr_man_skipmap_iter_get_key(ccntr_man_skipmap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     *
+     * @attention Do NOT modify the key directly.
+     */
+    return self->node ? self->node->key : NULL;
+}
+
+void* ccntr_man_skipmap_iter_get_value(ccntr_man_skipmap_iter_t *self);
+
+/**
+ * @class ccntr_man_skipmap_citer_t
+ * @brief Constant iterator of skip list key map.
+ */
+typedef struct ccntr_man_skipmap_citer_t
+{
+    const struct ccntr_man_skipmap_t *container;
+    const ccntr_skipmap_node_t       *node;
+} ccntr_man_skipmap_citer_t;
+
+static inline
+void ccntr_man_skipmap_citer_init(ccntr_man_skipmap_citer_t        *self,
+                                  const struct ccntr_man_skipmap_t *container,
+                                  const ccntr_skipmap_node_t       *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_skipmap_citer_have_value(const ccntr_man_skipmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+void ccntr_man_skipmap_citer_move_prev(ccntr_man_skipmap_citer_t *self);
+
+static inline
+void ccntr_man_skipmap_citer_move_next(ccntr_man_skipmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_skipmap_node_get_next_c(self->node);
+}
+
+static inline
+const void* ccntr_man_skipmap_citer_get_key(const ccntr_man_skipmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->node ? self->node->key : NULL;
+}
+
+const void* ccntr_man_skipmap_citer_get_value(const ccntr_man_skipmap_citer_t *self);
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_skipmap_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_skipmap_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_skipmap_t
+ * @brief Concurrent skip list key map container.
+ * @details Values can be inserted, erased and searched by multiple threads
+ *          concurrently, and erased values are released after
+ *          all concurrent read sections have left.
+ *
+ * @attention
+ * Iterators and values got from the container are only guaranteed to be
+ * accessible in a read section
+ * (ccntr_man_skipmap_t::ccntr_man_skipmap_read_lock and
+ * ccntr_man_skipmap_t::ccntr_man_skipmap_read_unlock)
+ * if other threads may erase values at the same time.
+ */
+typedef struct ccntr_man_skipmap_t
+{
+    ccntr_skipmap_t super;
+    ccntr_epoch_t   epoch;
+
+    ccntr_man_skipmap_release_key_t   release_key;
+    ccntr_man_skipmap_release_value_t release_value;
+
+} ccntr_man_skipmap_t;
+
+void ccntr_man_skipmap_init(ccntr_man_skipmap_t              *self,
+                            ccntr_map_compare_keys_t          compare,
+                            ccntr_man_skipmap_release_key_t   release_key,
+                            ccntr_man_skipmap_release_value_t release_value);
+void ccntr_man_skipmap_destroy(ccntr_man_skipmap_t *self);
+
+static inline
+unsigned ccntr_man_skipmap_get_count(const ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return ccntr_skipmap_get_count(&self->super);
+}
+
+static inline
+unsigned ccntr_man_skipmap_read_lock(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Enter a read section.
+     * @details Values (and iterators) which are got in the read section
+     *          will not be released until the section be left.
+     *
+     * @param self Object instance.
+     * @return A ticket to be passed to ccntr_man_skipmap_t::ccntr_man_skipmap_read_unlock.
+     */
+    return ccntr_epoch_read_lock(&self->epoch);
+}
+
+static inline
+void ccntr_man_skipmap_read_unlock(ccntr_man_skipmap_t *self, unsigned ticket)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Leave a read section.
+     *
+     * @param self   Object instance.
+     * @param ticket The ticket returned by ccntr_man_skipmap_t::ccntr_man_skipmap_read_lock.
+     */
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+}
+
+static inline
+void ccntr_man_skipmap_reclaim(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Release erased values which are not accessible by any readers.
+     * @details Erased values are also released by further erasing automatically,
+     *          and this function can be used to release them without erasing.
+     *
+     * @param self Object instance.
+     */
+    ccntr_epoch_reclaim(&self->epoch);
+}
+
+static inline
+ccntr_man_skipmap_iter_t ccntr_man_skipmap_get_first(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Get the first value (in order).
+     *
+     * @param self Object instance.
+     * @return An iterator point to the first value.
+     */
+    ccntr_man_skipmap_iter_t iter;
+    ccntr_man_skipmap_iter_init(&iter, self, ccntr_skipmap_get_first(&self->super));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_citer_t ccntr_man_skipmap_get_first_c(const ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Get the first value (in order).
+     *
+     * @param self Object instance.
+     * @return An iterator point to the first value.
+     */
+    ccntr_man_skipmap_citer_t iter;
+    ccntr_man_skipmap_citer_init(&iter, self, ccntr_skipmap_get_first_c(&self->super));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_iter_t ccntr_man_skipmap_get_last(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Get the last value (in order).
+     *
+     * @param self Object instance.
+     * @return An iterator point to the last value.
+     */
+    ccntr_man_skipmap_iter_t iter;
+    ccntr_man_skipmap_iter_init(&iter, self, ccntr_skipmap_get_last(&self->super));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_citer_t ccntr_man_skipmap_get_last_c(const ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Get the last value (in order).
+     *
+     * @param self Object instance.
+     * @return An iterator point to the last value.
+     */
+    ccntr_man_skipmap_citer_t iter;
+    ccntr_man_skipmap_citer_init(&iter, self, ccntr_skipmap_get_last_c(&self->super));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_iter_t ccntr_man_skipmap_find(ccntr_man_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_iter_t iter;
+    ccntr_man_skipmap_iter_init(&iter, self, ccntr_skipmap_find(&self->super, key));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_citer_t ccntr_man_skipmap_find_c(const ccntr_man_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_citer_t iter;
+    ccntr_man_skipmap_citer_init(&iter, self, ccntr_skipmap_find_c(&self->super, key));
+    return iter;
+}
+
+void* ccntr_man_skipmap_find_value(ccntr_man_skipmap_t *self, const void *key);
+const void* ccntr_man_skipmap_find_value_c(const ccntr_man_skipmap_t *self, const void *key);
+
+static inline
+ccntr_man_skipmap_iter_t ccntr_man_skipmap_find_nearest_less(ccntr_man_skipmap_t *self,
+                                                             const void          *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value with nearest key which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_iter_t iter;
+    ccntr_man_skipmap_iter_init(&iter, self, ccntr_skipmap_find_nearest_less(&self->super, key));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_citer_t ccntr_man_skipmap_find_nearest_less_c(const ccntr_man_skipmap_t *self,
+                                                                const void                *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value with nearest key which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_citer_t iter;
+    ccntr_man_skipmap_citer_init(&iter, self, ccntr_skipmap_find_nearest_less_c(&self->super, key));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_iter_t ccntr_man_skipmap_find_nearest_great(ccntr_man_skipmap_t *self,
+                                                              const void          *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value with nearest key which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_iter_t iter;
+    ccntr_man_skipmap_iter_init(&iter, self, ccntr_skipmap_find_nearest_great(&self->super, key));
+    return iter;
+}
+
+static inline
+ccntr_man_skipmap_citer_t ccntr_man_skipmap_find_nearest_great_c(const ccntr_man_skipmap_t *self,
+                                                                 const void                *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value with nearest key which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_skipmap_citer_t iter;
+    ccntr_man_skipmap_citer_init(&iter, self, ccntr_skipmap_find_nearest_great_c(&self->super, key));
+    return iter;
+}
+
+void ccntr_man_skipmap_insert(ccntr_man_skipmap_t *self, void *key, void *value);
+void ccntr_man_skipmap_erase(ccntr_man_skipmap_t *self, ccntr_man_skipmap_iter_t *pos);
+void ccntr_man_skipmap_erase_by_key(ccntr_man_skipmap_t *self, const void *key);
+void ccntr_man_skipmap_clear(ccntr_man_skipmap_t *self);
+
+#endif  // CCNTR_MAN_SKIPMAP_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
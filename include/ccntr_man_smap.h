@@ -0,0 +1,288 @@
+/**
+ * @file
+ * @brief     Container: string key map (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_SMAP_H_
+#define _CCNTR_MAN_SMAP_H_
+
+#include "ccntr_config.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_SMAP_ENABLED
+
+/**
+ * @class ccntr_man_smap_iter_t
+ * @brief Iterator of string key map.
+ */
+typedef struct ccntr_man_smap_iter_t
+{
+    struct ccntr_man_smap_t *container;
+    ccntr_map_node_t        *node;
+} ccntr_man_smap_iter_t;
+
+static inline
+void ccntr_man_smap_iter_init(ccntr_man_smap_iter_t   *self,
+                              struct ccntr_man_smap_t *container,
+                              ccntr_map_node_t        *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_smap_iter_have_value(const ccntr_man_smap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+static inline
+void ccntr_man_smap_iter_move_prev(ccntr_man_smap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_map_node_get_prev(self->node);
+}
+
+static inline
+void ccntr_man_smap_iter_move_next(ccntr_man_smap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_map_node_get_next(self->node);
+}
+
+char* ccntr_man_smap_iter_get_key(ccntr_man_smap_iter_t *self);
+void* ccntr_man_smap_iter_get_value(ccntr_man_smap_iter_t *self);
+
+/**
+ * @class ccntr_man_smap_citer_t
+ * @brief Constant iterator of string key map.
+ */
+typedef struct ccntr_man_smap_citer_t
+{
+    const struct ccntr_man_smap_t *container;
+    const ccntr_map_node_t        *node;
+} ccntr_man_smap_citer_t;
+
+static inline
+void ccntr_man_smap_citer_init(ccntr_man_smap_citer_t        *self,
+                               const struct ccntr_man_smap_t *container,
+                               const ccntr_map_node_t        *node)
+{
+    self->container = container;
+    self->node      = node;
+}
+
+static inline
+bool ccntr_man_smap_citer_have_value(const ccntr_man_smap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->node;
+}
+
+static inline
+void ccntr_man_smap_citer_move_prev(ccntr_man_smap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_citer_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_map_node_get_prev_c(self->node);
+}
+
+static inline
+void ccntr_man_smap_citer_move_next(ccntr_man_smap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_map_node_get_next_c(self->node);
+}
+
+const char* ccntr_man_smap_citer_get_key(const ccntr_man_smap_citer_t *self);
+const void* ccntr_man_smap_citer_get_value(const ccntr_man_smap_citer_t *self);
+
+/**
+ * @brief Release key.
+ * @details Callback that will be called when container want release a key.
+ *
+ * @param key The key to be released.
+ */
+typedef void(*ccntr_man_smap_release_key_t)(void *key);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_smap_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_smap_t
+ * @brief String key map container.
+ * @details Keys are null-terminated strings which are ordered by bytes (like strcmp),
+ *          and each element caches the length and the first eight bytes of its key,
+ *          so that most comparisons on searching are resolved
+ *          without accessing the memory of keys.
+ */
+typedef struct ccntr_man_smap_t
+{
+    ccntr_map_t super;
+
+    ccntr_man_smap_release_key_t   release_key;
+    ccntr_man_smap_release_value_t release_value;
+
+} ccntr_man_smap_t;
+
+void ccntr_man_smap_init(ccntr_man_smap_t              *self,
+                         ccntr_man_smap_release_key_t   release_key,
+                         ccntr_man_smap_release_value_t release_value);
+void ccntr_man_smap_destroy(ccntr_man_smap_t *self);
+
+static inline
+unsigned ccntr_man_smap_get_count(const ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return ccntr_map_get_count(&self->super);
+}
+
+static inline
+ccntr_man_smap_iter_t ccntr_man_smap_get_first(ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_smap_iter_t iter;
+    ccntr_man_smap_iter_init(&iter, self, ccntr_map_get_first(&self->super));
+
+    return iter;
+}
+
+static inline
+ccntr_man_smap_citer_t ccntr_man_smap_get_first_c(const ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_smap_citer_t iter;
+    ccntr_man_smap_citer_init(&iter, self, ccntr_map_get_first_c(&self->super));
+
+    return iter;
+}
+
+static inline
+ccntr_man_smap_iter_t ccntr_man_smap_get_last(ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_smap_iter_t iter;
+    ccntr_man_smap_iter_init(&iter, self, ccntr_map_get_last(&self->super));
+
+    return iter;
+}
+
+static inline
+ccntr_man_smap_citer_t ccntr_man_smap_get_last_c(const ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_smap_citer_t iter;
+    ccntr_man_smap_citer_init(&iter, self, ccntr_map_get_last_c(&self->super));
+
+    return iter;
+}
+
+ccntr_man_smap_iter_t ccntr_man_smap_find(ccntr_man_smap_t *self, const char *key);
+ccntr_man_smap_citer_t ccntr_man_smap_find_c(const ccntr_man_smap_t *self, const char *key);
+
+void* ccntr_man_smap_find_value(ccntr_man_smap_t *self, const char *key);
+const void* ccntr_man_smap_find_value_c(const ccntr_man_smap_t *self, const char *key);
+
+ccntr_man_smap_iter_t ccntr_man_smap_find_nearest_less(ccntr_man_smap_t *self, const char *key);
+ccntr_man_smap_citer_t ccntr_man_smap_find_nearest_less_c(const ccntr_man_smap_t *self, const char *key);
+
+ccntr_man_smap_iter_t ccntr_man_smap_find_nearest_great(ccntr_man_smap_t *self, const char *key);
+ccntr_man_smap_citer_t ccntr_man_smap_find_nearest_great_c(const ccntr_man_smap_t *self, const char *key);
+
+void ccntr_man_smap_insert(ccntr_man_smap_t *self, char *key, void *value);
+bool ccntr_man_smap_upsert(ccntr_man_smap_t *self, char *key, void *value);
+void** ccntr_man_smap_find_or_insert(ccntr_man_smap_t *self, char *key, bool *inserted);
+void ccntr_man_smap_erase(ccntr_man_smap_t *self, ccntr_man_smap_iter_t *pos);
+void ccntr_man_smap_erase_by_key(ccntr_man_smap_t *self, const char *key);
+void ccntr_man_smap_clear(ccntr_man_smap_t *self);
+
+void* ccntr_man_smap_pop(ccntr_man_smap_t *self, ccntr_man_smap_iter_t *pos);
+
+#endif  // CCNTR_MAN_SMAP_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file
+ * @brief     Container: unrolled linked list (memory managed).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAN_ULIST_H_
+#define _CCNTR_MAN_ULIST_H_
+
+#include <stdbool.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_MAN_ULIST_ENABLED
+
+/**
+ * The default count of values can be stored in each chunk.
+ */
+#define CCNTR_MAN_ULIST_DEFAULT_CHUNK_CAPACITY 16
+
+/**
+ * @class ccntr_man_ulist_iter_t
+ * @brief Iterator of unrolled linked list.
+ */
+typedef struct ccntr_man_ulist_iter_t
+{
+    struct ccntr_man_ulist_t *container;
+    ccntr_list_node_t        *chunk;
+    unsigned                  index;
+} ccntr_man_ulist_iter_t;
+
+static inline
+void ccntr_man_ulist_iter_init(ccntr_man_ulist_iter_t   *self,
+                               struct ccntr_man_ulist_t *container,
+                               ccntr_list_node_t        *chunk,
+                               unsigned                  index)
+{
+    self->container = container;
+    self->chunk     = chunk;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_man_ulist_iter_have_value(const ccntr_man_ulist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_iter_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->chunk;
+}
+
+void ccntr_man_ulist_iter_move_prev(ccntr_man_ulist_iter_t *self);
+void ccntr_man_ulist_iter_move_next(ccntr_man_ulist_iter_t *self);
+void* ccntr_man_ulist_iter_get_value(ccntr_man_ulist_iter_t *self);
+
+/**
+ * @class ccntr_man_ulist_citer_t
+ * @brief Constant iterator of unrolled linked list.
+ */
+typedef struct ccntr_man_ulist_citer_t
+{
+    const struct ccntr_man_ulist_t *container;
+    const ccntr_list_node_t        *chunk;
+    unsigned                        index;
+} ccntr_man_ulist_citer_t;
+
+static inline
+void ccntr_man_ulist_citer_init(ccntr_man_ulist_citer_t        *self,
+                                const struct ccntr_man_ulist_t *container,
+                                const ccntr_list_node_t        *chunk,
+                                unsigned                        index)
+{
+    self->container = container;
+    self->chunk     = chunk;
+    self->index     = index;
+}
+
+static inline
+bool ccntr_man_ulist_citer_have_value(const ccntr_man_ulist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_citer_t
+     * @brief Check if have a valid value.
+     *
+     * @param self Object instance.
+     * @return TRUE if it have a value; and FALSE if not.
+     */
+    return self->chunk;
+}
+
+void ccntr_man_ulist_citer_move_prev(ccntr_man_ulist_citer_t *self);
+void ccntr_man_ulist_citer_move_next(ccntr_man_ulist_citer_t *self);
+const void* ccntr_man_ulist_citer_get_value(const ccntr_man_ulist_citer_t *self);
+
+/**
+ * @brief Release value.
+ * @details Callback that will be called when container want release a value.
+ *
+ * @param value The value to be released.
+ */
+typedef void(*ccntr_man_ulist_release_value_t)(void *value);
+
+/**
+ * @class ccntr_man_ulist_t
+ * @brief Unrolled linked list container.
+ * @details This container have the same behaviour as ccntr_man_list_t,
+ *          but stores multiple values in each chunk (node) of the list,
+ *          so that it will have fewer memory allocations and
+ *          faster traversal than the ordinary linked list.
+ *
+ * @attention Insert or erase a value will invalidate all iterators
+ *            of the container, except the one passed to the operation.
+ */
+typedef struct ccntr_man_ulist_t
+{
+    ccntr_list_t super;  // The list of chunks.
+
+    unsigned count;
+    unsigned chunk_capacity;
+
+    ccntr_man_ulist_release_value_t release_value;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_man_ulist_t;
+
+void ccntr_man_ulist_init(ccntr_man_ulist_t               *self,
+                          unsigned                         chunk_capacity,
+                          ccntr_man_ulist_release_value_t  release_value);
+void ccntr_man_ulist_destroy(ccntr_man_ulist_t *self);
+
+static inline
+unsigned ccntr_man_ulist_get_count(const ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned count = self->count;
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+
+ccntr_man_ulist_iter_t ccntr_man_ulist_get_first(ccntr_man_ulist_t *self);
+ccntr_man_ulist_iter_t ccntr_man_ulist_get_last(ccntr_man_ulist_t *self);
+
+static inline
+ccntr_man_ulist_citer_t ccntr_man_ulist_get_first_c(const ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_ulist_iter_t  iter = ccntr_man_ulist_get_first((ccntr_man_ulist_t*)self);
+    ccntr_man_ulist_citer_t citer;
+    ccntr_man_ulist_citer_init(&citer, self, iter.chunk, iter.index);
+
+    return citer;
+}
+
+static inline
+ccntr_man_ulist_citer_t ccntr_man_ulist_get_last_c(const ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_ulist_iter_t  iter = ccntr_man_ulist_get_last((ccntr_man_ulist_t*)self);
+    ccntr_man_ulist_citer_t citer;
+    ccntr_man_ulist_citer_init(&citer, self, iter.chunk, iter.index);
+
+    return citer;
+}
+
+void ccntr_man_ulist_insert      (ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos, void *value);
+void ccntr_man_ulist_insert_first(ccntr_man_ulist_t *self, void *value);
+void ccntr_man_ulist_insert_last (ccntr_man_ulist_t *self, void *value);
+
+void ccntr_man_ulist_erase      (ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos);
+void ccntr_man_ulist_erase_first(ccntr_man_ulist_t *self);
+void ccntr_man_ulist_erase_last (ccntr_man_ulist_t *self);
+
+void ccntr_man_ulist_clear(ccntr_man_ulist_t *self);
+
+void* ccntr_man_ulist_pop(ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos);
+
+#endif  // CCNTR_MAN_ULIST_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -9,7 +9,9 @@
 #define _CCNTR_MAP_H_
 
 #include <stddef.h>
+#include <stdint.h>
 #include <stdbool.h>
+#include "ccntr_config.h"
 #include "ccntr_spinlock.h"
 
 #ifdef __cplusplus
@@ -19,14 +21,32 @@ extern "C" {
 /**
  * @class ccntr_map_node_t
  * @brief Node of key map.
+ *
+ * @remarks If the compact node option is enabled, the colour of node is
+ *          stored in the lowest bit of the parent pointer,
+ *          and ccntr_map_node_t::ccntr_map_node_get_parent and
+ *          ccntr_map_node_t::ccntr_map_node_is_red can be used
+ *          to read these fields on both layouts.
+ *          The node shrinks only if the order statistics option is disabled,
+ *          or the subtree size takes the space saved from the colour.
  */
 typedef struct ccntr_map_node_t
 {
+#ifdef CCNTR_MAP_COMPACT_NODE
+    uintptr_t parent_and_color;     // Parent node, and the lowest bit is set for red nodes.
+#else
     struct ccntr_map_node_t *parent;
+#endif
     struct ccntr_map_node_t *left;
     struct ccntr_map_node_t *right;
 
+#ifndef CCNTR_MAP_COMPACT_NODE
     bool is_red;
+#endif
+
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    unsigned size;  // Count of nodes of the subtree, include itself.
+#endif
 
     /**
      * Key of the node.
@@ -39,6 +59,40 @@ typedef struct ccntr_map_node_t
 
 } ccntr_map_node_t;
 
+static inline
+ccntr_map_node_t* ccntr_map_node_get_parent(const ccntr_map_node_t *self)
+{
+    /**
+     * @memberof ccntr_map_node_t
+     * @brief Get the parent node.
+     *
+     * @param self Object instance.
+     * @return The parent node; or NULL if it is the root or not linked.
+     */
+#ifdef CCNTR_MAP_COMPACT_NODE
+    return (ccntr_map_node_t*)( self->parent_and_color & ~(uintptr_t) 1 );
+#else
+    return self->parent;
+#endif
+}
+
+static inline
+bool ccntr_map_node_is_red(const ccntr_map_node_t *self)
+{
+    /**
+     * @memberof ccntr_map_node_t
+     * @brief Check if the node is red.
+     *
+     * @param self Object instance.
+     * @return TRUE if the node is red; and FALSE if it is black.
+     */
+#ifdef CCNTR_MAP_COMPACT_NODE
+    return self->parent_and_color & 1;
+#else
+    return self->is_red;
+#endif
+}
+
 ccntr_map_node_t* ccntr_map_node_get_next(ccntr_map_node_t *self);
 ccntr_map_node_t* ccntr_map_node_get_prev(ccntr_map_node_t *self);
 ccntr_map_node_t* ccntr_map_node_get_next_postorder(ccntr_map_node_t *self);
@@ -86,6 +140,28 @@ const ccntr_map_node_t* ccntr_map_node_get_prev_c(const ccntr_map_node_t *self)
  */
 typedef int(*ccntr_map_compare_keys_t)(const void *key1, const void *key2);
 
+/**
+ * A function that recalculate the user defined summary of a node.
+ *
+ * @param node The node to be updated,
+ *             and summaries of its children (if have) are already up to date.
+ *
+ * @remarks The summary of a node must be calculated from
+ *          the node itself and summaries of its children only,
+ *          and the function will be called whenever the subtree is changed.
+ */
+typedef void(*ccntr_map_augment_t)(ccntr_map_node_t *node);
+
+/**
+ * A function that accumulate nodes into a user defined result.
+ *
+ * @param result  The result object passed by user.
+ * @param node    The node to be accumulated.
+ * @param subtree TRUE to accumulate the whole subtree by the summary of the node;
+ *                and FALSE to accumulate the node itself only.
+ */
+typedef void(*ccntr_map_aggregate_t)(void *result, const ccntr_map_node_t *node, bool subtree);
+
 /**
  * @class ccntr_map_t
  * @brief Key map container.
@@ -93,9 +169,11 @@ typedef int(*ccntr_map_compare_keys_t)(const void *key1, const void *key2);
 typedef struct ccntr_map_t
 {
     ccntr_map_node_t *root;
+    ccntr_map_node_t *last;     // The node with the largest key, for appending nodes quickly.
     unsigned          count;
 
     ccntr_map_compare_keys_t compare;
+    ccntr_map_augment_t      augment;   // Summary updater of nodes, and can be NULL.
 
     CCNTR_DECLARE_SPINLOCK(lock);
 
@@ -103,6 +181,9 @@ typedef struct ccntr_map_t
 
 void ccntr_map_init(ccntr_map_t *self, ccntr_map_compare_keys_t compare);
 
+void ccntr_map_set_augment(ccntr_map_t *self, ccntr_map_augment_t augment);
+void ccntr_map_refresh_augment(ccntr_map_t *self, ccntr_map_node_t *node);
+
 static inline
 unsigned ccntr_map_get_count(const ccntr_map_t *self)
 {
@@ -172,6 +253,11 @@ const ccntr_map_node_t* ccntr_map_find_c(const ccntr_map_t *self, const void *ke
     return ccntr_map_find((ccntr_map_t*)self, key);
 }
 
+unsigned ccntr_map_find_many(ccntr_map_t       *self,
+                             const void *const *keys,
+                             unsigned           count,
+                             ccntr_map_node_t **nodes);
+
 ccntr_map_node_t* ccntr_map_find_nearest_less(ccntr_map_t *self, const void *key);
 
 static inline
@@ -205,9 +291,67 @@ const ccntr_map_node_t* ccntr_map_find_nearest_great_c(const ccntr_map_t *self,
 }
 
 ccntr_map_node_t* ccntr_map_link(ccntr_map_t *self, ccntr_map_node_t *node);
+ccntr_map_node_t* ccntr_map_link_hint(ccntr_map_t      *self,
+                                      ccntr_map_node_t *hint,
+                                      ccntr_map_node_t *node);
 void ccntr_map_unlink(ccntr_map_t *self, ccntr_map_node_t *node);
 ccntr_map_node_t* ccntr_map_unlink_by_key(ccntr_map_t *self, const void *key);
 
+void ccntr_map_build_sorted(ccntr_map_t *self, ccntr_map_node_t *const *nodes, unsigned count);
+
+unsigned ccntr_map_unlink_range(ccntr_map_t *self,
+                                const void  *lower,
+                                const void  *upper,
+                                ccntr_map_t *removed);
+unsigned ccntr_map_count_range(const ccntr_map_t *self, const void *lower, const void *upper);
+
+void ccntr_map_aggregate_range(const ccntr_map_t    *self,
+                               const void           *lower,
+                               const void           *upper,
+                               ccntr_map_aggregate_t aggregate,
+                               void                 *result);
+
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+
+ccntr_map_node_t* ccntr_map_select(ccntr_map_t *self, unsigned index);
+
+static inline
+const ccntr_map_node_t* ccntr_map_select_c(const ccntr_map_t *self, unsigned index)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Find node by its order.
+     *
+     * @param self  Object instance.
+     * @param index Zero based index of the node in key order.
+     * @return The node if found; and NULL if the index is out of range.
+     */
+    return ccntr_map_select((ccntr_map_t*)self, index);
+}
+
+unsigned ccntr_map_rank(const ccntr_map_t *self, const void *key);
+
+#endif
+
+// Low level operations for specialised containers (like CCNTR_DECLARE_MAP_INLINE).
+// The lock of the container must be held by the caller.
+ccntr_map_node_t* ccntr_map_find_closest_without_lock(const ccntr_map_t *self,
+                                                      const void        *key,
+                                                      int               *comp_res);
+void ccntr_map_link_child_without_lock(ccntr_map_t      *self,
+                                       ccntr_map_node_t *parent,
+                                       bool              at_right,
+                                       ccntr_map_node_t *node);
+void ccntr_map_replace_without_lock(ccntr_map_t      *self,
+                                    ccntr_map_node_t *node_old,
+                                    ccntr_map_node_t *node_new);
+void ccntr_map_unlink_without_lock(ccntr_map_t *self, ccntr_map_node_t *node);
+void ccntr_map_build_sorted_without_lock(ccntr_map_t *self, ccntr_map_node_t *const *nodes, unsigned count);
+unsigned ccntr_map_unlink_range_without_lock(ccntr_map_t *self,
+                                             const void  *lower,
+                                             const void  *upper,
+                                             ccntr_map_t *removed);
+
 static inline
 void ccntr_map_discard_all(ccntr_map_t *self)
 {
@@ -220,6 +364,7 @@ void ccntr_map_discard_all(ccntr_map_t *self)
     ccntr_spinlock_lock(&self->lock);
 
     self->root  = NULL;
+    self->last  = NULL;
     self->count = 0;
 
     ccntr_spinlock_unlock(&self->lock);
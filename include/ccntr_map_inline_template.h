@@ -0,0 +1,421 @@
+/**
+ * @file
+ * @brief     Container: key map with inlined key comparison (template).
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_MAP_INLINE_TEMPLATE_H_
+#define _CCNTR_MAP_INLINE_TEMPLATE_H_
+
+#include <stdint.h>
+#include "ccntr_man_map.h"
+
+#ifdef CCNTR_MAN_MAP_ENABLED
+
+/**
+ * Compare integral keys,
+ * and can be used as the @a compare parameter of CCNTR_DECLARE_MAP_INLINE.
+ */
+#define CCNTR_MAP_COMPARE_INTEGRAL(key1, key2) ( ( (key1) > (key2) ) - ( (key1) < (key2) ) )
+
+/*
+ * Declare a key map class which have the same interface as CCNTR_DECLARE_MAP,
+ * but the tree searching loops are generated for the class,
+ * so that the key comparison can be inlined instead of
+ * being called through a function pointer.
+ *
+ * The compare parameter is a function (or a function-like macro)
+ * which compares two keys of keytype,
+ * and returns an integral value like ccntr_map_compare_keys_t.
+ */
+#define CCNTR_DECLARE_MAP_INLINE(clsname, keytype, valtype, compare, release_key, release_value) \
+                                                                                \
+                                                                                \
+                                                                                \
+                                                                                \
+typedef struct clsname##_iter_t                                                 \
+{                                                                               \
+    ccntr_man_map_iter_t super;                                                 \
+} clsname##_iter_t;                                                             \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_iter_init(ccntr_man_map_iter_t src)                  \
+{                                                                               \
+    clsname##_iter_t iter = {src};                                              \
+    return iter;                                                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+bool clsname##_iter_have_value(const clsname##_iter_t *self)                    \
+{                                                                               \
+    return ccntr_man_map_iter_have_value(&self->super);                         \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_iter_move_prev(clsname##_iter_t *self)                           \
+{                                                                               \
+    ccntr_man_map_iter_move_prev(&self->super);                                 \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_iter_move_next(clsname##_iter_t *self)                           \
+{                                                                               \
+    ccntr_man_map_iter_move_next(&self->super);                                 \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+keytype clsname##_iter_get_key(clsname##_iter_t *self)                          \
+{                                                                               \
+    return (keytype)(intptr_t) ccntr_man_map_iter_get_key(&self->super);        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_iter_get_value(clsname##_iter_t *self)                        \
+{                                                                               \
+    return (valtype) ccntr_man_map_iter_get_value(&self->super);                \
+}                                                                               \
+                                                                                \
+                                                                                \
+                                                                                \
+                                                                                \
+typedef struct clsname##_citer_t                                                \
+{                                                                               \
+    ccntr_man_map_citer_t super;                                                \
+} clsname##_citer_t;                                                            \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_citer_init(ccntr_man_map_citer_t src)               \
+{                                                                               \
+    clsname##_citer_t iter = {src};                                             \
+    return iter;                                                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+bool clsname##_citer_have_value(const clsname##_citer_t *self)                  \
+{                                                                               \
+    return ccntr_man_map_citer_have_value(&self->super);                        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_citer_move_prev(clsname##_citer_t *self)                         \
+{                                                                               \
+    ccntr_man_map_citer_move_prev(&self->super);                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_citer_move_next(clsname##_citer_t *self)                         \
+{                                                                               \
+    ccntr_man_map_citer_move_next(&self->super);                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const keytype clsname##_citer_get_key(const clsname##_citer_t *self)            \
+{                                                                               \
+    return (const keytype)(intptr_t) ccntr_man_map_citer_get_key(&self->super); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const valtype clsname##_citer_get_value(const clsname##_citer_t *self)          \
+{                                                                               \
+    return (const valtype) ccntr_man_map_citer_get_value(&self->super);         \
+}                                                                               \
+                                                                                \
+                                                                                \
+                                                                                \
+                                                                                \
+typedef struct clsname##_t                                                      \
+{                                                                               \
+    ccntr_man_map_t super;                                                      \
+} clsname##_t;                                                                  \
+                                                                                \
+static inline                                                                   \
+int clsname##_compare_keys(const void *key1, const void *key2)                  \
+{                                                                               \
+    return compare((keytype)(intptr_t) key1, (keytype)(intptr_t) key2);         \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+ccntr_map_node_t* clsname##_find_match_without_lock(const clsname##_t *self, const keytype key) \
+{                                                                               \
+    ccntr_map_node_t *node = self->super.super.root;                            \
+    while( node )                                                               \
+    {                                                                           \
+        int comp_res = compare((keytype)(intptr_t) node->key, key);             \
+        if( comp_res < 0 )                                                      \
+            node = node->right;                                                 \
+        else if( comp_res > 0 )                                                 \
+            node = node->left;                                                  \
+        else                                                                    \
+            break;                                                              \
+    }                                                                           \
+                                                                                \
+    return node;                                                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+ccntr_map_node_t* clsname##_find_closest_without_lock(const clsname##_t *self,  \
+                                                      const keytype      key,   \
+                                                      int               *comp_res) \
+{                                                                               \
+    /* Keys greater than the last node are found directly. */                   \
+    ccntr_map_node_t *last = self->super.super.last;                            \
+    if( last && compare((keytype)(intptr_t) last->key, key) < 0 )               \
+    {                                                                           \
+        *comp_res = -1;                                                         \
+        return last;                                                            \
+    }                                                                           \
+                                                                                \
+    ccntr_map_node_t *node = self->super.super.root;                            \
+    int res = 0;                                                                \
+    while( node )                                                               \
+    {                                                                           \
+        res = compare((keytype)(intptr_t) node->key, key);                      \
+        ccntr_map_node_t *next = ( res < 0 )?( node->right ):( res > 0 )?( node->left ):( NULL ); \
+        if( !next ) break;                                                      \
+        node = next;                                                            \
+    }                                                                           \
+                                                                                \
+    *comp_res = res;                                                            \
+    return node;                                                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+ccntr_map_node_t* clsname##_find_nearest_node(const clsname##_t *self, const keytype key, bool less) \
+{                                                                               \
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->super.super.lock );         \
+                                                                                \
+    int comp_res;                                                               \
+    ccntr_map_node_t *node = clsname##_find_closest_without_lock(self, key, &comp_res); \
+    if( node && less && comp_res > 0 )                                          \
+        node = ccntr_map_node_get_prev(node);                                   \
+    else if( node && !less && comp_res < 0 )                                    \
+        node = ccntr_map_node_get_next(node);                                   \
+                                                                                \
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->super.super.lock );       \
+                                                                                \
+    return node;                                                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_iter_from_node(clsname##_t *self, ccntr_map_node_t *node) \
+{                                                                               \
+    ccntr_man_map_iter_t iter;                                                  \
+    ccntr_man_map_iter_init(&iter, &self->super, node);                         \
+    return clsname##_iter_init(iter);                                           \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_citer_from_node(const clsname##_t *self, const ccntr_map_node_t *node) \
+{                                                                               \
+    ccntr_man_map_citer_t iter;                                                 \
+    ccntr_man_map_citer_init(&iter, &self->super, node);                        \
+    return clsname##_citer_init(iter);                                          \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_init(clsname##_t *self)                                          \
+{                                                                               \
+    ccntr_man_map_init(&self->super, clsname##_compare_keys, release_key, release_value); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_destroy(clsname##_t *self)                                       \
+{                                                                               \
+    ccntr_man_map_destroy(&self->super);                                        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+unsigned clsname##_get_count(const clsname##_t *self)                           \
+{                                                                               \
+    return ccntr_man_map_get_count(&self->super);                               \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_get_first(clsname##_t *self)                         \
+{                                                                               \
+    return clsname##_iter_init(ccntr_man_map_get_first(&self->super));          \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_get_first_c(const clsname##_t *self)                \
+{                                                                               \
+    return clsname##_citer_init(ccntr_man_map_get_first_c(&self->super));       \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_get_last(clsname##_t *self)                          \
+{                                                                               \
+    return clsname##_iter_init(ccntr_man_map_get_last(&self->super));           \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_get_last_c(const clsname##_t *self)                 \
+{                                                                               \
+    return clsname##_citer_init(ccntr_man_map_get_last_c(&self->super));        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_find(clsname##_t *self, const keytype key)           \
+{                                                                               \
+    ccntr_spinlock_lock(&self->super.super.lock);                               \
+    ccntr_map_node_t *node = clsname##_find_match_without_lock(self, key);      \
+    ccntr_spinlock_unlock(&self->super.super.lock);                             \
+                                                                                \
+    return clsname##_iter_from_node(self, node);                                \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_find_c(const clsname##_t *self, const keytype key)  \
+{                                                                               \
+    return clsname##_citer_from_node(self, clsname##_find((clsname##_t*)self, key).super.node); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_find_value(clsname##_t *self, const keytype key)              \
+{                                                                               \
+    clsname##_iter_t iter = clsname##_find(self, key);                          \
+    return clsname##_iter_get_value(&iter);                                     \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const valtype clsname##_find_value_c(const clsname##_t *self, const keytype key) \
+{                                                                               \
+    return clsname##_find_value((clsname##_t*)self, key);                       \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_find_nearest_less(clsname##_t   *self,               \
+                                           const keytype  key)                  \
+{                                                                               \
+    return clsname##_iter_from_node(self, clsname##_find_nearest_node(self, key, true)); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_find_nearest_less_c(const clsname##_t *self,        \
+                                              const keytype      key)           \
+{                                                                               \
+    return clsname##_citer_from_node(self, clsname##_find_nearest_node(self, key, true)); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_find_value_nearest_less(clsname##_t   *self,                  \
+                                        const keytype  key)                     \
+{                                                                               \
+    clsname##_iter_t iter = clsname##_find_nearest_less(self, key);             \
+    return clsname##_iter_get_value(&iter);                                     \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const valtype clsname##_find_value_nearest_less_c(const clsname##_t *self,      \
+                                                const keytype      key)         \
+{                                                                               \
+    return clsname##_find_value_nearest_less((clsname##_t*)self, key);          \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_find_nearest_great(clsname##_t   *self,              \
+                                            const keytype  key)                 \
+{                                                                               \
+    return clsname##_iter_from_node(self, clsname##_find_nearest_node(self, key, false)); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_find_nearest_great_c(const clsname##_t *self,       \
+                                               const keytype      key)          \
+{                                                                               \
+    return clsname##_citer_from_node(self, clsname##_find_nearest_node(self, key, false)); \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_find_value_nearest_great(clsname##_t   *self,                 \
+                                         const keytype  key)                    \
+{                                                                               \
+    clsname##_iter_t iter = clsname##_find_nearest_great(self, key);            \
+    return clsname##_iter_get_value(&iter);                                     \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+const valtype clsname##_find_value_nearest_great_c(const clsname##_t *self,     \
+                                                 const keytype      key)        \
+{                                                                               \
+    return clsname##_find_value_nearest_great((clsname##_t*)self, key);         \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_insert(clsname##_t *self, keytype key, valtype value)            \
+{                                                                               \
+    bool  replaced  = false;                                                    \
+    void *key_old   = NULL;                                                     \
+    void *value_old = NULL;                                                     \
+                                                                                \
+    ccntr_spinlock_lock(&self->super.super.lock);                               \
+                                                                                \
+    ccntr_map_node_t *node =                                                    \
+        ccntr_man_map_create_node_without_lock(&self->super, (void*)(intptr_t) key, (void*)value); \
+                                                                                \
+    int comp_res;                                                               \
+    ccntr_map_node_t *closest = clsname##_find_closest_without_lock(self, key, &comp_res); \
+    if( closest && !comp_res )                                                  \
+    {                                                                           \
+        ccntr_map_replace_without_lock(&self->super.super, closest, node);      \
+        ccntr_man_map_release_node_without_lock(&self->super, closest, &key_old, &value_old); \
+        replaced = true;                                                        \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        ccntr_map_link_child_without_lock(&self->super.super, closest, comp_res < 0, node); \
+    }                                                                           \
+                                                                                \
+    ccntr_spinlock_unlock(&self->super.super.lock);                             \
+                                                                                \
+    if( replaced )                                                              \
+    {                                                                           \
+        ccntr_man_map_release_key_value(&self->super, key_old, value_old);      \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_erase(clsname##_t *self, clsname##_iter_t *pos)                  \
+{                                                                               \
+    ccntr_man_map_erase(&self->super, &pos->super);                             \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_erase_by_key(clsname##_t *self, const keytype key)               \
+{                                                                               \
+    void *key_old   = NULL;                                                     \
+    void *value_old = NULL;                                                     \
+                                                                                \
+    ccntr_spinlock_lock(&self->super.super.lock);                               \
+                                                                                \
+    ccntr_map_node_t *node = clsname##_find_match_without_lock(self, key);      \
+    if( node )                                                                  \
+    {                                                                           \
+        ccntr_map_unlink_without_lock(&self->super.super, node);                \
+        ccntr_man_map_release_node_without_lock(&self->super, node, &key_old, &value_old); \
+    }                                                                           \
+                                                                                \
+    ccntr_spinlock_unlock(&self->super.super.lock);                             \
+                                                                                \
+    if( node )                                                                  \
+    {                                                                           \
+        ccntr_man_map_release_key_value(&self->super, key_old, value_old);      \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void clsname##_clear(clsname##_t *self)                                         \
+{                                                                               \
+    ccntr_man_map_clear(&self->super);                                          \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+valtype clsname##_pop(clsname##_t *self, clsname##_iter_t *pos)                 \
+{                                                                               \
+    return (valtype) ccntr_man_map_pop(&self->super, &pos->super);              \
+}
+
+#endif  // CCNTR_MAN_MAP_ENABLED
+
+#endif
@@ -12,6 +12,40 @@
 
 #ifdef CCNTR_MAN_MAP_ENABLED
 
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+
+#define CCNTR_DECLARE_MAP_ORDER_STATISTICS(clsname, keytype)                    \
+                                                                                \
+static inline                                                                   \
+clsname##_iter_t clsname##_select(clsname##_t *self, unsigned index)            \
+{                                                                               \
+    return clsname##_iter_init(ccntr_man_map_select(&self->super, index));      \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+clsname##_citer_t clsname##_select_c(const clsname##_t *self, unsigned index)   \
+{                                                                               \
+    return clsname##_citer_init(ccntr_man_map_select_c(&self->super, index));   \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+unsigned clsname##_rank(const clsname##_t *self, const keytype key)             \
+{                                                                               \
+    return ccntr_man_map_rank(&self->super, (const void*)key);                  \
+}
+
+#else
+
+#define CCNTR_DECLARE_MAP_ORDER_STATISTICS(clsname, keytype)
+
+#endif
+
+/*
+ * Declare a key map class with keys of keytype and values of valtype.
+ *
+ * The storage returned by find_or_insert is the (void*) storage of the element,
+ * and is not casted to valtype, because valtype may not be a pointer type.
+ */
 #define CCNTR_DECLARE_MAP(clsname, keytype, valtype, compare, release_key, release_value) \
                                                                                 \
                                                                                 \
@@ -249,6 +283,20 @@ void clsname##_insert(clsname##_t *self, keytype key, valtype value)
 }                                                                               \
                                                                                 \
 static inline                                                                   \
+bool clsname##_upsert(clsname##_t *self, keytype key, valtype value)            \
+{                                                                               \
+    return ccntr_man_map_upsert(&self->super, (void*)key, (void*)value);        \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+void** clsname##_find_or_insert(clsname##_t *self,                              \
+                                keytype      key,                               \
+                                bool        *inserted)                          \
+{                                                                               \
+    return ccntr_man_map_find_or_insert(&self->super, (void*)key, inserted);    \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
 void clsname##_erase(clsname##_t *self, clsname##_iter_t *pos)                  \
 {                                                                               \
     ccntr_man_map_erase(&self->super, &pos->super);                             \
@@ -261,6 +309,26 @@ void clsname##_erase_by_key(clsname##_t *self, const keytype key)
 }                                                                               \
                                                                                 \
 static inline                                                                   \
+unsigned clsname##_erase_range(clsname##_t   *self,                             \
+                               const keytype  lower,                            \
+                               const keytype  upper)                            \
+{                                                                               \
+    return ccntr_man_map_erase_range(&self->super,                              \
+                                     (const void*)lower,                        \
+                                     (const void*)upper);                       \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
+unsigned clsname##_count_range(const clsname##_t *self,                         \
+                               const keytype      lower,                        \
+                               const keytype      upper)                        \
+{                                                                               \
+    return ccntr_man_map_count_range(&self->super,                              \
+                                     (const void*)lower,                        \
+                                     (const void*)upper);                       \
+}                                                                               \
+                                                                                \
+static inline                                                                   \
 void clsname##_clear(clsname##_t *self)                                         \
 {                                                                               \
     ccntr_man_map_clear(&self->super);                                          \
@@ -270,7 +338,9 @@ static inline
 valtype clsname##_pop(clsname##_t *self, clsname##_iter_t *pos)                 \
 {                                                                               \
     return (valtype) ccntr_man_map_pop(&self->super, &pos->super);              \
-}
+}                                                                               \
+                                                                                \
+CCNTR_DECLARE_MAP_ORDER_STATISTICS(clsname, keytype)
 
 #endif  // CCNTR_MAN_MAP_ENABLED
 
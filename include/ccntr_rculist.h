@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @brief     Container: read-mostly linked list with lock-free traversal.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_RCULIST_H_
+#define _CCNTR_RCULIST_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "ccntr_spinlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @class ccntr_rculist_node_t
+ * @brief Node of read-mostly linked list.
+ */
+typedef struct ccntr_rculist_node_t
+{
+    struct ccntr_rculist_node_t *prev;  ///< The previous node. READ ONLY for user, and for writers only!
+    struct ccntr_rculist_node_t *next;  ///< The next node. READ ONLY for user!
+} ccntr_rculist_node_t;
+
+ccntr_rculist_node_t* ccntr_rculist_node_get_next(ccntr_rculist_node_t *self);
+
+static inline
+const ccntr_rculist_node_t* ccntr_rculist_node_get_next_c(const ccntr_rculist_node_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_node_t
+     * @brief Get the next node.
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    return ccntr_rculist_node_get_next((ccntr_rculist_node_t*)self);
+}
+
+/**
+ * @class ccntr_rculist_t
+ * @brief Read-mostly linked list.
+ * @details Readers traverse the list forward without any locks or atomic writes,
+ *          and writers are serialised by a lock and
+ *          publish the modifications with release stores
+ *          (the read-copy-update style).
+ *
+ * @attention
+ * A node which is just unlinked may still be visited by concurrent readers
+ * (and readers can still move to the next node from it),
+ * so that it must not be released (or reused) until all readers
+ * which started before the unlinking have finished
+ * (ccntr_epoch_t can be used to do that).
+ */
+typedef struct ccntr_rculist_t
+{
+    ccntr_rculist_node_t *first;
+    ccntr_rculist_node_t *last;
+    unsigned              count;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+} ccntr_rculist_t;
+
+static inline
+void ccntr_rculist_init(ccntr_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Constructor.
+     *
+     * @param self Object instance.
+     */
+    self->first = NULL;
+    self->last  = NULL;
+    self->count = 0;
+
+    ccntr_spinlock_init(&self->lock);
+}
+
+unsigned ccntr_rculist_get_count(const ccntr_rculist_t *self);
+
+ccntr_rculist_node_t* ccntr_rculist_get_first(ccntr_rculist_t *self);
+
+static inline
+const ccntr_rculist_node_t* ccntr_rculist_get_first_c(const ccntr_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Get the first node.
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     */
+    return ccntr_rculist_get_first((ccntr_rculist_t*)self);
+}
+
+void ccntr_rculist_link  (ccntr_rculist_t *self, ccntr_rculist_node_t *pos, ccntr_rculist_node_t *node);
+bool ccntr_rculist_unlink(ccntr_rculist_t *self, ccntr_rculist_node_t *node);
+
+void ccntr_rculist_link_first(ccntr_rculist_t *self, ccntr_rculist_node_t *node);
+
+static inline
+void ccntr_rculist_link_last(ccntr_rculist_t *self, ccntr_rculist_node_t *node)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Link a node to be the last one.
+     *
+     * @param self Object instance.
+     * @param node The node to be linked.
+     */
+    ccntr_rculist_link(self, NULL, node);
+}
+
+ccntr_rculist_node_t* ccntr_rculist_discard_all(ccntr_rculist_t *self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @brief     Container: sharded key map.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_SHARDED_MAP_H_
+#define _CCNTR_SHARDED_MAP_H_
+
+#include <stddef.h>
+#include "ccntr_config.h"
+#include "ccntr_spinlock.h"
+#include "ccntr_map.h"
+#include "ccntr_hash.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CCNTR_SHARDED_MAP_ENABLED
+
+#define CCNTR_SHARDED_MAP_CACHE_LINE_SIZE   64
+#define CCNTR_SHARDED_MAP_DEFAULT_SHARDS    16
+#define CCNTR_SHARDED_MAP_MAX_SHARDS        65536
+
+/**
+ * @class ccntr_sharded_map_shard_t
+ * @brief Shard of sharded key map.
+ * @details Each shard is padded to cache line size,
+ *          so that locks of shards will not share cache lines.
+ */
+typedef union ccntr_sharded_map_shard_t
+{
+    ccntr_map_t map;
+
+    unsigned char padding[ ( sizeof(ccntr_map_t) + CCNTR_SHARDED_MAP_CACHE_LINE_SIZE - 1 ) /
+                           CCNTR_SHARDED_MAP_CACHE_LINE_SIZE *
+                           CCNTR_SHARDED_MAP_CACHE_LINE_SIZE ];
+
+} ccntr_sharded_map_shard_t;
+
+/**
+ * @class ccntr_sharded_map_t
+ * @brief Sharded key map container.
+ * @details Nodes are distributed to independent key maps by hash values of keys,
+ *          and each key map has its own lock,
+ *          so that writers on different shards will not contend with each other.
+ *          Nodes are sorted in each shard only,
+ *          and the ordered scan (ccntr_sharded_map_scan_t) merges all shards
+ *          for visiting nodes in global order.
+ *
+ * @remarks Nodes of this container are the same as the key map (ccntr_map_node_t).
+ */
+typedef struct ccntr_sharded_map_t
+{
+    ccntr_sharded_map_shard_t *shards;          // Shards aligned to cache lines.
+    void                      *shards_buffer;   // The allocated buffer of shards.
+    unsigned                   shard_count;     // Count of shards, and is a power of two.
+
+    ccntr_hash_hash_key_t hash;
+
+} ccntr_sharded_map_t;
+
+void ccntr_sharded_map_init(ccntr_sharded_map_t     *self,
+                            ccntr_map_compare_keys_t compare,
+                            ccntr_hash_hash_key_t    hash,
+                            unsigned                 shard_count);
+void ccntr_sharded_map_destroy(ccntr_sharded_map_t *self);
+
+static inline
+unsigned ccntr_sharded_map_get_shard_count(const ccntr_sharded_map_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Get count of shards.
+     *
+     * @param self Object instance.
+     * @return The count of shards.
+     */
+    return self->shard_count;
+}
+
+unsigned ccntr_sharded_map_get_count(const ccntr_sharded_map_t *self);
+
+ccntr_map_node_t* ccntr_sharded_map_find(ccntr_sharded_map_t *self, const void *key);
+
+static inline
+const ccntr_map_node_t* ccntr_sharded_map_find_c(const ccntr_sharded_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_sharded_map_find((ccntr_sharded_map_t*)self, key);
+}
+
+ccntr_map_node_t* ccntr_sharded_map_link(ccntr_sharded_map_t *self, ccntr_map_node_t *node);
+void ccntr_sharded_map_unlink(ccntr_sharded_map_t *self, ccntr_map_node_t *node);
+ccntr_map_node_t* ccntr_sharded_map_unlink_by_key(ccntr_sharded_map_t *self, const void *key);
+
+void ccntr_sharded_map_discard_all(ccntr_sharded_map_t *self);
+
+/**
+ * @class ccntr_sharded_map_scan_t
+ * @brief Ordered scan of sharded key map.
+ * @details The scan merges nodes of all shards by a heap of the current nodes,
+ *          and visit nodes from the smaller key to the larger.
+ *
+ * @attention The scan does not hold locks of shards,
+ *            and the container must not be modified during the scan.
+ */
+typedef struct ccntr_sharded_map_scan_t
+{
+    ccntr_map_node_t       **heap;  // The current node of each shard, and the smallest is on the top.
+    unsigned                 count;
+    ccntr_map_compare_keys_t compare;
+} ccntr_sharded_map_scan_t;
+
+void ccntr_sharded_map_scan_init(ccntr_sharded_map_scan_t *self, ccntr_sharded_map_t *container);
+void ccntr_sharded_map_scan_destroy(ccntr_sharded_map_scan_t *self);
+
+ccntr_map_node_t* ccntr_sharded_map_scan_get_next(ccntr_sharded_map_scan_t *self);
+
+#endif  // CCNTR_SHARDED_MAP_ENABLED
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @brief     Container: concurrent skip list key map.
+ * @author    王文佑
+ * @date      2026/10/19
+ * @copyright ZLib Licence
+ */
+#ifndef _CCNTR_SKIPMAP_H_
+#define _CCNTR_SKIPMAP_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "ccntr_spinlock.h"
+#include "ccntr_map.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The maximum level of skip list nodes.
+ */
+#define CCNTR_SKIPMAP_MAX_LEVEL 16
+
+/**
+ * @class ccntr_skipmap_node_t
+ * @brief Node of skip list key map.
+ */
+typedef struct ccntr_skipmap_node_t
+{
+    /**
+     * Key of the node.
+     *
+     * @attention:
+     * The @a key member need to be set and managed by user manually,
+     * but do not modify it when the node is linked in a container.
+     */
+    void *key;
+
+    // All the following members are READ ONLY for user!
+
+    unsigned char level;
+    unsigned char marked;
+    unsigned char fully_linked;
+
+    CCNTR_DECLARE_SPINLOCK(lock);
+
+    struct ccntr_skipmap_node_t *next[CCNTR_SKIPMAP_MAX_LEVEL];
+
+} ccntr_skipmap_node_t;
+
+ccntr_skipmap_node_t* ccntr_skipmap_node_get_next(ccntr_skipmap_node_t *self);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_node_get_next_c(const ccntr_skipmap_node_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_node_t
+     * @brief Get the next node (in order).
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    return ccntr_skipmap_node_get_next((ccntr_skipmap_node_t*)self);
+}
+
+/**
+ * @class ccntr_skipmap_t
+ * @brief Concurrent skip list key map container.
+ * @details This container offers the same search semantics as ccntr_map_t,
+ *          but nodes are linked and unlinked with per-node locks,
+ *          and searches are done without any locks,
+ *          so that writers with different keys can work in parallel.
+ *
+ * @attention
+ * A node which is just unlinked may still be visited by concurrent readers,
+ * so that it must not be released (or reused) until all readers
+ * which started before the unlinking have finished
+ * (ccntr_epoch_t can be used to do that).
+ */
+typedef struct ccntr_skipmap_t
+{
+    ccntr_skipmap_node_t head;
+    unsigned             count;
+
+    ccntr_map_compare_keys_t compare;
+
+} ccntr_skipmap_t;
+
+void ccntr_skipmap_init(ccntr_skipmap_t *self, ccntr_map_compare_keys_t compare);
+
+unsigned ccntr_skipmap_get_count(const ccntr_skipmap_t *self);
+
+ccntr_skipmap_node_t* ccntr_skipmap_get_first(ccntr_skipmap_t *self);
+ccntr_skipmap_node_t* ccntr_skipmap_get_last(ccntr_skipmap_t *self);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_get_first_c(const ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the first node (in order).
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     */
+    return ccntr_skipmap_get_first((ccntr_skipmap_t*)self);
+}
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_get_last_c(const ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the last node (in order).
+     *
+     * @param self Object instance.
+     * @return The last node; or NULL if no any nodes contained.
+     */
+    return ccntr_skipmap_get_last((ccntr_skipmap_t*)self);
+}
+
+ccntr_skipmap_node_t* ccntr_skipmap_get_prev(ccntr_skipmap_t *self, const ccntr_skipmap_node_t *node);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_get_prev_c(const ccntr_skipmap_t      *self,
+                                                     const ccntr_skipmap_node_t *node)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the previous node (in order) of a specific node.
+     *
+     * @param self Object instance.
+     * @param node A node in the container.
+     * @return The previous node; or NULL if there does not have the previous node.
+     */
+    return ccntr_skipmap_get_prev((ccntr_skipmap_t*)self, node);
+}
+
+ccntr_skipmap_node_t* ccntr_skipmap_find(ccntr_skipmap_t *self, const void *key);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_find_c(const ccntr_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_skipmap_find((ccntr_skipmap_t*)self, key);
+}
+
+ccntr_skipmap_node_t* ccntr_skipmap_find_nearest_less(ccntr_skipmap_t *self, const void *key);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_find_nearest_less_c(const ccntr_skipmap_t *self,
+                                                              const void            *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find nearest node which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_skipmap_find_nearest_less((ccntr_skipmap_t*)self, key);
+}
+
+ccntr_skipmap_node_t* ccntr_skipmap_find_nearest_great(ccntr_skipmap_t *self, const void *key);
+
+static inline
+const ccntr_skipmap_node_t* ccntr_skipmap_find_nearest_great_c(const ccntr_skipmap_t *self,
+                                                               const void            *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find nearest node which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_skipmap_find_nearest_great((ccntr_skipmap_t*)self, key);
+}
+
+ccntr_skipmap_node_t* ccntr_skipmap_link(ccntr_skipmap_t *self, ccntr_skipmap_node_t *node);
+bool ccntr_skipmap_unlink(ccntr_skipmap_t *self, ccntr_skipmap_node_t *node);
+ccntr_skipmap_node_t* ccntr_skipmap_unlink_by_key(ccntr_skipmap_t *self, const void *key);
+
+void ccntr_skipmap_discard_all(ccntr_skipmap_t *self);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
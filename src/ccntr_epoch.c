@@ -0,0 +1,177 @@
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "ccntr_epoch.h"
+
+#define ATOMIC_UINT(var) ( (atomic_uint*) &(var) )
+
+typedef ccntr_epoch_node_t node_t;
+
+//------------------------------------------------------------------------------
+static
+void release_nodes(node_t *node)
+{
+    while( node )
+    {
+        node_t *next = node->next;
+        node->release(node);
+        node = next;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_epoch_init(ccntr_epoch_t *self)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Constructor.
+     *
+     * @param self Object instance.
+     */
+    atomic_init(ATOMIC_UINT(self->current), 0);
+    atomic_init(ATOMIC_UINT(self->readers[0]), 0);
+    atomic_init(ATOMIC_UINT(self->readers[1]), 0);
+
+    self->retired = NULL;
+    self->waiting = NULL;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_epoch_destroy(ccntr_epoch_t *self)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Destructor.
+     * @details All retired objects will be released.
+     *
+     * @param self Object instance.
+     *
+     * @attention There must have no readers when the object be destructed.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *waiting = self->waiting;
+    node_t *retired = self->retired;
+    self->waiting = NULL;
+    self->retired = NULL;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    release_nodes(waiting);
+    release_nodes(retired);
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_epoch_read_lock(ccntr_epoch_t *self)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Enter a read section.
+     * @details Objects which are reachable in the read section
+     *          will not be released until the section be left.
+     *
+     * @param self Object instance.
+     * @return A ticket to be passed to ccntr_epoch_t::ccntr_epoch_read_unlock.
+     *
+     * @remarks Read sections can be nested, and will not block each other.
+     */
+    while( true )
+    {
+        unsigned epoch  = atomic_load(ATOMIC_UINT(self->current));
+        unsigned ticket = epoch & 1;
+
+        atomic_fetch_add(ATOMIC_UINT(self->readers[ticket]), 1);
+
+        // Retry if the epoch was changed before we be counted.
+        if( epoch == atomic_load(ATOMIC_UINT(self->current)) )
+            return ticket;
+
+        atomic_fetch_sub(ATOMIC_UINT(self->readers[ticket]), 1);
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_epoch_read_unlock(ccntr_epoch_t *self, unsigned ticket)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Leave a read section.
+     *
+     * @param self   Object instance.
+     * @param ticket The ticket returned by ccntr_epoch_t::ccntr_epoch_read_lock.
+     */
+    atomic_fetch_sub(ATOMIC_UINT(self->readers[ticket & 1]), 1);
+}
+//------------------------------------------------------------------------------
+static
+node_t* reclaim_without_lock(ccntr_epoch_t *self)
+{
+    // Return nodes which can be released.
+
+    unsigned epoch = atomic_load(ATOMIC_UINT(self->current));
+    unsigned prev  = ( epoch - 1 ) & 1;
+
+    // Readers of the previous epoch may still access the waiting nodes.
+    if( atomic_load(ATOMIC_UINT(self->readers[prev])) )
+        return NULL;
+
+    node_t *expired = self->waiting;
+    self->waiting = NULL;
+
+    // Start a new epoch, so that readers of the current epoch can be waited.
+    if( self->retired )
+    {
+        self->waiting = self->retired;
+        self->retired = NULL;
+        atomic_store(ATOMIC_UINT(self->current), epoch + 1);
+    }
+
+    return expired;
+}
+//------------------------------------------------------------------------------
+void ccntr_epoch_retire(ccntr_epoch_t *self, node_t *node, ccntr_epoch_release_t release)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Retire an object.
+     * @details The object will be released (by @a release) after the grace period,
+     *          that is all readers which entered before this call have left.
+     *
+     * @param self    Object instance.
+     * @param node    The node of the object to be retired,
+     *                and the object must not be reachable by new readers.
+     * @param release Callback to release the object.
+     *
+     * @remarks Expired objects will be released in this function,
+     *          so that this function must not be called in a read section
+     *          if the release callback need to enter a read section too.
+     */
+    node->release = release;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    node->next = self->retired;
+    self->retired = node;
+
+    node_t *expired = reclaim_without_lock(self);
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    release_nodes(expired);
+}
+//------------------------------------------------------------------------------
+void ccntr_epoch_reclaim(ccntr_epoch_t *self)
+{
+    /**
+     * @memberof ccntr_epoch_t
+     * @brief Try to release retired objects which have passed the grace period.
+     * @details Retired objects are also released by ccntr_epoch_t::ccntr_epoch_retire,
+     *          and this function can be used to release them without new retirements.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *expired = reclaim_without_lock(self);
+    ccntr_spinlock_unlock(&self->lock);
+
+    release_nodes(expired);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,406 @@
+#include <limits.h>
+#include <string.h>
+#include "ccntr_frozen_image.h"
+#include "frozen_layout.h"
+
+#ifdef CCNTR_FROZEN_IMAGE_ENABLED
+
+#define IMAGE_MAGIC      "CCNTRFMI"
+#define IMAGE_VERSION    1
+#define IMAGE_BYTE_ORDER 0x01020304
+#define IMAGE_ALIGNMENT  8
+
+#define ALIGN_SIZE(size) ( ( (size) + IMAGE_ALIGNMENT - 1 ) & ~(uint64_t)( IMAGE_ALIGNMENT - 1 ) )
+
+typedef ccntr_frozen_image_t       image_t;
+typedef ccntr_frozen_image_entry_t entry_t;
+
+/*
+ * All fields are in the byte order of the writer,
+ * and all offsets are from the beginning of the image.
+ */
+typedef struct header_t
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t byte_order;        // IMAGE_BYTE_ORDER in the byte order of the writer.
+    uint64_t count;
+    uint64_t keys_offset;       // int64_t[ count + 1 ] in the layout order.
+    uint64_t entries_offset;    // entry_t[ count + 1 ] in the same order of keys.
+    uint64_t heap_offset;
+    uint64_t heap_size;
+    uint64_t image_size;
+} header_t;
+
+//------------------------------------------------------------------------------
+//---- Layout ------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+unsigned image_find_great(const image_t *self, int64_t key, bool inclusive)
+{
+    // The same search as the frozen key map,
+    // but keys are compared as integers without callbacks.
+
+    const int64_t *keys  = self->keys;
+    unsigned       count = self->count;
+
+    unsigned index = 1;
+    while( index <= count )
+    {
+        PREFETCH(keys + PREFETCH_FACTOR * index);
+        int64_t curr = keys[index];
+        index = 2 * index + ( inclusive ? curr < key : curr <= key );
+    }
+
+    return layout_leave_right_path(index);
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_frozen_image_iter_move_prev(ccntr_frozen_image_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->index )
+        self->index = layout_get_prev(self->index, self->container->count);
+}
+//------------------------------------------------------------------------------
+void ccntr_frozen_image_iter_move_next(ccntr_frozen_image_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->index )
+        self->index = layout_get_next(self->index, self->container->count);
+}
+//------------------------------------------------------------------------------
+int64_t ccntr_frozen_image_iter_get_key(const ccntr_frozen_image_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator, or zero if no value be pointed.
+     */
+    return self->index ? self->container->keys[ self->index ] : 0;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_frozen_image_iter_get_value(const ccntr_frozen_image_iter_t *self, size_t *size)
+{
+    /**
+     * @memberof ccntr_frozen_image_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @param size Return size of the value in bytes, and can be NULL if not needed.
+     * @return The value be pointed by the iterator in the image;
+     *         or NULL if no value be pointed, or the value entry is out of the image.
+     */
+    if( size ) *size = 0;
+    if( !self->index ) return NULL;
+
+    const image_t *image = self->container;
+    const entry_t *entry = &image->entries[ self->index ];
+
+    // Entries are checked here instead of opening,
+    // so that pages of them will not be touched until they be used.
+    if( entry->offset > image->heap_size || entry->size > image->heap_size - entry->offset )
+        return NULL;
+
+    if( size ) *size = entry->size;
+    return image->heap + entry->offset;
+}
+//------------------------------------------------------------------------------
+//---- Write -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+#ifdef CCNTR_FROZEN_MAP_ENABLED
+static
+bool keys_are_integer_ordered(const ccntr_frozen_map_t *self)
+{
+    unsigned index = layout_get_first(self->count);
+    if( !index ) return true;
+
+    int64_t prev = (intptr_t) self->keys[index];
+    while(( index = layout_get_next(index, self->count) ))
+    {
+        int64_t curr = (intptr_t) self->keys[index];
+        if( curr <= prev ) return false;
+
+        prev = curr;
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+size_t ccntr_frozen_map_write_image(const ccntr_frozen_map_t      *self,
+                                    ccntr_frozen_image_serialise_t serialise,
+                                    void                          *buffer,
+                                    size_t                         size)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Write the container to an image.
+     *
+     * @param self      Object instance.
+     * @param serialise The callback to serialise values to the value heap,
+     *                  and can be NULL to write keys only (all values will be empty).
+     * @param buffer    The buffer to receive the image,
+     *                  and can be NULL to calculate the image size only.
+     * @param size      Size of the buffer.
+     * @return Size of the image in bytes; or ZERO if keys cannot be written,
+     *         or the size of a serialised value is changed while writing.
+     *         The image will be written only if the buffer is large enough.
+     *
+     * @remarks Keys will be written as integers,
+     *          so they must be integers which be casted to pointers,
+     *          and be sorted by their integer values (the default comparison of key maps).
+     * @attention The buffer must be aligned to 8 bytes,
+     *            and the serialisation must not write more bytes than the size it returned.
+     */
+    if( self->count > UINT_MAX / 2 || !keys_are_integer_ordered(self) ) return 0;
+
+    uint64_t heap_size = 0;
+    for(unsigned index = 1; serialise && index <= self->count; ++index)
+        heap_size += ALIGN_SIZE(serialise(self->values[index], NULL));
+
+    header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, IMAGE_MAGIC, sizeof(header.magic));
+    header.version        = IMAGE_VERSION;
+    header.byte_order     = IMAGE_BYTE_ORDER;
+    header.count          = self->count;
+    header.keys_offset    = ALIGN_SIZE(sizeof(header_t));
+    header.entries_offset = header.keys_offset + ( header.count + 1 ) * sizeof(int64_t);
+    header.heap_offset    = header.entries_offset + ( header.count + 1 ) * sizeof(entry_t);
+    header.heap_size      = heap_size;
+    header.image_size     = header.heap_offset + header.heap_size;
+
+    if( header.image_size > SIZE_MAX ) return 0;
+    if( !buffer || size < header.image_size ) return header.image_size;
+
+    unsigned char *image   = buffer;
+    int64_t       *keys    = (int64_t*)( image + header.keys_offset );
+    entry_t       *entries = (entry_t*)( image + header.entries_offset );
+    unsigned char *heap    = image + header.heap_offset;
+
+    memcpy(image, &header, sizeof(header));
+
+    keys[0]           = 0;
+    entries[0].offset = 0;
+    entries[0].size   = 0;
+
+    uint64_t offset = 0;
+    for(unsigned index = 1; index <= self->count; ++index)
+    {
+        // The size of each value is checked again before it be written,
+        // because the serialisation may be changed since the heap size be calculated.
+        size_t value_size = serialise ? serialise(self->values[index], NULL) : 0;
+        if( ALIGN_SIZE(value_size) > heap_size - offset ) return 0;
+        if( value_size && serialise(self->values[index], heap + offset) != value_size ) return 0;
+
+        size_t padding = ALIGN_SIZE(value_size) - value_size;
+        memset(heap + offset + value_size, 0, padding);
+
+        keys[index]           = (intptr_t) self->keys[index];
+        entries[index].offset = offset;
+        entries[index].size   = value_size;
+
+        offset += value_size + padding;
+    }
+
+    return header.image_size;
+}
+#endif
+//------------------------------------------------------------------------------
+//---- Frozen Key Map Image ----------------------------------------------------
+//------------------------------------------------------------------------------
+static
+bool header_is_valid(const header_t *header, size_t size)
+{
+    if( memcmp(header->magic, IMAGE_MAGIC, sizeof(header->magic)) ) return false;
+    if( header->version != IMAGE_VERSION ) return false;
+    if( header->byte_order != IMAGE_BYTE_ORDER ) return false;
+    if( header->count > UINT_MAX / 2 ) return false;
+    if( header->image_size > size ) return false;
+
+    uint64_t keys_size    = ( header->count + 1 ) * sizeof(int64_t);
+    uint64_t entries_size = ( header->count + 1 ) * sizeof(entry_t);
+
+    if( header->keys_offset    % IMAGE_ALIGNMENT ||
+        header->entries_offset % IMAGE_ALIGNMENT ||
+        header->heap_offset    % IMAGE_ALIGNMENT )
+    {
+        return false;
+    }
+
+    if( header->keys_offset    < sizeof(header_t) ||
+        header->keys_offset    > header->image_size ||
+        header->entries_offset > header->image_size ||
+        header->heap_offset    > header->image_size )
+    {
+        return false;
+    }
+
+    if( keys_size         > header->image_size - header->keys_offset ||
+        entries_size      > header->image_size - header->entries_offset ||
+        header->heap_size > header->image_size - header->heap_offset )
+    {
+        return false;
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+bool ccntr_frozen_image_open(ccntr_frozen_image_t *self, const void *data, size_t size)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Open an image.
+     *
+     * @param self Object instance.
+     * @param data The image data, such as a memory mapped file,
+     *             and it must be aligned to 8 bytes.
+     * @param size Size of the image data.
+     * @return TRUE if succeed; and FALSE if the data is not a valid image,
+     *         and the object will be an empty image in that case.
+     *
+     * @remarks Only the header be checked here, and keys and values be not touched,
+     *          so the cost of opening does not depend on the size of the image.
+     * @attention The object refers to the image data without copying,
+     *            and the data must be kept until the object be no longer used.
+     */
+    self->keys      = NULL;
+    self->entries   = NULL;
+    self->heap      = NULL;
+    self->heap_size = 0;
+    self->count     = 0;
+
+    if( !data || (uintptr_t) data % IMAGE_ALIGNMENT || size < sizeof(header_t) ) return false;
+
+    const header_t *header = data;
+    if( !header_is_valid(header, size) ) return false;
+
+    const unsigned char *image = data;
+    self->keys      = (const int64_t*)( image + header->keys_offset );
+    self->entries   = (const entry_t*)( image + header->entries_offset );
+    self->heap      = image + header->heap_offset;
+    self->heap_size = header->heap_size;
+    self->count     = header->count;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_image_iter_t ccntr_frozen_image_get_first(const ccntr_frozen_image_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_frozen_image_iter_t iter;
+    ccntr_frozen_image_iter_init(&iter, self, layout_get_first(self->count));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_image_iter_t ccntr_frozen_image_get_last(const ccntr_frozen_image_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_frozen_image_iter_t iter;
+    ccntr_frozen_image_iter_init(&iter, self, layout_get_last(self->count));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_image_iter_t ccntr_frozen_image_find(const ccntr_frozen_image_t *self, int64_t key)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    unsigned index = image_find_great(self, key, true);
+    if( index && self->keys[index] != key ) index = 0;
+
+    ccntr_frozen_image_iter_t iter;
+    ccntr_frozen_image_iter_init(&iter, self, index);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_image_iter_t ccntr_frozen_image_find_nearest_less(const ccntr_frozen_image_t *self, int64_t key)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    unsigned index = image_find_great(self, key, false);
+    index = index ? layout_get_prev(index, self->count) : layout_get_last(self->count);
+
+    ccntr_frozen_image_iter_t iter;
+    ccntr_frozen_image_iter_init(&iter, self, index);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_image_iter_t ccntr_frozen_image_find_nearest_great(const ccntr_frozen_image_t *self, int64_t key)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_frozen_image_iter_t iter;
+    ccntr_frozen_image_iter_init(&iter, self, image_find_great(self, key, true));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_frozen_image_find_value(const ccntr_frozen_image_t *self, int64_t key, size_t *size)
+{
+    /**
+     * @memberof ccntr_frozen_image_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @param size Return size of the value in bytes, and can be NULL if not needed.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_frozen_image_iter_t iter = ccntr_frozen_image_find(self, key);
+    return ccntr_frozen_image_iter_get_value(&iter, size);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_FROZEN_IMAGE_ENABLED
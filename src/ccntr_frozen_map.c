@@ -0,0 +1,317 @@
+#include <stdlib.h>
+#include "abort_message.h"
+#include "ccntr_frozen_map.h"
+#include "frozen_layout.h"
+
+#ifdef CCNTR_FROZEN_MAP_ENABLED
+
+typedef ccntr_frozen_map_t frozen_t;
+
+//------------------------------------------------------------------------------
+//---- Layout ------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+unsigned layout_find_great(const frozen_t *self, const void *key, bool inclusive)
+{
+    /*
+     * Find the first key which is greater (or equal) than the specified key.
+     * Each step goes to the left or right child by the comparison result without branches,
+     * and the path is encoded by bits of the index,
+     * so that the result is the last node which the path turned left from.
+     */
+    void *const *keys  = self->keys;
+    unsigned     count = self->count;
+    int          limit = inclusive ? 0 : 1;
+
+    unsigned index = 1;
+    while( index <= count )
+    {
+        PREFETCH(keys + PREFETCH_FACTOR * index);
+        index = 2 * index + ( self->compare(keys[index], key) < limit );
+    }
+
+    return layout_leave_right_path(index);
+}
+//------------------------------------------------------------------------------
+static
+void frozen_alloc(frozen_t *self, unsigned count, ccntr_map_compare_keys_t compare)
+{
+    self->keys   = malloc(( count + 1 ) * sizeof(void*));
+    self->values = malloc(( count + 1 ) * sizeof(void*));
+    if( !self->keys || !self->values ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    self->keys[0]   = NULL;
+    self->values[0] = NULL;
+    self->count     = count;
+    self->compare   = compare;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_frozen_map_iter_move_prev(ccntr_frozen_map_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->index )
+        self->index = layout_get_prev(self->index, self->container->count);
+}
+//------------------------------------------------------------------------------
+void ccntr_frozen_map_iter_move_next(ccntr_frozen_map_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( self->index )
+        self->index = layout_get_next(self->index, self->container->count);
+}
+//------------------------------------------------------------------------------
+void* ccntr_frozen_map_iter_get_key(const ccntr_frozen_map_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->index ? self->container->keys[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+void* ccntr_frozen_map_iter_get_value(const ccntr_frozen_map_iter_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->index ? self->container->values[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Freeze ------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_default(void *obj)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_map_freeze(ccntr_map_t *self, ccntr_frozen_map_t *frozen)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Build a frozen map from nodes of the container.
+     *
+     * @param self   Object instance.
+     * @param frozen An uninitialised frozen map to receive the result.
+     *               Keys of the frozen map are keys of nodes,
+     *               and values of the frozen map are the nodes.
+     *
+     * @attention The frozen map refers to nodes of this container,
+     *            and nodes must not be unlinked or released
+     *            until the frozen map be destroyed.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    frozen_alloc(frozen, self->count, self->compare);
+    frozen->release_key   = release_default;
+    frozen->release_value = release_default;
+
+    ccntr_map_node_t *node = self->root;
+    while( node && node->left ) node = node->left;
+
+    for(unsigned index = layout_get_first(frozen->count);
+        index;
+        index = layout_get_next(index, frozen->count))
+    {
+        frozen->keys[index]   = node->key;
+        frozen->values[index] = node;
+        node = ccntr_map_node_get_next(node);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_MAN_MAP_ENABLED
+void ccntr_man_map_freeze(ccntr_man_map_t *self, ccntr_frozen_map_t *frozen)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Move all keys and values of the container to a frozen map.
+     *
+     * @param self   Object instance.
+     * @param frozen An uninitialised frozen map to receive the result,
+     *               and it will release keys and values by
+     *               the callbacks of this container when it be destroyed.
+     *
+     * @remarks This container will be empty after freezing,
+     *          and must not be modified by other threads during freezing.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
+
+    frozen_alloc(frozen, self->super.count, self->super.compare);
+    frozen->release_key   = self->release_key;
+    frozen->release_value = self->release_value;
+
+    ccntr_map_node_t *node = self->super.root;
+    while( node && node->left ) node = node->left;
+
+    for(unsigned index = layout_get_first(frozen->count);
+        index;
+        index = layout_get_next(index, frozen->count))
+    {
+        ccntr_man_map_iter_t iter;
+        ccntr_man_map_iter_init(&iter, self, node);
+
+        frozen->keys[index]   = node->key;
+        frozen->values[index] = ccntr_man_map_iter_get_value(&iter);
+        node = ccntr_map_node_get_next(node);
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    // Keys and values are owned by the frozen map now.
+    ccntr_man_map_discard_all(self);
+}
+#endif
+//------------------------------------------------------------------------------
+//---- Frozen Key Map Container ------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_frozen_map_destroy(ccntr_frozen_map_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    for(unsigned index = 1; index <= self->count; ++index)
+    {
+        self->release_key(self->keys[index]);
+        self->release_value(self->values[index]);
+    }
+
+    free(self->keys);
+    free(self->values);
+
+    self->keys   = NULL;
+    self->values = NULL;
+    self->count  = 0;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_map_iter_t ccntr_frozen_map_get_first(const ccntr_frozen_map_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_frozen_map_iter_t iter;
+    ccntr_frozen_map_iter_init(&iter, self, layout_get_first(self->count));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_map_iter_t ccntr_frozen_map_get_last(const ccntr_frozen_map_t *self)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_frozen_map_iter_t iter;
+    ccntr_frozen_map_iter_init(&iter, self, layout_get_last(self->count));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_map_iter_t ccntr_frozen_map_find(const ccntr_frozen_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    unsigned index = layout_find_great(self, key, true);
+    if( index && self->compare(self->keys[index], key) ) index = 0;
+
+    ccntr_frozen_map_iter_t iter;
+    ccntr_frozen_map_iter_init(&iter, self, index);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_map_iter_t ccntr_frozen_map_find_nearest_less(const ccntr_frozen_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    unsigned index = layout_find_great(self, key, false);
+    index = index ? layout_get_prev(index, self->count) : layout_get_last(self->count);
+
+    ccntr_frozen_map_iter_t iter;
+    ccntr_frozen_map_iter_init(&iter, self, index);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_frozen_map_iter_t ccntr_frozen_map_find_nearest_great(const ccntr_frozen_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_frozen_map_iter_t iter;
+    ccntr_frozen_map_iter_init(&iter, self, layout_find_great(self, key, true));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void* ccntr_frozen_map_find_value(const ccntr_frozen_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_frozen_map_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_frozen_map_iter_t iter = ccntr_frozen_map_find(self, key);
+    return ccntr_frozen_map_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_FROZEN_MAP_ENABLED
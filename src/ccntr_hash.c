@@ -0,0 +1,410 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "abort_message.h"
+#include "ccntr_hash.h"
+
+#ifdef CCNTR_HASH_ENABLED
+
+typedef ccntr_hash_node_t node_t;
+
+#define TABLE_SIZE_MIN  8
+#define REHASH_STEP     4   // Count of buckets to be moved in each operation.
+
+//------------------------------------------------------------------------------
+//---- Table -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t** table_create(size_t size)
+{
+    node_t **buckets = calloc(size, sizeof(node_t*));
+    if( !buckets ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    return buckets;
+}
+//------------------------------------------------------------------------------
+static
+bool table_is_rehashing(const ccntr_hash_t *self)
+{
+    return self->buckets[1];
+}
+//------------------------------------------------------------------------------
+static
+node_t** table_get_bucket(const ccntr_hash_t *self, size_t hash)
+{
+    /*
+     * Buckets of the main table before the rehash index are moved to the new table,
+     * so that each node is placed in one determined bucket.
+     */
+    size_t index = hash & ( self->sizes[0] - 1 );
+    if( index >= self->rehash_index )
+        return &self->buckets[0][index];
+
+    return &self->buckets[1][ hash & ( self->sizes[1] - 1 ) ];
+}
+//------------------------------------------------------------------------------
+static
+void table_rehash_step(ccntr_hash_t *self)
+{
+    if( !table_is_rehashing(self) ) return;
+
+    for(unsigned step = 0; step < REHASH_STEP && self->rehash_index < self->sizes[0]; ++step)
+    {
+        node_t *node = self->buckets[0][ self->rehash_index ];
+        self->buckets[0][ self->rehash_index ] = NULL;
+        ++ self->rehash_index;
+
+        while( node )
+        {
+            node_t *next = node->next;
+
+            node_t **bucket = &self->buckets[1][ node->hash & ( self->sizes[1] - 1 ) ];
+            node->next = *bucket;
+            *bucket = node;
+
+            node = next;
+        }
+    }
+
+    if( self->rehash_index < self->sizes[0] ) return;
+
+    // All buckets are moved, and the new table becomes the main table.
+    free(self->buckets[0]);
+    self->buckets[0]    = self->buckets[1];
+    self->sizes[0]      = self->sizes[1];
+    self->buckets[1]    = NULL;
+    self->sizes[1]      = 0;
+    self->rehash_index  = 0;
+}
+//------------------------------------------------------------------------------
+static
+void table_resize_on_demand(ccntr_hash_t *self)
+{
+    if( table_is_rehashing(self) ) return;
+
+    size_t size = self->sizes[0];
+    if( self->count > size )
+        size *= 2;
+    else if( size > TABLE_SIZE_MIN && self->count < size / 8 )
+        size /= 2;
+    else
+        return;
+
+    self->buckets[1]   = table_create(size);
+    self->sizes[1]     = size;
+    self->rehash_index = 0;
+}
+//------------------------------------------------------------------------------
+static
+node_t** table_find_link_by_key(const ccntr_hash_t *self, size_t hash, const void *key)
+{
+    // Return the link which points to the found node; or NULL if not found.
+
+    if( !self->sizes[0] ) return NULL;
+
+    node_t **link = table_get_bucket(self, hash);
+    for(; *link; link = &(*link)->next)
+    {
+        node_t *node = *link;
+        if( node->hash == hash && !self->compare(node->key, key) )
+            return link;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+static
+node_t** table_find_link_by_node(const ccntr_hash_t *self, const node_t *target)
+{
+    if( !self->sizes[0] ) return NULL;
+
+    node_t **link = table_get_bucket(self, target->hash);
+    for(; *link; link = &(*link)->next)
+    {
+        if( *link == target )
+            return link;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+static
+node_t* table_find_first_from(const ccntr_hash_t *self, unsigned table, size_t index)
+{
+    for(; table < 2; ++table, index = 0)
+    {
+        for(; index < self->sizes[table]; ++index)
+        {
+            if( self->buckets[table][index] )
+                return self->buckets[table][index];
+        }
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+//---- Container ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+size_t ccntr_hash_hash_integral(const void *key)
+{
+    /**
+     * @brief Calculate hash value of a key which is treated as an integral value.
+     *
+     * @param key The key.
+     * @return The hash value, and all bits of the key are mixed into lower bits of it.
+     */
+    uint64_t value = (uintptr_t) key;
+    value ^= value >> 33;
+    value *= UINT64_C(0xFF51AFD7ED558CCD);
+    value ^= value >> 33;
+    value *= UINT64_C(0xC4CEB9FE1A85EC53);
+    value ^= value >> 33;
+
+    return (size_t) value;
+}
+//------------------------------------------------------------------------------
+static
+int compare_default(const void *key1, const void *key2)
+{
+    return key1 != key2;
+}
+//------------------------------------------------------------------------------
+void ccntr_hash_init(ccntr_hash_t *self, ccntr_hash_hash_key_t hash, ccntr_hash_compare_keys_t compare)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Constructor.
+     *
+     * @param self    Object instance.
+     * @param hash    A function to be used to calculate hash value of keys.
+     * @param compare A function to be used to compare keys.
+     *
+     * @remarks If @a hash or @a compare is NULL, then
+     *          all keys will be treated as integral values.
+     */
+    self->buckets[0]   = NULL;
+    self->buckets[1]   = NULL;
+    self->sizes[0]     = 0;
+    self->sizes[1]     = 0;
+    self->rehash_index = 0;
+    self->count        = 0;
+
+    self->hash    = hash ? hash : ccntr_hash_hash_integral;
+    self->compare = compare ? compare : compare_default;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_hash_destroy(ccntr_hash_t *self)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Destructor.
+     * @details The bucket tables will be released,
+     *          and all nodes will be discarded (but not released).
+     *
+     * @param self Object instance.
+     */
+    ccntr_hash_discard_all(self);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_hash_get_first(ccntr_hash_t *self)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Get the first node.
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     *
+     * @remarks Nodes are not sorted in any particular order.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *node = table_find_first_from(self, 0, self->rehash_index);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_hash_get_next(ccntr_hash_t *self, const node_t *node)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Get the next node of a specific node.
+     *
+     * @param self Object instance.
+     * @param node A node in the container.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    if( !node ) return NULL;
+    if( node->next ) return node->next;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    size_t index = node->hash & ( self->sizes[0] - 1 );
+    node_t *next = ( index >= self->rehash_index )?
+                   ( table_find_first_from(self, 0, index + 1) ):
+                   ( table_find_first_from(self, 1, ( node->hash & ( self->sizes[1] - 1 ) ) + 1) );
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return next;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_hash_find(ccntr_hash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    size_t hash = self->hash(key);
+
+    ccntr_spinlock_lock(&self->lock);
+    node_t **link = table_find_link_by_key(self, hash, key);
+    node_t *node = link ? *link : NULL;
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_hash_link(ccntr_hash_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Link a node into the container.
+     *
+     * @param self Object instance.
+     * @param node The new node to be linked.
+     *             If the container already have a node with the same key,
+     *             then the old node will be pop out,
+     *             and the new one will be saved.
+     * @return A node be pop out which have the same key with the new node;
+     *         or NULL if there do not have node with duplicated keys.
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            or the bahaviour is undefuned!
+     */
+    if( !node ) return NULL;
+
+    node->hash = self->hash(node->key);
+
+    ccntr_spinlock_lock(&self->lock);
+
+    if( !self->sizes[0] )
+    {
+        self->buckets[0] = table_create(TABLE_SIZE_MIN);
+        self->sizes[0]   = TABLE_SIZE_MIN;
+    }
+
+    table_rehash_step(self);
+
+    node_t *duplicated = NULL;
+    node_t **link = table_find_link_by_key(self, node->hash, node->key);
+    if( link )
+    {
+        duplicated = *link;
+        node->next = duplicated->next;
+        *link = node;
+        duplicated->next = NULL;
+    }
+    else
+    {
+        node_t **bucket = table_get_bucket(self, node->hash);
+        node->next = *bucket;
+        *bucket = node;
+
+        ++ self->count;
+        table_resize_on_demand(self);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return duplicated;
+}
+//------------------------------------------------------------------------------
+static
+void unlink_without_lock(ccntr_hash_t *self, node_t **link)
+{
+    node_t *node = *link;
+    *link = node->next;
+    node->next = NULL;
+
+    assert( self->count );
+    -- self->count;
+
+    table_rehash_step(self);
+    table_resize_on_demand(self);
+}
+//------------------------------------------------------------------------------
+void ccntr_hash_unlink(ccntr_hash_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     */
+    if( !node ) return;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t **link = table_find_link_by_node(self, node);
+    if( link ) unlink_without_lock(self, link);
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_hash_unlink_by_key(ccntr_hash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Search and unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node which just be found and unlinked;
+     *         or NULL if there does not have a node with the key.
+     */
+    size_t hash = self->hash(key);
+
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t **link = table_find_link_by_key(self, hash, key);
+    node_t *node = link ? *link : NULL;
+    if( link ) unlink_without_lock(self, link);
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+void ccntr_hash_discard_all(ccntr_hash_t *self)
+{
+    /**
+     * @memberof ccntr_hash_t
+     * @brief Discard all linkage of nodes in the container.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    free(self->buckets[0]);
+    free(self->buckets[1]);
+
+    self->buckets[0]   = NULL;
+    self->buckets[1]   = NULL;
+    self->sizes[0]     = 0;
+    self->sizes[1]     = 0;
+    self->rehash_index = 0;
+    self->count        = 0;
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_HASH_ENABLED
@@ -0,0 +1,266 @@
+#include "container_of.h"
+#include "ccntr_itree.h"
+
+#ifdef CCNTR_ITREE_ENABLED
+
+typedef ccntr_itree_node_t node_t;
+
+//------------------------------------------------------------------------------
+//---- Node --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t* node_from_map_node(const ccntr_map_node_t *node)
+{
+    return node ? container_of(node, node_t, map_node) : NULL;
+}
+//------------------------------------------------------------------------------
+static
+int compare_intervals(const void *key1, const void *key2)
+{
+    // Keys are the nodes themselves,
+    // and nodes with the same interval are ordered by their addresses.
+
+    const node_t *node1 = key1;
+    const node_t *node2 = key2;
+
+    if( node1->low  != node2->low  ) return ( node1->low  < node2->low  )?( -1 ):( 1 );
+    if( node1->high != node2->high ) return ( node1->high < node2->high )?( -1 ):( 1 );
+    // Pointers to different objects cannot be compared by relational operators,
+    // so that they are compared as integers.
+    uintptr_t addr1 = (uintptr_t) node1;
+    uintptr_t addr2 = (uintptr_t) node2;
+    if( addr1 != addr2 ) return ( addr1 < addr2 )?( -1 ):( 1 );
+
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+void augment_max(ccntr_map_node_t *map_node)
+{
+    node_t *node = node_from_map_node(map_node);
+    node->max = node->high;
+
+    const node_t *left = node_from_map_node(map_node->left);
+    if( left && node->max < left->max ) node->max = left->max;
+
+    const node_t *right = node_from_map_node(map_node->right);
+    if( right && node->max < right->max ) node->max = right->max;
+}
+//------------------------------------------------------------------------------
+ccntr_itree_node_t* ccntr_itree_node_get_next(ccntr_itree_node_t *self)
+{
+    /**
+     * @memberof ccntr_itree_node_t
+     * @brief Get the next node (in order).
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     *
+     * @remarks Nodes are ordered by low bounds, and then by high bounds.
+     */
+    return node_from_map_node(ccntr_map_node_get_next(&self->map_node));
+}
+//------------------------------------------------------------------------------
+//---- Overlap Search ----------------------------------------------------------
+//------------------------------------------------------------------------------
+/*
+ * The searching range is [low, last] (both inclusive) in this section,
+ * so that both overlap search and stabbing search can be represented.
+ * An interval overlaps the range if its low bound is not greater than the last,
+ * and its high bound is greater than the low.
+ */
+//------------------------------------------------------------------------------
+static
+node_t* subtree_find_first_overlap(const ccntr_map_node_t *map_node, int64_t low, int64_t last)
+{
+    /*
+     * Subtrees are skipped if their maximum high bounds are not greater than the low,
+     * and right subtrees are skipped if the low bound of the node is greater than the last,
+     * so that each subtree be visited either have an overlapped interval
+     * or is on the boundary path.
+     */
+    const node_t *node = node_from_map_node(map_node);
+    if( !node || node->max <= low ) return NULL;
+
+    node_t *found = subtree_find_first_overlap(map_node->left, low, last);
+    if( found ) return found;
+
+    if( node->low > last ) return NULL;
+    if( node->high > low ) return (node_t*) node;
+
+    return subtree_find_first_overlap(map_node->right, low, last);
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_find_next_overlap(const node_t *node, int64_t low, int64_t last)
+{
+    // Find the next overlapped node after a specific node in order.
+
+    node_t *found = subtree_find_first_overlap(node->map_node.right, low, last);
+    if( found ) return found;
+
+    const ccntr_map_node_t *child  = &node->map_node;
+    const ccntr_map_node_t *parent = ccntr_map_node_get_parent(child);
+    for(; parent; child = parent, parent = ccntr_map_node_get_parent(parent))
+    {
+        // Ancestors which the node is in their right subtree are visited already.
+        if( child != parent->left ) continue;
+
+        const node_t *ancestor = node_from_map_node(parent);
+        if( ancestor->low > last ) return NULL;
+        if( ancestor->high > low ) return (node_t*) ancestor;
+
+        found = subtree_find_first_overlap(parent->right, low, last);
+        if( found ) return found;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+//---- Interval Tree Container -------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_itree_init(ccntr_itree_t *self)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Constructor.
+     *
+     * @param self Object instance.
+     */
+    ccntr_map_init(&self->super, compare_intervals);
+    ccntr_map_set_augment(&self->super, augment_max);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_itree_get_first(ccntr_itree_t *self)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Get the first node (in order).
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     */
+    return node_from_map_node(ccntr_map_get_first(&self->super));
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_itree_find_first_overlap(ccntr_itree_t *self, int64_t low, int64_t high)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Find the first node (in order) which overlaps a range.
+     *
+     * @param self Object instance.
+     * @param low  The low bound of the range (inclusive).
+     * @param high The high bound of the range (exclusive).
+     * @return The node if found; and NULL if not found.
+     *
+     * @remarks Subtrees without overlapped intervals are skipped,
+     *          so that enumerating all the k overlapped nodes
+     *          (with ccntr_itree_t::ccntr_itree_find_next_overlap)
+     *          costs logarithmic time plus the cost proportional to k
+     *          in common cases, and O(k log n) at worst.
+     */
+    if( low >= high ) return NULL;
+
+    ccntr_spinlock_lock(&self->super.lock);
+    node_t *node = subtree_find_first_overlap(self->super.root, low, high - 1);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_itree_find_next_overlap(ccntr_itree_t *self, node_t *node, int64_t low, int64_t high)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Find the next node (in order) which overlaps a range.
+     *
+     * @param self Object instance.
+     * @param node The current node which is linked in the container.
+     * @param low  The low bound of the range (inclusive).
+     * @param high The high bound of the range (exclusive).
+     * @return The node if found; and NULL if not found.
+     */
+    if( !node || low >= high ) return NULL;
+
+    ccntr_spinlock_lock(&self->super.lock);
+    node = tree_find_next_overlap(node, low, high - 1);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_itree_find_first_stab(ccntr_itree_t *self, int64_t point)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Find the first node (in order) which contains a point.
+     *
+     * @param self  Object instance.
+     * @param point The point to be searched.
+     * @return The node if found; and NULL if not found.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
+    node_t *node = subtree_find_first_overlap(self->super.root, point, point);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_itree_find_next_stab(ccntr_itree_t *self, node_t *node, int64_t point)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Find the next node (in order) which contains a point.
+     *
+     * @param self  Object instance.
+     * @param node  The current node which is linked in the container.
+     * @param point The point to be searched.
+     * @return The node if found; and NULL if not found.
+     */
+    if( !node ) return NULL;
+
+    ccntr_spinlock_lock(&self->super.lock);
+    node = tree_find_next_overlap(node, point, point);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+void ccntr_itree_link(ccntr_itree_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Link a node into the container.
+     *
+     * @param self Object instance.
+     * @param node The new node to be linked,
+     *             and its bounds must be set (ccntr_itree_node_t::ccntr_itree_node_init).
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            or the bahaviour is undefuned!
+     */
+    if( !node ) return;
+
+    node->map_node.key = node;
+    ccntr_map_link(&self->super, &node->map_node);
+}
+//------------------------------------------------------------------------------
+void ccntr_itree_unlink(ccntr_itree_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_itree_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     *
+     * @attention The node to be unlinkd must be a member of this container,
+     *            or the behaviour is undefuned!
+     */
+    if( !node ) return;
+    ccntr_map_unlink(&self->super, &node->map_node);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_ITREE_ENABLED
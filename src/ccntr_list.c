@@ -73,3 +73,115 @@ void ccntr_list_unlink(ccntr_list_t *self, node_t *node)
     node->next = NULL;
 }
 //------------------------------------------------------------------------------
+static
+node_t* sort_split_chain(node_t *head, unsigned count)
+{
+    // Cut the chain after the first @a count nodes, and return the rest part.
+    for(unsigned i = 1; head && i < count; ++i)
+        head = head->next;
+
+    if( !head ) return NULL;
+
+    node_t *rest = head->next;
+    head->next = NULL;
+
+    return rest;
+}
+//------------------------------------------------------------------------------
+static
+node_t* sort_merge_chains(node_t                     *left,
+                          node_t                     *right,
+                          ccntr_list_compare_nodes_t  compare,
+                          void                       *arg,
+                          node_t                    **tail)
+{
+    node_t  head = {0};
+    node_t *last = &head;
+
+    while( left && right )
+    {
+        // Take from the left chain on equivalent nodes to keep the sort stable.
+        if( compare(left, right, arg) <= 0 )
+        {
+            last->next = left;
+            left = left->next;
+        }
+        else
+        {
+            last->next = right;
+            right = right->next;
+        }
+
+        last = last->next;
+    }
+
+    last->next = left ? left : right;
+    while( last->next )
+        last = last->next;
+
+    *tail = last;
+    return head.next;
+}
+//------------------------------------------------------------------------------
+void ccntr_list_sort(ccntr_list_t *self, ccntr_list_compare_nodes_t compare, void *arg)
+{
+    /**
+     * @memberof ccntr_list_t
+     * @brief Sort nodes.
+     * @details Nodes will be re-linked in place by a stable bottom-up merge sort,
+     *          which takes O(n log n) time and O(1) extra memory.
+     *
+     * @param self    Object instance.
+     * @param compare A function to be used to compare nodes.
+     * @param arg     An user defined argument to be passed to @a compare.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *head = self->first;
+    if( self->count < 2 ) head = NULL;
+
+    // Merge chains with doubled width each pass, linked by the next pointer only.
+    for(unsigned width = 1; head; width *= 2)
+    {
+        node_t  *rest   = head;
+        node_t  *tail   = NULL;
+        unsigned merges = 0;
+
+        head = NULL;
+        while( rest )
+        {
+            node_t *left  = rest;
+            node_t *right = sort_split_chain(left, width);
+            rest = sort_split_chain(right, width);
+
+            node_t *merged_tail;
+            node_t *merged = sort_merge_chains(left, right, compare, arg, &merged_tail);
+
+            if( tail )
+                tail->next = merged;
+            else
+                head = merged;
+
+            tail = merged_tail;
+            ++ merges;
+        }
+
+        if( merges < 2 )
+        {
+            // Rebuild the backward links.
+            node_t *prev = NULL;
+            for(node_t *node = head; node; node = node->next)
+            {
+                node->prev = prev;
+                prev = node;
+            }
+
+            self->first = head;
+            self->last  = prev;
+            break;
+        }
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
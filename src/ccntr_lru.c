@@ -0,0 +1,302 @@
+#include <assert.h>
+#include "container_of.h"
+#include "ccntr_lru.h"
+
+typedef ccntr_lru_node_t node_t;
+
+//------------------------------------------------------------------------------
+//---- Node Convertion ---------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t* node_from_map_node(ccntr_map_node_t *node)
+{
+    return node ? container_of(node, node_t, map_node) : NULL;
+}
+//------------------------------------------------------------------------------
+static
+node_t* node_from_list_node(ccntr_list_node_t *node)
+{
+    return node ? container_of(node, node_t, list_node) : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Node Iterate ------------------------------------------------------------
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_node_get_older(node_t *self)
+{
+    /**
+     * @memberof ccntr_lru_node_t
+     * @brief Get the next node which is less recently used.
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    return node_from_list_node(self->list_node.next);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_node_get_newer(node_t *self)
+{
+    /**
+     * @memberof ccntr_lru_node_t
+     * @brief Get the previous node which is more recently used.
+     *
+     * @param self Object instance.
+     * @return The previous node; or NULL if there does not have the previous node.
+     */
+    return node_from_list_node(self->list_node.prev);
+}
+//------------------------------------------------------------------------------
+//---- Container ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_lru_init(ccntr_lru_t *self, ccntr_map_compare_keys_t compare, size_t capacity)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Constructor.
+     *
+     * @param self     Object instance.
+     * @param compare  A function to be used to compare keys.
+     *                 If this parameter is NULL, then
+     *                 all keys will be treated as integral values.
+     * @param capacity The maximum total weight of nodes;
+     *                 or ZERO to be unlimited.
+     */
+    static const ccntr_lru_stats_t stats0 = {0};
+
+    ccntr_map_init(&self->map, compare);
+    ccntr_list_init(&self->list);
+
+    self->capacity = capacity;
+    self->weight   = 0;
+    self->stats    = stats0;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_get_newest(ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get the most recently used node.
+     *
+     * @param self Object instance.
+     * @return The node; or NULL if no any nodes contained.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *node = node_from_list_node(ccntr_list_get_first(&self->list));
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_get_oldest(ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Get the least recently used node.
+     *
+     * @param self Object instance.
+     * @return The node; or NULL if no any nodes contained.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *node = node_from_list_node(ccntr_list_get_last(&self->list));
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_find(ccntr_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Find node by key.
+     * @details The node will be marked as the most recently used if found,
+     *          and the hit or miss statistics will be updated.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *node = node_from_map_node(ccntr_map_find(&self->map, key));
+    if( node )
+    {
+        ++ self->stats.hits;
+
+        if( node->list_node.prev )
+        {
+            ccntr_list_unlink(&self->list, &node->list_node);
+            ccntr_list_link_first(&self->list, &node->list_node);
+        }
+    }
+    else
+    {
+        ++ self->stats.misses;
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_peek(ccntr_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Find node by key without touch it.
+     * @details Similarly to ccntr_lru_t::ccntr_lru_find,
+     *          but the recently used order and statistics will not be changed.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *node = node_from_map_node(ccntr_map_find(&self->map, key));
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+void unlink_without_lock(ccntr_lru_t *self, node_t *node)
+{
+    ccntr_map_unlink(&self->map, &node->map_node);
+    ccntr_list_unlink(&self->list, &node->list_node);
+
+    assert( self->weight >= node->weight );
+    self->weight -= node->weight;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_link(ccntr_lru_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Link a node into the container as the most recently used one.
+     *
+     * @param self Object instance.
+     * @param node The new node to be linked.
+     *             If the container already have a node with the same key,
+     *             then the old node will be pop out,
+     *             and the new one will be saved.
+     * @return A node be pop out which have the same key with the new node;
+     *         or NULL if there do not have node with duplicated keys.
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            or the bahaviour is undefuned!
+     *
+     * @remarks Nodes will not be evicted by this function even if
+     *          the total weight exceeds the capacity,
+     *          and please use ccntr_lru_t::ccntr_lru_unlink_overflow to evict nodes.
+     */
+    if( !node ) return NULL;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *duplicated = node_from_map_node(ccntr_map_link(&self->map, &node->map_node));
+    if( duplicated )
+    {
+        ccntr_list_unlink(&self->list, &duplicated->list_node);
+
+        assert( self->weight >= duplicated->weight );
+        self->weight -= duplicated->weight;
+    }
+
+    ccntr_list_link_first(&self->list, &node->list_node);
+    self->weight += node->weight;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return duplicated;
+}
+//------------------------------------------------------------------------------
+void ccntr_lru_unlink(ccntr_lru_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     *
+     * @attention The node to be unlinkd must be a member of this container,
+     *            or the behaviour is undefuned!
+     */
+    if( !node ) return;
+
+    ccntr_spinlock_lock(&self->lock);
+    unlink_without_lock(self, node);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_unlink_by_key(ccntr_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Search and unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node which just be found and unlinked;
+     *         or NULL if there does not have a node with the key.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *node = node_from_map_node(ccntr_map_find(&self->map, key));
+    if( node ) unlink_without_lock(self, node);
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_lru_unlink_overflow(ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Evict a node if the total weight exceeds the capacity.
+     * @details The least recently used node will be unlinked
+     *          if the total weight exceeds the capacity,
+     *          and the eviction statistics will be updated.
+     *          User can call this function repeatedly until it returns NULL
+     *          to evict all overflowed nodes.
+     *
+     * @param self Object instance.
+     * @return The node which just be evicted;
+     *         or NULL if the total weight does not exceed the capacity.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *node = NULL;
+    if( self->capacity && self->weight > self->capacity )
+    {
+        node = node_from_list_node(ccntr_list_get_last(&self->list));
+        if( node )
+        {
+            unlink_without_lock(self, node);
+            ++ self->stats.evictions;
+        }
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+void ccntr_lru_discard_all(ccntr_lru_t *self)
+{
+    /**
+     * @memberof ccntr_lru_t
+     * @brief Discard all linkage of nodes in the container.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    ccntr_map_discard_all(&self->map);
+    ccntr_list_discard_all(&self->list);
+    self->weight = 0;
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,990 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "abort_message.h"
+#include "ccntr_man_art.h"
+
+#ifdef CCNTR_MAN_ART_ENABLED
+
+/*
+ * Keys are converted to unsigned words by flipping the sign bit,
+ * so that the order of words is the same as the order of signed keys,
+ * and bytes of words are dispatched from the most significant one.
+ */
+typedef uintptr_t word_t;
+
+#define KEY_BYTES   ( (unsigned) sizeof(word_t) )
+#define SIGN_BIT    ( ~(word_t) 0 / 2 + 1 )
+
+enum
+{
+    NODE_LEAF,
+    NODE_4,
+    NODE_16,
+    NODE_48,
+    NODE_256,
+};
+
+typedef struct ccntr_man_art_node_t
+{
+    word_t   prefix;    // Bytes before the depth (and zeros for others), or the whole key of leaves.
+    uint16_t count;     // Children count of inner nodes.
+    uint8_t  depth;     // Index of the byte dispatched by inner nodes, or KEY_BYTES for leaves.
+    uint8_t  type;
+} node_t;
+
+typedef struct ccntr_man_art_leaf_t
+{
+    node_t  header;
+    void   *value;
+} leaf_t;
+
+typedef struct node4_t
+{
+    node_t   header;
+    uint8_t  keys[4];                       // Sorted bytes of children.
+    node_t  *children[4];
+} node4_t;
+
+typedef struct node16_t
+{
+    node_t   header;
+    uint8_t  keys[16];                      // Sorted bytes of children.
+    node_t  *children[16];
+} node16_t;
+
+typedef struct node48_t
+{
+    node_t   header;
+    uint8_t  indexes[256];                  // Index plus one of children, or zero if no child.
+    node_t  *children[48];
+} node48_t;
+
+typedef struct node256_t
+{
+    node_t   header;
+    node_t  *children[256];
+} node256_t;
+
+static const unsigned node_capacities[] = { 0, 4, 16, 48, 256 };
+static const unsigned node_shrink_counts[] = { 0, 0, 3, 12, 40 };
+
+//------------------------------------------------------------------------------
+//---- Key ---------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static inline
+word_t word_from_key(const void *key)
+{
+    return (word_t) key ^ SIGN_BIT;
+}
+//------------------------------------------------------------------------------
+static inline
+void* word_to_key(word_t word)
+{
+    return (void*)( word ^ SIGN_BIT );
+}
+//------------------------------------------------------------------------------
+static inline
+unsigned word_get_byte(word_t word, unsigned depth)
+{
+    return ( word >> ( 8 * ( KEY_BYTES - 1 - depth ) ) ) & 0xFF;
+}
+//------------------------------------------------------------------------------
+static inline
+word_t word_prefix_mask(unsigned depth)
+{
+    // Mask of bytes before the depth.
+    return depth ? ~(word_t) 0 << ( 8 * ( KEY_BYTES - depth ) ) : 0;
+}
+//------------------------------------------------------------------------------
+//---- Node --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t* node_create(unsigned type, unsigned depth, word_t prefix)
+{
+    static const size_t sizes[] =
+    {
+        sizeof(leaf_t),
+        sizeof(node4_t),
+        sizeof(node16_t),
+        sizeof(node48_t),
+        sizeof(node256_t),
+    };
+
+    node_t *node = malloc(sizes[type]);
+    if( !node ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    node->prefix = prefix & word_prefix_mask(depth);
+    node->count  = 0;
+    node->depth  = depth;
+    node->type   = type;
+
+    if( type == NODE_48 )
+    {
+        node48_t *node48 = (node48_t*) node;
+        memset(node48->indexes, 0, sizeof(node48->indexes));
+        memset(node48->children, 0, sizeof(node48->children));
+    }
+    else if( type == NODE_256 )
+    {
+        node256_t *node256 = (node256_t*) node;
+        memset(node256->children, 0, sizeof(node256->children));
+    }
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+node_t* leaf_create(word_t word, void *value)
+{
+    leaf_t *leaf = (leaf_t*) node_create(NODE_LEAF, KEY_BYTES, word);
+    leaf->value = value;
+
+    return &leaf->header;
+}
+//------------------------------------------------------------------------------
+static inline
+uint8_t* node_small_keys(node_t *node)
+{
+    // Keys array of node4 or node16.
+    return node->type == NODE_4 ? ((node4_t*) node)->keys : ((node16_t*) node)->keys;
+}
+//------------------------------------------------------------------------------
+static inline
+node_t** node_small_children(node_t *node)
+{
+    // Children array of node4 or node16.
+    return node->type == NODE_4 ? ((node4_t*) node)->children : ((node16_t*) node)->children;
+}
+//------------------------------------------------------------------------------
+static
+node_t** node_find_child(node_t *node, unsigned byte)
+{
+    // Get the slot of the child by its byte, or NULL if the child does not exist.
+
+    switch( node->type )
+    {
+    case NODE_4:
+    case NODE_16:
+        {
+            const uint8_t *keys = node_small_keys(node);
+            for(unsigned i = 0; i < node->count; ++i)
+            {
+                if( keys[i] == byte ) return &node_small_children(node)[i];
+            }
+        }
+        return NULL;
+
+    case NODE_48:
+        {
+            node48_t *node48 = (node48_t*) node;
+            unsigned  index  = node48->indexes[byte];
+            return index ? &node48->children[ index - 1 ] : NULL;
+        }
+
+    case NODE_256:
+        {
+            node256_t *node256 = (node256_t*) node;
+            return node256->children[byte] ? &node256->children[byte] : NULL;
+        }
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+static
+int node_next_byte(node_t *node, int byte)
+{
+    // Get the smallest byte of children which is greater than the specified byte,
+    // or -1 if no such child.
+
+    switch( node->type )
+    {
+    case NODE_4:
+    case NODE_16:
+        {
+            const uint8_t *keys = node_small_keys(node);
+            for(unsigned i = 0; i < node->count; ++i)
+            {
+                if( keys[i] > byte ) return keys[i];
+            }
+        }
+        break;
+
+    case NODE_48:
+        {
+            const node48_t *node48 = (const node48_t*) node;
+            for(int i = byte + 1; i < 256; ++i)
+            {
+                if( node48->indexes[i] ) return i;
+            }
+        }
+        break;
+
+    case NODE_256:
+        {
+            const node256_t *node256 = (const node256_t*) node;
+            for(int i = byte + 1; i < 256; ++i)
+            {
+                if( node256->children[i] ) return i;
+            }
+        }
+        break;
+    }
+
+    return -1;
+}
+//------------------------------------------------------------------------------
+static
+int node_prev_byte(node_t *node, int byte)
+{
+    // Get the largest byte of children which is less than the specified byte,
+    // or -1 if no such child.
+
+    switch( node->type )
+    {
+    case NODE_4:
+    case NODE_16:
+        {
+            const uint8_t *keys = node_small_keys(node);
+            for(unsigned i = node->count; i; --i)
+            {
+                if( keys[ i - 1 ] < byte ) return keys[ i - 1 ];
+            }
+        }
+        break;
+
+    case NODE_48:
+        {
+            const node48_t *node48 = (const node48_t*) node;
+            for(int i = byte - 1; i >= 0; --i)
+            {
+                if( node48->indexes[i] ) return i;
+            }
+        }
+        break;
+
+    case NODE_256:
+        {
+            const node256_t *node256 = (const node256_t*) node;
+            for(int i = byte - 1; i >= 0; --i)
+            {
+                if( node256->children[i] ) return i;
+            }
+        }
+        break;
+    }
+
+    return -1;
+}
+//------------------------------------------------------------------------------
+static
+void node_insert_child(node_t *node, unsigned byte, node_t *child)
+{
+    // The node must not be full, and must not have a child with the same byte.
+
+    assert( node->count < node_capacities[ node->type ] );
+
+    switch( node->type )
+    {
+    case NODE_4:
+    case NODE_16:
+        {
+            uint8_t  *keys     = node_small_keys(node);
+            node_t  **children = node_small_children(node);
+
+            unsigned pos = 0;
+            while( pos < node->count && keys[pos] < byte ) ++ pos;
+
+            unsigned moved = node->count - pos;
+            memmove(&keys[ pos + 1 ], &keys[pos], moved * sizeof(keys[0]));
+            memmove(&children[ pos + 1 ], &children[pos], moved * sizeof(children[0]));
+
+            keys[pos]     = byte;
+            children[pos] = child;
+        }
+        break;
+
+    case NODE_48:
+        {
+            node48_t *node48 = (node48_t*) node;
+
+            unsigned index = 0;
+            while( node48->children[index] ) ++ index;
+
+            node48->children[index] = child;
+            node48->indexes[byte]   = index + 1;
+        }
+        break;
+
+    case NODE_256:
+        ((node256_t*) node)->children[byte] = child;
+        break;
+    }
+
+    ++ node->count;
+}
+//------------------------------------------------------------------------------
+static
+void node_remove_child(node_t *node, unsigned byte)
+{
+    // The node must have a child with the byte.
+
+    switch( node->type )
+    {
+    case NODE_4:
+    case NODE_16:
+        {
+            uint8_t  *keys     = node_small_keys(node);
+            node_t  **children = node_small_children(node);
+
+            unsigned pos = 0;
+            while( keys[pos] != byte ) ++ pos;
+
+            unsigned moved = node->count - pos - 1;
+            memmove(&keys[pos], &keys[ pos + 1 ], moved * sizeof(keys[0]));
+            memmove(&children[pos], &children[ pos + 1 ], moved * sizeof(children[0]));
+        }
+        break;
+
+    case NODE_48:
+        {
+            node48_t *node48 = (node48_t*) node;
+            node48->children[ node48->indexes[byte] - 1 ] = NULL;
+            node48->indexes[byte] = 0;
+        }
+        break;
+
+    case NODE_256:
+        ((node256_t*) node)->children[byte] = NULL;
+        break;
+    }
+
+    -- node->count;
+}
+//------------------------------------------------------------------------------
+static
+node_t* node_resize(node_t *node, unsigned type)
+{
+    // Move all children to a new node of another type, and release the old node.
+
+    node_t *new_node = node_create(type, node->depth, node->prefix);
+
+    for(int byte = node_next_byte(node, -1); byte >= 0; byte = node_next_byte(node, byte))
+        node_insert_child(new_node, byte, *node_find_child(node, byte));
+
+    free(node);
+
+    return new_node;
+}
+//------------------------------------------------------------------------------
+static
+void node_release_recursive(node_t *node, ccntr_man_art_release_value_t release_value)
+{
+    if( node->type == NODE_LEAF )
+    {
+        release_value(((leaf_t*) node)->value);
+    }
+    else
+    {
+        for(int byte = node_next_byte(node, -1); byte >= 0; byte = node_next_byte(node, byte))
+            node_release_recursive(*node_find_child(node, byte), release_value);
+    }
+
+    free(node);
+}
+//------------------------------------------------------------------------------
+//---- Tree --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+leaf_t* tree_find(node_t *node, word_t word)
+{
+    while( node )
+    {
+        if( ( word & word_prefix_mask(node->depth) ) != node->prefix ) return NULL;
+        if( node->type == NODE_LEAF ) return (leaf_t*) node;
+
+        node_t **slot = node_find_child(node, word_get_byte(word, node->depth));
+        node = slot ? *slot : NULL;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* subtree_get_first(node_t *node)
+{
+    // Inner nodes have two children at least.
+    while( node->type != NODE_LEAF )
+        node = *node_find_child(node, node_next_byte(node, -1));
+
+    return (leaf_t*) node;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* subtree_get_last(node_t *node)
+{
+    // Inner nodes have two children at least.
+    while( node->type != NODE_LEAF )
+        node = *node_find_child(node, node_prev_byte(node, 256));
+
+    return (leaf_t*) node;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* subtree_find_nearest_less(node_t *node, word_t word)
+{
+    // Find the last leaf which key is not greater than the word.
+
+    word_t masked = word & word_prefix_mask(node->depth);
+    if( masked != node->prefix )
+        return masked > node->prefix ? subtree_get_last(node) : NULL;
+
+    if( node->type == NODE_LEAF ) return (leaf_t*) node;
+
+    unsigned  byte = word_get_byte(word, node->depth);
+    node_t  **slot = node_find_child(node, byte);
+    if( slot )
+    {
+        leaf_t *leaf = subtree_find_nearest_less(*slot, word);
+        if( leaf ) return leaf;
+    }
+
+    int prev = node_prev_byte(node, byte);
+    return prev >= 0 ? subtree_get_last(*node_find_child(node, prev)) : NULL;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* subtree_find_nearest_great(node_t *node, word_t word)
+{
+    // Find the first leaf which key is not less than the word.
+
+    word_t masked = word & word_prefix_mask(node->depth);
+    if( masked != node->prefix )
+        return masked < node->prefix ? subtree_get_first(node) : NULL;
+
+    if( node->type == NODE_LEAF ) return (leaf_t*) node;
+
+    unsigned  byte = word_get_byte(word, node->depth);
+    node_t  **slot = node_find_child(node, byte);
+    if( slot )
+    {
+        leaf_t *leaf = subtree_find_nearest_great(*slot, word);
+        if( leaf ) return leaf;
+    }
+
+    int next = node_next_byte(node, byte);
+    return next >= 0 ? subtree_get_first(*node_find_child(node, next)) : NULL;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* tree_get_prev(const ccntr_man_art_t *self, const leaf_t *leaf)
+{
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+
+    word_t  word = leaf->header.prefix;
+    leaf_t *prev = word && self->root ? subtree_find_nearest_less(self->root, word - 1) : NULL;
+
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return prev;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* tree_get_next(const ccntr_man_art_t *self, const leaf_t *leaf)
+{
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+
+    word_t  word = leaf->header.prefix;
+    leaf_t *next = ~word && self->root ? subtree_find_nearest_great(self->root, word + 1) : NULL;
+
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return next;
+}
+//------------------------------------------------------------------------------
+static
+bool tree_insert(ccntr_man_art_t *self, word_t word, void *value, void **old_value)
+{
+    node_t **ref = &self->root;
+    while( *ref )
+    {
+        node_t *node = *ref;
+
+        if( ( word & word_prefix_mask(node->depth) ) != node->prefix )
+        {
+            // Split the prefix by a new node which dispatches the first different byte.
+            unsigned depth = 0;
+            while( word_get_byte(word, depth) == word_get_byte(node->prefix, depth) ) ++ depth;
+
+            node_t *parent = node_create(NODE_4, depth, word);
+            node_insert_child(parent, word_get_byte(node->prefix, depth), node);
+            node_insert_child(parent, word_get_byte(word, depth), leaf_create(word, value));
+
+            *ref = parent;
+            ++ self->count;
+            return false;
+        }
+
+        if( node->type == NODE_LEAF )
+        {
+            leaf_t *leaf = (leaf_t*) node;
+            *old_value  = leaf->value;
+            leaf->value = value;
+            return true;
+        }
+
+        unsigned  byte = word_get_byte(word, node->depth);
+        node_t  **slot = node_find_child(node, byte);
+        if( !slot )
+        {
+            if( node->count == node_capacities[ node->type ] )
+                *ref = node = node_resize(node, node->type + 1);
+
+            node_insert_child(node, byte, leaf_create(word, value));
+            ++ self->count;
+            return false;
+        }
+
+        ref = slot;
+    }
+
+    *ref = leaf_create(word, value);
+    ++ self->count;
+    return false;
+}
+//------------------------------------------------------------------------------
+static
+leaf_t* tree_unlink(ccntr_man_art_t *self, word_t word)
+{
+    node_t **ref        = &self->root;
+    node_t **parent_ref = NULL;
+
+    node_t *node;
+    while(( node = *ref ))
+    {
+        if( ( word & word_prefix_mask(node->depth) ) != node->prefix ) return NULL;
+        if( node->type == NODE_LEAF ) break;
+
+        node_t **slot = node_find_child(node, word_get_byte(word, node->depth));
+        if( !slot ) return NULL;
+
+        parent_ref = ref;
+        ref        = slot;
+    }
+
+    if( !node ) return NULL;
+    -- self->count;
+
+    if( !parent_ref )
+    {
+        self->root = NULL;
+        return (leaf_t*) node;
+    }
+
+    node_t *parent = *parent_ref;
+    node_remove_child(parent, word_get_byte(word, parent->depth));
+
+    if( parent->type == NODE_4 && parent->count == 1 )
+    {
+        // Children keep their whole prefixes,
+        // so that the only child can replace the parent directly.
+        *parent_ref = ((node4_t*) parent)->children[0];
+        free(parent);
+    }
+    else if( parent->count <= node_shrink_counts[ parent->type ] )
+    {
+        *parent_ref = node_resize(parent, parent->type - 1);
+    }
+
+    return (leaf_t*) node;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_art_iter_move_prev(ccntr_man_art_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+    self->leaf = tree_get_prev(self->container, self->leaf);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_iter_move_next(ccntr_man_art_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+    self->leaf = tree_get_next(self->container, self->leaf);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_art_iter_get_key(ccntr_man_art_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->leaf ? word_to_key(self->leaf->header.prefix) : NULL;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_art_iter_get_value(ccntr_man_art_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->leaf ? self->leaf->value : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_art_citer_move_prev(ccntr_man_art_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_citer_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+    self->leaf = tree_get_prev(self->container, self->leaf);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_citer_move_next(ccntr_man_art_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+    self->leaf = tree_get_next(self->container, self->leaf);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_art_citer_get_key(const ccntr_man_art_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->leaf ? word_to_key(self->leaf->header.prefix) : NULL;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_art_citer_get_value(const ccntr_man_art_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->leaf ? self->leaf->value : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Adaptive Radix Tree Key Map Container -----------------------------------
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_init(ccntr_man_art_t *self, ccntr_man_art_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    self->root  = NULL;
+    self->count = 0;
+
+    self->release_value = release_value ? release_value : release_value_default;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_destroy(ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_art_clear(self);
+}
+//------------------------------------------------------------------------------
+ccntr_man_art_iter_t ccntr_man_art_get_first(ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_art_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_art_iter_init(&iter, self, self->root ? subtree_get_first(self->root) : NULL);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_art_iter_t ccntr_man_art_get_last(ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_art_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_art_iter_init(&iter, self, self->root ? subtree_get_last(self->root) : NULL);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_art_iter_t ccntr_man_art_find(ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_man_art_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_art_iter_init(&iter, self, tree_find(self->root, word_from_key(key)));
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_art_iter_t ccntr_man_art_find_nearest_less(ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_man_art_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_art_iter_init(&iter,
+                            self,
+                            self->root ? subtree_find_nearest_less(self->root, word_from_key(key)) : NULL);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_art_iter_t ccntr_man_art_find_nearest_great(ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_man_art_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_art_iter_init(&iter,
+                            self,
+                            self->root ? subtree_find_nearest_great(self->root, word_from_key(key)) : NULL);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_art_find_value(ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_art_iter_t iter = ccntr_man_art_find(self, key);
+    return ccntr_man_art_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_art_find_value_c(const ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_art_find_value((ccntr_man_art_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_insert(ccntr_man_art_t *self, const void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value will be replaced by the new one.
+     */
+    void *old_value;
+
+    ccntr_spinlock_lock(&self->lock);
+    bool replaced = tree_insert(self, word_from_key(key), value, &old_value);
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( replaced ) self->release_value(old_value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_erase(ccntr_man_art_t *self, ccntr_man_art_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    if( !pos->leaf ) return;
+
+    ccntr_man_art_erase_by_key(self, word_to_key(pos->leaf->header.prefix));
+    ccntr_man_art_iter_init(pos, NULL, NULL);
+}
+//------------------------------------------------------------------------------
+bool ccntr_man_art_erase_by_key(ccntr_man_art_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     * @return TRUE if the value is found and erased; and FALSE if not found.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    leaf_t *leaf = tree_unlink(self, word_from_key(key));
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( !leaf ) return false;
+
+    self->release_value(leaf->value);
+    free(leaf);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_art_clear(ccntr_man_art_t *self)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *root = self->root;
+    self->root  = NULL;
+    self->count = 0;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( root ) node_release_recursive(root, self->release_value);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_art_pop(ccntr_man_art_t *self, ccntr_man_art_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_art_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_art_t::ccntr_man_art_erase,
+     *          but just remove the value from the container,
+     *          and will not release it.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     * @return The value be removed from container;
+     *         or NULL if no value available.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    if( !pos->leaf ) return NULL;
+
+    ccntr_spinlock_lock(&self->lock);
+    leaf_t *leaf = tree_unlink(self, pos->leaf->header.prefix);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_art_iter_init(pos, NULL, NULL);
+
+    if( !leaf ) return NULL;
+
+    void *value = leaf->value;
+    free(leaf);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_ART_ENABLED
@@ -0,0 +1,1089 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "abort_message.h"
+#include "ccntr_man_btree.h"
+
+#ifdef CCNTR_MAN_BTREE_ENABLED
+
+/*
+ * Nodes are sized to a few cache lines,
+ * and the capacities are calculated by the node size.
+ */
+#define NODE_SIZE       256
+#define LEAF_CAPACITY   ( ( NODE_SIZE - 3 * sizeof(void*) ) / ( 2 * sizeof(void*) ) )
+#define INNER_CAPACITY  ( ( NODE_SIZE - 2 * sizeof(void*) ) / ( 2 * sizeof(void*) ) )
+#define LEAF_MIN        ( LEAF_CAPACITY / 2 )
+#define INNER_MIN       ( INNER_CAPACITY / 2 )
+
+#define MAX_DEPTH 32
+
+typedef struct ccntr_man_btree_node_t
+{
+    unsigned short count;
+    bool           is_leaf;
+} node_t;
+
+typedef struct ccntr_man_btree_leaf_t
+{
+    node_t                         header;
+    struct ccntr_man_btree_leaf_t *prev;
+    struct ccntr_man_btree_leaf_t *next;
+    void                          *keys[LEAF_CAPACITY];
+    void                          *values[LEAF_CAPACITY];
+} leaf_t;
+
+typedef struct inner_t
+{
+    node_t   header;
+    void    *keys[INNER_CAPACITY];          // keys[i] is the minimum key of children[i+1].
+    node_t  *children[INNER_CAPACITY + 1];
+} inner_t;
+
+typedef struct path_t
+{
+    inner_t  *nodes[MAX_DEPTH];
+    unsigned  indexes[MAX_DEPTH];           // Index of the child be passed through.
+    unsigned  depth;
+} path_t;
+
+//------------------------------------------------------------------------------
+//---- Node --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+leaf_t* leaf_create(void)
+{
+    leaf_t *leaf = malloc(sizeof(leaf_t));
+    if( !leaf ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    leaf->header.count   = 0;
+    leaf->header.is_leaf = true;
+    leaf->prev           = NULL;
+    leaf->next           = NULL;
+
+    return leaf;
+}
+//------------------------------------------------------------------------------
+static
+inner_t* inner_create(void)
+{
+    inner_t *inner = malloc(sizeof(inner_t));
+    if( !inner ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    inner->header.count   = 0;
+    inner->header.is_leaf = false;
+
+    return inner;
+}
+//------------------------------------------------------------------------------
+static
+unsigned node_lower_bound(void *const *keys, unsigned count, const void *key, ccntr_map_compare_keys_t compare)
+{
+    // Find the first key which is not less than the specified key.
+    unsigned first = 0;
+    while( count )
+    {
+        unsigned half = count / 2;
+        if( compare(keys[ first + half ], key) < 0 )
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+//------------------------------------------------------------------------------
+static
+unsigned node_upper_bound(void *const *keys, unsigned count, const void *key, ccntr_map_compare_keys_t compare)
+{
+    // Find the first key which is greater than the specified key.
+    unsigned first = 0;
+    while( count )
+    {
+        unsigned half = count / 2;
+        if( compare(keys[ first + half ], key) <= 0 )
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first;
+}
+//------------------------------------------------------------------------------
+static
+void leaf_insert_at(leaf_t *leaf, unsigned index, void *key, void *value)
+{
+    unsigned moved = leaf->header.count - index;
+    memmove(&leaf->keys[ index + 1 ], &leaf->keys[index], moved * sizeof(void*));
+    memmove(&leaf->values[ index + 1 ], &leaf->values[index], moved * sizeof(void*));
+
+    leaf->keys[index]   = key;
+    leaf->values[index] = value;
+    ++ leaf->header.count;
+}
+//------------------------------------------------------------------------------
+static
+void leaf_remove_at(leaf_t *leaf, unsigned index)
+{
+    unsigned moved = leaf->header.count - index - 1;
+    memmove(&leaf->keys[index], &leaf->keys[ index + 1 ], moved * sizeof(void*));
+    memmove(&leaf->values[index], &leaf->values[ index + 1 ], moved * sizeof(void*));
+
+    -- leaf->header.count;
+}
+//------------------------------------------------------------------------------
+static
+void inner_insert_at(inner_t *inner, unsigned index, void *key, node_t *right)
+{
+    // Insert a key and the right child of it.
+    unsigned moved = inner->header.count - index;
+    memmove(&inner->keys[ index + 1 ], &inner->keys[index], moved * sizeof(void*));
+    memmove(&inner->children[ index + 2 ], &inner->children[ index + 1 ], moved * sizeof(node_t*));
+
+    inner->keys[index]           = key;
+    inner->children[ index + 1 ] = right;
+    ++ inner->header.count;
+}
+//------------------------------------------------------------------------------
+static
+void inner_remove_at(inner_t *inner, unsigned index)
+{
+    // Remove a key and the right child of it.
+    unsigned moved = inner->header.count - index - 1;
+    memmove(&inner->keys[index], &inner->keys[ index + 1 ], moved * sizeof(void*));
+    memmove(&inner->children[ index + 1 ], &inner->children[ index + 2 ], moved * sizeof(node_t*));
+
+    -- inner->header.count;
+}
+//------------------------------------------------------------------------------
+static
+void node_release_recursive(node_t *node)
+{
+    if( !node->is_leaf )
+    {
+        inner_t *inner = (inner_t*) node;
+        for(unsigned i = 0; i <= inner->header.count; ++i)
+            node_release_recursive(inner->children[i]);
+    }
+
+    free(node);
+}
+//------------------------------------------------------------------------------
+//---- Tree --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+leaf_t* tree_find_leaf(const ccntr_man_btree_t *self, const void *key, path_t *path)
+{
+    // Find the leaf which the key should be placed in, and record the path if needed.
+
+    if( path ) path->depth = 0;
+
+    node_t *node = self->root;
+    if( !node ) return NULL;
+
+    while( !node->is_leaf )
+    {
+        inner_t *inner = (inner_t*) node;
+        unsigned index = node_upper_bound(inner->keys, inner->header.count, key, self->compare);
+
+        if( path )
+        {
+            assert( path->depth < MAX_DEPTH );
+            path->nodes[ path->depth ] = inner;
+            path->indexes[ path->depth ] = index;
+            ++ path->depth;
+        }
+
+        node = inner->children[index];
+    }
+
+    return (leaf_t*) node;
+}
+//------------------------------------------------------------------------------
+static
+void tree_replace_separator(path_t *path, const void *old_key, void *new_key)
+{
+    /*
+     * Separators are copies of keys in leaves, and the key of a leaf may be
+     * also used as a separator in an ancestor (once at most),
+     * so the separator must be replaced before the key be released.
+     */
+    for(unsigned depth = 0; depth < path->depth; ++depth)
+    {
+        inner_t *inner = path->nodes[depth];
+        unsigned child = path->indexes[depth];
+        if( child && inner->keys[ child - 1 ] == old_key )
+        {
+            inner->keys[ child - 1 ] = new_key;
+            return;
+        }
+    }
+}
+//------------------------------------------------------------------------------
+static
+void tree_insert_into_parent(ccntr_man_btree_t *self, path_t *path, node_t *left, void *key, node_t *right)
+{
+    while( path->depth )
+    {
+        -- path->depth;
+        inner_t *parent = path->nodes[ path->depth ];
+        unsigned index  = path->indexes[ path->depth ];
+
+        if( parent->header.count < INNER_CAPACITY )
+        {
+            inner_insert_at(parent, index, key, right);
+            return;
+        }
+
+        // Split the parent: the middle key will be moved up to the grandparent.
+        void   *keys[ INNER_CAPACITY + 1 ];
+        node_t *children[ INNER_CAPACITY + 2 ];
+
+        memcpy(keys, parent->keys, index * sizeof(void*));
+        keys[index] = key;
+        memcpy(&keys[ index + 1 ], &parent->keys[index], ( INNER_CAPACITY - index ) * sizeof(void*));
+
+        memcpy(children, parent->children, ( index + 1 ) * sizeof(node_t*));
+        children[ index + 1 ] = right;
+        memcpy(&children[ index + 2 ], &parent->children[ index + 1 ], ( INNER_CAPACITY - index ) * sizeof(node_t*));
+
+        unsigned total = INNER_CAPACITY + 1;
+        unsigned mid   = total / 2;
+
+        inner_t *sibling = inner_create();
+
+        parent->header.count = mid;
+        memcpy(parent->keys, keys, mid * sizeof(void*));
+        memcpy(parent->children, children, ( mid + 1 ) * sizeof(node_t*));
+
+        sibling->header.count = total - mid - 1;
+        memcpy(sibling->keys, &keys[ mid + 1 ], sibling->header.count * sizeof(void*));
+        memcpy(sibling->children, &children[ mid + 1 ], ( sibling->header.count + 1 ) * sizeof(node_t*));
+
+        left  = (node_t*) parent;
+        key   = keys[mid];
+        right = (node_t*) sibling;
+    }
+
+    // The root is split, and the tree grows up.
+    inner_t *root = inner_create();
+    root->header.count = 1;
+    root->keys[0]      = key;
+    root->children[0]  = left;
+    root->children[1]  = right;
+
+    self->root = (node_t*) root;
+}
+//------------------------------------------------------------------------------
+static
+bool tree_insert(ccntr_man_btree_t *self, void *key, void *value, void **old_key, void **old_value)
+{
+    // Return TRUE if an existed value is replaced.
+
+    if( !self->root )
+    {
+        leaf_t *leaf = leaf_create();
+        self->root  = (node_t*) leaf;
+        self->first = leaf;
+        self->last  = leaf;
+    }
+
+    path_t path;
+    leaf_t *leaf = tree_find_leaf(self, key, &path);
+
+    unsigned index = node_lower_bound(leaf->keys, leaf->header.count, key, self->compare);
+    if( index < leaf->header.count && !self->compare(leaf->keys[index], key) )
+    {
+        *old_key   = leaf->keys[index];
+        *old_value = leaf->values[index];
+
+        leaf->keys[index]   = key;
+        leaf->values[index] = value;
+
+        tree_replace_separator(&path, *old_key, key);
+
+        return true;
+    }
+
+    ++ self->count;
+
+    if( leaf->header.count < LEAF_CAPACITY )
+    {
+        leaf_insert_at(leaf, index, key, value);
+        return false;
+    }
+
+    // Split the leaf, and the upper half will be moved to the new leaf.
+    leaf_t *sibling = leaf_create();
+
+    unsigned split = ( LEAF_CAPACITY + 1 ) / 2;
+    sibling->header.count = LEAF_CAPACITY - split;
+    memcpy(sibling->keys, &leaf->keys[split], sibling->header.count * sizeof(void*));
+    memcpy(sibling->values, &leaf->values[split], sibling->header.count * sizeof(void*));
+    leaf->header.count = split;
+
+    if( index < split )
+        leaf_insert_at(leaf, index, key, value);
+    else
+        leaf_insert_at(sibling, index - split, key, value);
+
+    sibling->prev = leaf;
+    sibling->next = leaf->next;
+    if( leaf->next )
+        leaf->next->prev = sibling;
+    else
+        self->last = sibling;
+    leaf->next = sibling;
+
+    tree_insert_into_parent(self, &path, (node_t*) leaf, sibling->keys[0], (node_t*) sibling);
+
+    return false;
+}
+//------------------------------------------------------------------------------
+static
+void tree_rebalance_inner(ccntr_man_btree_t *self, path_t *path)
+{
+    // Fix underflow of the inner node at the end of the path.
+
+    while( path->depth )
+    {
+        inner_t *node = path->nodes[ path->depth - 1 ];
+
+        if( path->depth == 1 )
+        {
+            // The root is empty, and the tree shrinks down.
+            if( !node->header.count )
+            {
+                self->root = node->children[0];
+                free(node);
+            }
+
+            return;
+        }
+
+        if( node->header.count >= INNER_MIN ) return;
+
+        inner_t *parent = path->nodes[ path->depth - 2 ];
+        unsigned index  = path->indexes[ path->depth - 2 ];
+
+        inner_t *left  = index ? (inner_t*) parent->children[ index - 1 ] : NULL;
+        inner_t *right = index < parent->header.count ? (inner_t*) parent->children[ index + 1 ] : NULL;
+
+        if( left && left->header.count > INNER_MIN )
+        {
+            // Rotate the last child of the left sibling to this node.
+            memmove(&node->keys[1], node->keys, node->header.count * sizeof(void*));
+            memmove(&node->children[1], node->children, ( node->header.count + 1 ) * sizeof(node_t*));
+
+            node->keys[0]     = parent->keys[ index - 1 ];
+            node->children[0] = left->children[ left->header.count ];
+            ++ node->header.count;
+
+            parent->keys[ index - 1 ] = left->keys[ left->header.count - 1 ];
+            -- left->header.count;
+
+            return;
+        }
+
+        if( right && right->header.count > INNER_MIN )
+        {
+            // Rotate the first child of the right sibling to this node.
+            node->keys[ node->header.count ]         = parent->keys[index];
+            node->children[ node->header.count + 1 ] = right->children[0];
+            ++ node->header.count;
+
+            parent->keys[index] = right->keys[0];
+
+            memmove(right->keys, &right->keys[1], ( right->header.count - 1 ) * sizeof(void*));
+            memmove(right->children, &right->children[1], right->header.count * sizeof(node_t*));
+            -- right->header.count;
+
+            return;
+        }
+
+        // Merge with a sibling, and the separator key will be moved down.
+        if( left )
+        {
+            right = node;
+            -- index;
+        }
+        else
+        {
+            left = node;
+        }
+
+        left->keys[ left->header.count ] = parent->keys[index];
+        memcpy(&left->keys[ left->header.count + 1 ], right->keys, right->header.count * sizeof(void*));
+        memcpy(&left->children[ left->header.count + 1 ], right->children, ( right->header.count + 1 ) * sizeof(node_t*));
+        left->header.count += 1 + right->header.count;
+        free(right);
+
+        inner_remove_at(parent, index);
+
+        -- path->depth;
+    }
+}
+//------------------------------------------------------------------------------
+static
+void tree_rebalance_leaf(ccntr_man_btree_t *self, path_t *path, leaf_t *leaf)
+{
+    if( !path->depth )
+    {
+        // The leaf is the root.
+        if( !leaf->header.count )
+        {
+            free(leaf);
+            self->root  = NULL;
+            self->first = NULL;
+            self->last  = NULL;
+        }
+
+        return;
+    }
+
+    if( leaf->header.count >= LEAF_MIN ) return;
+
+    inner_t *parent = path->nodes[ path->depth - 1 ];
+    unsigned index  = path->indexes[ path->depth - 1 ];
+
+    leaf_t *left  = index ? (leaf_t*) parent->children[ index - 1 ] : NULL;
+    leaf_t *right = index < parent->header.count ? (leaf_t*) parent->children[ index + 1 ] : NULL;
+
+    if( left && left->header.count > LEAF_MIN )
+    {
+        // Borrow the last value of the left sibling.
+        unsigned last = left->header.count - 1;
+        leaf_insert_at(leaf, 0, left->keys[last], left->values[last]);
+        -- left->header.count;
+
+        parent->keys[ index - 1 ] = leaf->keys[0];
+        return;
+    }
+
+    if( right && right->header.count > LEAF_MIN )
+    {
+        // Borrow the first value of the right sibling.
+        leaf_insert_at(leaf, leaf->header.count, right->keys[0], right->values[0]);
+        leaf_remove_at(right, 0);
+
+        parent->keys[index] = right->keys[0];
+        return;
+    }
+
+    // Merge with a sibling.
+    if( left )
+    {
+        right = leaf;
+        -- index;
+    }
+    else
+    {
+        left = leaf;
+    }
+
+    memcpy(&left->keys[ left->header.count ], right->keys, right->header.count * sizeof(void*));
+    memcpy(&left->values[ left->header.count ], right->values, right->header.count * sizeof(void*));
+    left->header.count += right->header.count;
+
+    left->next = right->next;
+    if( right->next )
+        right->next->prev = left;
+    else
+        self->last = left;
+    free(right);
+
+    inner_remove_at(parent, index);
+    tree_rebalance_inner(self, path);
+}
+//------------------------------------------------------------------------------
+static
+bool tree_erase(ccntr_man_btree_t *self, const void *key, void **old_key, void **old_value)
+{
+    // Return TRUE if the value is found and erased.
+
+    path_t path;
+    leaf_t *leaf = tree_find_leaf(self, key, &path);
+    if( !leaf ) return false;
+
+    unsigned index = node_lower_bound(leaf->keys, leaf->header.count, key, self->compare);
+    if( index >= leaf->header.count || self->compare(leaf->keys[index], key) ) return false;
+
+    *old_key   = leaf->keys[index];
+    *old_value = leaf->values[index];
+
+    leaf_remove_at(leaf, index);
+    -- self->count;
+
+    // The successor is the new minimum key of the subtree which is separated by the erased key.
+    if( leaf->header.count && !index )
+        tree_replace_separator(&path, *old_key, leaf->keys[0]);
+
+    tree_rebalance_leaf(self, &path, leaf);
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+ccntr_man_btree_iter_t tree_find_nearest_less(ccntr_man_btree_t *self, const void *key)
+{
+    ccntr_man_btree_iter_t iter;
+    ccntr_man_btree_iter_init(&iter, self, NULL, 0);
+
+    leaf_t *leaf = tree_find_leaf(self, key, NULL);
+    if( !leaf ) return iter;
+
+    unsigned index = node_upper_bound(leaf->keys, leaf->header.count, key, self->compare);
+    if( index )
+        ccntr_man_btree_iter_init(&iter, self, leaf, index - 1);
+    else if( leaf->prev )
+        ccntr_man_btree_iter_init(&iter, self, leaf->prev, leaf->prev->header.count - 1);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+static
+ccntr_man_btree_iter_t tree_find_nearest_great(ccntr_man_btree_t *self, const void *key)
+{
+    ccntr_man_btree_iter_t iter;
+    ccntr_man_btree_iter_init(&iter, self, NULL, 0);
+
+    leaf_t *leaf = tree_find_leaf(self, key, NULL);
+    if( !leaf ) return iter;
+
+    unsigned index = node_lower_bound(leaf->keys, leaf->header.count, key, self->compare);
+    if( index < leaf->header.count )
+        ccntr_man_btree_iter_init(&iter, self, leaf, index);
+    else if( leaf->next )
+        ccntr_man_btree_iter_init(&iter, self, leaf->next, 0);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_btree_iter_move_prev(ccntr_man_btree_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+
+    if( self->index )
+    {
+        -- self->index;
+    }
+    else
+    {
+        self->leaf  = self->leaf->prev;
+        self->index = self->leaf ? self->leaf->header.count - 1 : 0;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_iter_move_next(ccntr_man_btree_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+
+    if( ++ self->index >= self->leaf->header.count )
+    {
+        self->leaf  = self->leaf->next;
+        self->index = 0;
+    }
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_iter_get_key(ccntr_man_btree_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     *
+     * @attention Do NOT modify the key directly, except
+     *            the key (and value) has already be popped from the container.
+     *            If you want to modify a key in the container,
+     *            you will be need to erase or pop it, then modify it, then insert again.
+     */
+    return self->leaf ? self->leaf->keys[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_iter_get_value(ccntr_man_btree_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->leaf ? self->leaf->values[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_btree_citer_move_prev(ccntr_man_btree_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_citer_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+
+    if( self->index )
+    {
+        -- self->index;
+    }
+    else
+    {
+        self->leaf  = self->leaf->prev;
+        self->index = self->leaf ? self->leaf->header.count - 1 : 0;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_citer_move_next(ccntr_man_btree_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->leaf ) return;
+
+    if( ++ self->index >= self->leaf->header.count )
+    {
+        self->leaf  = self->leaf->next;
+        self->index = 0;
+    }
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_btree_citer_get_key(const ccntr_man_btree_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->leaf ? self->leaf->keys[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_btree_citer_get_value(const ccntr_man_btree_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->leaf ? self->leaf->values[ self->index ] : NULL;
+}
+//------------------------------------------------------------------------------
+//---- B+ Tree Key Map Container -----------------------------------------------
+//------------------------------------------------------------------------------
+static
+int compare_default(const void *key1, const void *key2)
+{
+    return ( (intptr_t) key1 > (intptr_t) key2 ) - ( (intptr_t) key1 < (intptr_t) key2 );
+}
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_init(ccntr_man_btree_t              *self,
+                          ccntr_map_compare_keys_t        compare,
+                          ccntr_man_btree_release_key_t   release_key,
+                          ccntr_man_btree_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param compare       A function to be used to compare keys.
+     *                      If this parameter is NULL, then
+     *                      all keys will be treated as integral values.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    self->root  = NULL;
+    self->first = NULL;
+    self->last  = NULL;
+    self->count = 0;
+
+    self->compare = compare ? compare : compare_default;
+    self->release_key = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_destroy(ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_btree_clear(self);
+}
+//------------------------------------------------------------------------------
+ccntr_man_btree_iter_t ccntr_man_btree_get_first(ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_btree_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_btree_iter_init(&iter, self, self->first, 0);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_btree_iter_t ccntr_man_btree_get_last(ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_man_btree_iter_t iter;
+
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_btree_iter_init(&iter, self, self->last, self->last ? self->last->header.count - 1 : 0);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_btree_iter_t ccntr_man_btree_find(ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_man_btree_iter_t iter;
+    ccntr_man_btree_iter_init(&iter, self, NULL, 0);
+
+    ccntr_spinlock_lock(&self->lock);
+
+    leaf_t *leaf = tree_find_leaf(self, key, NULL);
+    if( leaf )
+    {
+        unsigned index = node_lower_bound(leaf->keys, leaf->header.count, key, self->compare);
+        if( index < leaf->header.count && !self->compare(leaf->keys[index], key) )
+            ccntr_man_btree_iter_init(&iter, self, leaf, index);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_btree_iter_t ccntr_man_btree_find_nearest_less(ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_btree_iter_t iter = tree_find_nearest_less(self, key);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_btree_iter_t ccntr_man_btree_find_nearest_great(ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_man_btree_iter_t iter = tree_find_nearest_great(self, key);
+    ccntr_spinlock_unlock(&self->lock);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_find_value(ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_btree_iter_t iter = ccntr_man_btree_find(self, key);
+    return ccntr_man_btree_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_btree_find_value_c(const ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_btree_find_value((ccntr_man_btree_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_find_value_nearest_less(ccntr_man_btree_t *self,
+                                              const void        *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_btree_iter_t iter = ccntr_man_btree_find_nearest_less(self, key);
+    return ccntr_man_btree_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_btree_find_value_nearest_less_c(const ccntr_man_btree_t *self,
+                                                      const void              *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_btree_find_value_nearest_less((ccntr_man_btree_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_find_value_nearest_great(ccntr_man_btree_t *self,
+                                               const void        *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_btree_iter_t iter = ccntr_man_btree_find_nearest_great(self, key);
+    return ccntr_man_btree_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_btree_find_value_nearest_great_c(const ccntr_man_btree_t *self,
+                                                       const void              *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_btree_find_value_nearest_great((ccntr_man_btree_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_insert(ccntr_man_btree_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     */
+    void *old_key, *old_value;
+
+    ccntr_spinlock_lock(&self->lock);
+    bool replaced = tree_insert(self, key, value, &old_key, &old_value);
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( replaced )
+    {
+        self->release_key(old_key);
+        self->release_value(old_value);
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_erase(ccntr_man_btree_t *self, ccntr_man_btree_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    if( !pos->leaf ) return;
+
+    ccntr_man_btree_erase_by_key(self, pos->leaf->keys[ pos->index ]);
+    ccntr_man_btree_iter_init(pos, NULL, NULL, 0);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_erase_by_key(ccntr_man_btree_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     */
+    void *old_key, *old_value;
+
+    ccntr_spinlock_lock(&self->lock);
+    bool erased = tree_erase(self, key, &old_key, &old_value);
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( erased )
+    {
+        self->release_key(old_key);
+        self->release_value(old_value);
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_btree_clear(ccntr_man_btree_t *self)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *root  = self->root;
+    leaf_t *first = self->first;
+
+    self->root  = NULL;
+    self->first = NULL;
+    self->last  = NULL;
+    self->count = 0;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    for(leaf_t *leaf = first; leaf; leaf = leaf->next)
+    {
+        for(unsigned i = 0; i < leaf->header.count; ++i)
+        {
+            self->release_key(leaf->keys[i]);
+            self->release_value(leaf->values[i]);
+        }
+    }
+
+    if( root ) node_release_recursive(root);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_btree_pop(ccntr_man_btree_t *self, ccntr_man_btree_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_btree_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_btree_t::ccntr_man_btree_erase,
+     *          but just remove the value and key from the container,
+     *          and will not release them.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     * @return The value be removed from container;
+     *         or NULL if no value available.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    if( !pos->leaf ) return NULL;
+
+    void *old_key, *old_value = NULL;
+
+    ccntr_spinlock_lock(&self->lock);
+    tree_erase(self, pos->leaf->keys[ pos->index ], &old_key, &old_value);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_btree_iter_init(pos, NULL, NULL, 0);
+
+    return old_value;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_BTREE_ENABLED
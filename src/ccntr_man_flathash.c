@@ -0,0 +1,611 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "abort_message.h"
+#include "ccntr_man_flathash.h"
+
+#ifdef CCNTR_MAN_FLATHASH_ENABLED
+
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+    #include <emmintrin.h>
+    #define GROUP_USE_SSE2
+#endif
+
+typedef ccntr_man_flathash_slot_t slot_t;
+
+#define GROUP_SIZE  16
+
+/*
+ * States of control bytes.
+ * Control byte of a full slot is the lower 7 bits of the hash value,
+ * and others have the highest bit set.
+ */
+#define CTRL_EMPTY      0x80
+#define CTRL_DELETED    0xFE
+
+#define NOT_FOUND   SIZE_MAX
+
+//------------------------------------------------------------------------------
+//---- Group -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+/*
+ * Group operations return a bit mask,
+ * and each bit is set if the related slot of the group is matched.
+ */
+static inline
+unsigned group_match(const uint8_t *ctrl, uint8_t value)
+{
+#ifdef GROUP_USE_SSE2
+    __m128i group = _mm_loadu_si128((const __m128i*) ctrl);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char) value)));
+#else
+    unsigned mask = 0;
+    for(unsigned i = 0; i < GROUP_SIZE; ++i)
+        mask |= (unsigned)( ctrl[i] == value ) << i;
+
+    return mask;
+#endif
+}
+//------------------------------------------------------------------------------
+static inline
+unsigned group_match_free(const uint8_t *ctrl)
+{
+    // Match empty and deleted slots.
+#ifdef GROUP_USE_SSE2
+    __m128i group = _mm_loadu_si128((const __m128i*) ctrl);
+    return _mm_movemask_epi8(group);
+#else
+    unsigned mask = 0;
+    for(unsigned i = 0; i < GROUP_SIZE; ++i)
+        mask |= (unsigned)( ctrl[i] >> 7 ) << i;
+
+    return mask;
+#endif
+}
+//------------------------------------------------------------------------------
+static inline
+unsigned group_match_full(const uint8_t *ctrl)
+{
+    return ~group_match_free(ctrl) & ( ( 1u << GROUP_SIZE ) - 1 );
+}
+//------------------------------------------------------------------------------
+static inline
+unsigned mask_lowest_bit(unsigned mask)
+{
+    assert( mask );
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    unsigned index = 0;
+    while( !( mask & 1 ) )
+    {
+        mask >>= 1;
+        ++ index;
+    }
+
+    return index;
+#endif
+}
+//------------------------------------------------------------------------------
+//---- Table -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static inline
+uint8_t hash_get_ctrl(size_t hash)
+{
+    return hash & 0x7F;
+}
+//------------------------------------------------------------------------------
+static inline
+size_t hash_get_group(size_t hash)
+{
+    return hash >> 7;
+}
+//------------------------------------------------------------------------------
+static
+size_t table_get_max_growth(size_t capacity)
+{
+    // Keep 1/8 slots be empty, so that all probes can be terminated.
+    return capacity - capacity / 8;
+}
+//------------------------------------------------------------------------------
+static
+size_t table_find_slot(const ccntr_man_flathash_t *self, size_t hash, const void *key)
+{
+    if( !self->capacity ) return NOT_FOUND;
+
+    size_t  groups_mask = self->capacity / GROUP_SIZE - 1;
+    size_t  group       = hash_get_group(hash) & groups_mask;
+    uint8_t ctrl        = hash_get_ctrl(hash);
+
+    for(size_t step = 1; ; group = ( group + step++ ) & groups_mask)
+    {
+        size_t offset = group * GROUP_SIZE;
+
+        for(unsigned mask = group_match(&self->ctrl[offset], ctrl); mask; mask &= mask - 1)
+        {
+            size_t index = offset + mask_lowest_bit(mask);
+            if( !self->compare(self->slots[index].key, key) )
+                return index;
+        }
+
+        // The key will not be placed after a group which have empty slots.
+        if( group_match(&self->ctrl[offset], CTRL_EMPTY) )
+            return NOT_FOUND;
+    }
+}
+//------------------------------------------------------------------------------
+static
+size_t table_find_free_slot(const ccntr_man_flathash_t *self, size_t hash)
+{
+    size_t groups_mask = self->capacity / GROUP_SIZE - 1;
+    size_t group       = hash_get_group(hash) & groups_mask;
+
+    for(size_t step = 1; ; group = ( group + step++ ) & groups_mask)
+    {
+        size_t offset = group * GROUP_SIZE;
+
+        unsigned mask = group_match_free(&self->ctrl[offset]);
+        if( mask ) return offset + mask_lowest_bit(mask);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void table_resize(ccntr_man_flathash_t *self, size_t capacity)
+{
+    assert( capacity >= GROUP_SIZE && capacity % GROUP_SIZE == 0 );
+    assert( capacity > self->count );
+
+    uint8_t *ctrl         = self->ctrl;
+    slot_t  *slots        = self->slots;
+    size_t   old_capacity = self->capacity;
+
+    self->ctrl  = malloc(capacity);
+    self->slots = malloc(capacity * sizeof(slot_t));
+    if( !self->ctrl || !self->slots ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    memset(self->ctrl, CTRL_EMPTY, capacity);
+    self->capacity    = capacity;
+    self->growth_left = table_get_max_growth(capacity) - self->count;
+
+    for(size_t i = 0; i < old_capacity; ++i)
+    {
+        if( ctrl[i] & 0x80 ) continue;
+
+        size_t hash  = self->hash(slots[i].key);
+        size_t index = table_find_free_slot(self, hash);
+
+        self->ctrl[index]  = hash_get_ctrl(hash);
+        self->slots[index] = slots[i];
+    }
+
+    free(ctrl);
+    free(slots);
+}
+//------------------------------------------------------------------------------
+static
+void table_prepare_for_insertion(ccntr_man_flathash_t *self)
+{
+    if( self->growth_left ) return;
+
+    /*
+     * Grow the table if it is almost full,
+     * or just rehash to the same size to clean up deleted slots.
+     */
+    size_t capacity = self->capacity;
+    if( !capacity )
+        capacity = GROUP_SIZE;
+    else if( self->count > table_get_max_growth(capacity) / 2 )
+        capacity *= 2;
+
+    table_resize(self, capacity);
+}
+//------------------------------------------------------------------------------
+static
+void table_erase_slot(ccntr_man_flathash_t *self, size_t index)
+{
+    /*
+     * Probes of a key are terminated at the first group which have empty slots,
+     * so the slot can be marked as empty if there have other empty slots in this group,
+     * or it must be marked as deleted to let probes go on.
+     */
+    size_t offset = index & ~(size_t)( GROUP_SIZE - 1 );
+    if( group_match(&self->ctrl[offset], CTRL_EMPTY) )
+    {
+        self->ctrl[index] = CTRL_EMPTY;
+        ++ self->growth_left;
+    }
+    else
+    {
+        self->ctrl[index] = CTRL_DELETED;
+    }
+
+    assert( self->count );
+    -- self->count;
+}
+//------------------------------------------------------------------------------
+static
+slot_t* table_find_full_slot_from(const ccntr_man_flathash_t *self, size_t index)
+{
+    while( index < self->capacity )
+    {
+        size_t   offset = index & ~(size_t)( GROUP_SIZE - 1 );
+        unsigned mask   = group_match_full(&self->ctrl[offset]) >> ( index - offset ) << ( index - offset );
+        if( mask ) return &self->slots[ offset + mask_lowest_bit(mask) ];
+
+        index = offset + GROUP_SIZE;
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_iter_move_next(ccntr_man_flathash_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->slot ) return;
+
+    ccntr_man_flathash_t *container = self->container;
+
+    ccntr_spinlock_lock(&container->lock);
+    self->slot = table_find_full_slot_from(container, self->slot - container->slots + 1);
+    ccntr_spinlock_unlock(&container->lock);
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_citer_move_next(ccntr_man_flathash_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->slot ) return;
+
+    ccntr_man_flathash_t *container = (ccntr_man_flathash_t*) self->container;
+
+    ccntr_spinlock_lock(&container->lock);
+    self->slot = table_find_full_slot_from(container, self->slot - container->slots + 1);
+    ccntr_spinlock_unlock(&container->lock);
+}
+//------------------------------------------------------------------------------
+//---- Open Addressing Hash Map Container --------------------------------------
+//------------------------------------------------------------------------------
+static
+int compare_default(const void *key1, const void *key2)
+{
+    return key1 != key2;
+}
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_init(ccntr_man_flathash_t              *self,
+                             ccntr_hash_hash_key_t              hash,
+                             ccntr_hash_compare_keys_t          compare,
+                             ccntr_man_flathash_release_key_t   release_key,
+                             ccntr_man_flathash_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param hash          A function to be used to calculate hash value of keys.
+     * @param compare       A function to be used to compare keys.
+     *                      If @a hash or @a compare is NULL, then
+     *                      all keys will be treated as integral values.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     *
+     * @remarks Lower 7 bits of the hash value are used to filter slots,
+     *          and the other bits are used to select groups.
+     *          So the hash function should mix all bits of the key into the hash value
+     *          (like ccntr_hash_hash_integral) for good performance.
+     */
+    self->ctrl        = NULL;
+    self->slots       = NULL;
+    self->capacity    = 0;
+    self->growth_left = 0;
+    self->count       = 0;
+
+    self->hash    = hash ? hash : ccntr_hash_hash_integral;
+    self->compare = compare ? compare : compare_default;
+
+    self->release_key = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_destroy(ccntr_man_flathash_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_flathash_clear(self);
+}
+//------------------------------------------------------------------------------
+ccntr_man_flathash_iter_t ccntr_man_flathash_get_first(ccntr_man_flathash_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     *
+     * @remarks Values are not sorted in any particular order.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    slot_t *slot = table_find_full_slot_from(self, 0);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_flathash_iter_t iter;
+    ccntr_man_flathash_iter_init(&iter, self, slot);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_flathash_iter_t ccntr_man_flathash_find(ccntr_man_flathash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    size_t hash = self->hash(key);
+
+    ccntr_spinlock_lock(&self->lock);
+    size_t index = table_find_slot(self, hash, key);
+    slot_t *slot = ( index == NOT_FOUND )?( NULL ):( &self->slots[index] );
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_flathash_iter_t iter;
+    ccntr_man_flathash_iter_init(&iter, self, slot);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_flathash_find_value(ccntr_man_flathash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    size_t hash = self->hash(key);
+
+    ccntr_spinlock_lock(&self->lock);
+    size_t index = table_find_slot(self, hash, key);
+    void *value = ( index == NOT_FOUND )?( NULL ):( self->slots[index].value );
+    ccntr_spinlock_unlock(&self->lock);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_flathash_find_value_c(const ccntr_man_flathash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_flathash_find_value((ccntr_man_flathash_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_insert(ccntr_man_flathash_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     */
+    size_t hash = self->hash(key);
+    slot_t duplicated = { NULL, NULL };
+
+    ccntr_spinlock_lock(&self->lock);
+
+    size_t index = table_find_slot(self, hash, key);
+    bool replaced = index != NOT_FOUND;
+    if( replaced )
+    {
+        duplicated = self->slots[index];
+    }
+    else
+    {
+        table_prepare_for_insertion(self);
+
+        index = table_find_free_slot(self, hash);
+        if( self->ctrl[index] == CTRL_EMPTY )
+            -- self->growth_left;
+
+        self->ctrl[index] = hash_get_ctrl(hash);
+        ++ self->count;
+    }
+
+    self->slots[index].key   = key;
+    self->slots[index].value = value;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( replaced )
+    {
+        self->release_key(duplicated.key);
+        self->release_value(duplicated.value);
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_erase(ccntr_man_flathash_t *self, ccntr_man_flathash_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    slot_t *slot = pos->slot;
+    if( !slot ) return;
+
+    slot_t erased = *slot;
+
+    ccntr_spinlock_lock(&self->lock);
+    table_erase_slot(self, slot - self->slots);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_flathash_iter_init(pos, NULL, NULL);
+
+    self->release_key(erased.key);
+    self->release_value(erased.value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_erase_by_key(ccntr_man_flathash_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     */
+    size_t hash = self->hash(key);
+
+    ccntr_spinlock_lock(&self->lock);
+
+    size_t index = table_find_slot(self, hash, key);
+    slot_t erased = { NULL, NULL };
+    if( index != NOT_FOUND )
+    {
+        erased = self->slots[index];
+        table_erase_slot(self, index);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( index == NOT_FOUND ) return;
+
+    self->release_key(erased.key);
+    self->release_value(erased.value);
+}
+//------------------------------------------------------------------------------
+static
+void move_contents_to_shadow_object(ccntr_man_flathash_t *shadow, ccntr_man_flathash_t *src)
+{
+    ccntr_spinlock_lock(&src->lock);
+
+    *shadow = *src;
+    ccntr_spinlock_init(&shadow->lock);
+
+    src->ctrl        = NULL;
+    src->slots       = NULL;
+    src->capacity    = 0;
+    src->growth_left = 0;
+    src->count       = 0;
+
+    ccntr_spinlock_unlock(&src->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_flathash_clear(ccntr_man_flathash_t *self)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_man_flathash_t shadow;
+    move_contents_to_shadow_object(&shadow, self);
+
+    for(slot_t *slot = table_find_full_slot_from(&shadow, 0);
+        slot;
+        slot = table_find_full_slot_from(&shadow, slot - shadow.slots + 1))
+    {
+        shadow.release_key(slot->key);
+        shadow.release_value(slot->value);
+    }
+
+    free(shadow.ctrl);
+    free(shadow.slots);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_flathash_pop(ccntr_man_flathash_t *self, ccntr_man_flathash_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_flathash_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_flathash_t::ccntr_man_flathash_erase,
+     *          but just remove the value and key from the container,
+     *          and will not release them.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     * @return The value be removed from container;
+     *         or NULL if no value available.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    slot_t *slot = pos->slot;
+    if( !slot ) return NULL;
+
+    void *value = slot->value;
+
+    ccntr_spinlock_lock(&self->lock);
+    table_erase_slot(self, slot - self->slots);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_flathash_iter_init(pos, NULL, NULL);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_FLATHASH_ENABLED
@@ -254,6 +254,29 @@ void ccntr_man_list_clear(ccntr_man_list_t *self)
     }
 }
 //------------------------------------------------------------------------------
+static
+int compare_elements(const node_t *node1, const node_t *node2, void *arg)
+{
+    const element_t *ele1 = container_of(node1, element_t, node);
+    const element_t *ele2 = container_of(node2, element_t, node);
+
+    ccntr_man_list_compare_values_t compare = *(ccntr_man_list_compare_values_t*) arg;
+    return compare(ele1->value, ele2->value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_list_sort(ccntr_man_list_t *self, ccntr_man_list_compare_values_t compare)
+{
+    /**
+     * @memberof ccntr_man_list_t
+     * @brief Sort values.
+     * @details Values will be sorted in place (stable, and without extra memory).
+     *
+     * @param self    Object instance.
+     * @param compare A function to be used to compare values.
+     */
+    ccntr_list_sort(&self->super, compare_elements, &compare);
+}
+//------------------------------------------------------------------------------
 void* ccntr_man_list_pop(ccntr_man_list_t *self, ccntr_man_list_iter_t *pos)
 {
     /**
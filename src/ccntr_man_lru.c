@@ -0,0 +1,284 @@
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_lru.h"
+
+#ifdef CCNTR_MAN_LRU_ENABLED
+
+typedef ccntr_lru_node_t node_t;
+
+typedef struct element_t
+{
+    node_t  node;
+    void   *value;
+} element_t;
+
+//------------------------------------------------------------------------------
+//---- Element -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+element_t* element_create(void *key, void *value, size_t weight)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    if( !ele ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    ccntr_lru_node_init(&ele->node, key, weight);
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t                    *ele,
+                     ccntr_man_lru_release_key_t   release_key,
+                     ccntr_man_lru_release_value_t release_value)
+{
+    release_key(ele->node.map_node.key);
+    release_value(ele->value);
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void* element_release_but_keep_key_and_value(element_t *ele)
+{
+    void *value = ele->value;
+    free(ele);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+//---- LRU Cache Container -----------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_init(ccntr_man_lru_t              *self,
+                        ccntr_map_compare_keys_t      compare,
+                        size_t                        capacity,
+                        ccntr_man_lru_release_key_t   release_key,
+                        ccntr_man_lru_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param compare       A function to be used to compare keys.
+     *                      If this parameter is NULL, then
+     *                      all keys will be treated as integral values.
+     * @param capacity      The maximum total weight of values;
+     *                      or ZERO to be unlimited.
+     *                      Each value have weight 1 unless it is inserted by
+     *                      ccntr_man_lru_t::ccntr_man_lru_insert_weighted,
+     *                      so that the capacity is the maximum count of values by default.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_lru_init(&self->super, compare, capacity);
+
+    self->release_key = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_destroy(ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_lru_clear(self);
+}
+//------------------------------------------------------------------------------
+static
+void evict_overflow(ccntr_man_lru_t *self)
+{
+    node_t *node;
+    while(( node = ccntr_lru_unlink_overflow(&self->super) ))
+    {
+        element_t *ele = container_of(node, element_t, node);
+        element_release(ele, self->release_key, self->release_value);
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_set_capacity(ccntr_man_lru_t *self, size_t capacity)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Set capacity (the maximum total weight).
+     *
+     * @param self     Object instance.
+     * @param capacity The capacity; or ZERO to be unlimited.
+     *
+     * @remarks The least recently used values will be evicted
+     *          if the total weight exceeds the new capacity.
+     */
+    ccntr_lru_set_capacity(&self->super, capacity);
+    evict_overflow(self);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_lru_find_value(ccntr_man_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Find value by key.
+     * @details The value will be marked as the most recently used if found,
+     *          and the hit or miss statistics will be updated.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    node_t *node = ccntr_lru_find(&self->super, key);
+    if( !node ) return NULL;
+
+    element_t *ele = container_of(node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_lru_peek_value(ccntr_man_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Find value by key without touch it.
+     * @details Similarly to ccntr_man_lru_t::ccntr_man_lru_find_value,
+     *          but the recently used order and statistics will not be changed.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    node_t *node = ccntr_lru_peek(&self->super, key);
+    if( !node ) return NULL;
+
+    element_t *ele = container_of(node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_insert(ccntr_man_lru_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Insert a value as the most recently used one.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     *          And the least recently used values will be evicted
+     *          if the total weight exceeds the capacity.
+     */
+    ccntr_man_lru_insert_weighted(self, key, value, 1);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_insert_weighted(ccntr_man_lru_t *self, void *key, void *value, size_t weight)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Insert a value with specific weight as the most recently used one.
+     *
+     * @param self   Object instance.
+     * @param key    Key of the value to be inserted.
+     * @param value  The value to be inserted.
+     * @param weight Weight of the value (like the memory size of the value).
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     *          And the least recently used values will be evicted
+     *          if the total weight exceeds the capacity.
+     */
+    element_t *ele = element_create(key, value, weight);
+
+    node_t *node = ccntr_lru_link(&self->super, &ele->node);
+    if( node )
+    {
+        element_t *duplicated = container_of(node, element_t, node);
+        element_release(duplicated, self->release_key, self->release_value);
+    }
+
+    evict_overflow(self);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_erase_by_key(ccntr_man_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     */
+    node_t *node = ccntr_lru_unlink_by_key(&self->super, key);
+    if( !node ) return;
+
+    element_t *ele = container_of(node, element_t, node);
+    element_release(ele, self->release_key, self->release_value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_lru_clear(ccntr_man_lru_t *self)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
+
+    ccntr_list_node_t *list_node = ccntr_list_get_first(&self->super.list);
+    ccntr_map_discard_all(&self->super.map);
+    ccntr_list_discard_all(&self->super.list);
+    self->super.weight = 0;
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    while( list_node )
+    {
+        element_t *ele = container_of(list_node, element_t, node.list_node);
+        list_node = list_node->next;
+
+        element_release(ele, self->release_key, self->release_value);
+    }
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_lru_pop_by_key(ccntr_man_lru_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_lru_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_lru_t::ccntr_man_lru_erase_by_key,
+     *          but just remove the value and key from the container,
+     *          and will not release them.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     * @return The value be removed from container;
+     *         or NULL if no value available.
+     */
+    node_t *node = ccntr_lru_unlink_by_key(&self->super, key);
+    if( !node ) return NULL;
+
+    element_t *ele = container_of(node, element_t, node);
+    return element_release_but_keep_key_and_value(ele);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_LRU_ENABLED
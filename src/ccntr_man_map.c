@@ -6,20 +6,76 @@
 
 typedef ccntr_map_node_t node_t;
 
-typedef struct element_t
+typedef struct ccntr_man_map_element_t
 {
     node_t  node;
-    void   *value;
+    void   *value;      // Link of the free list when the element is not used.
 } element_t;
 
+typedef struct ccntr_man_map_slab_t
+{
+    struct ccntr_man_map_slab_t *next;
+    unsigned                     capacity;
+    unsigned                     used;
+    element_t                    elements[];
+} slab_t;
+
+/*
+ * Slabs are growing from the minimum capacity to the maximum one,
+ * so that small containers do not waste memory,
+ * and large containers do not call the allocator frequently.
+ */
+#define SLAB_MIN_CAPACITY 16
+#define SLAB_MAX_CAPACITY 1024
+
+//------------------------------------------------------------------------------
+//---- Slab Arena --------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+slab_t* slab_create(slab_t *next)
+{
+    unsigned capacity = SLAB_MIN_CAPACITY;
+    if( next )
+        capacity = 2 * next->capacity < SLAB_MAX_CAPACITY ? 2 * next->capacity : SLAB_MAX_CAPACITY;
+
+    slab_t *slab = malloc(sizeof(slab_t) + capacity * sizeof(element_t));
+    if( !slab ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    slab->next     = next;
+    slab->capacity = capacity;
+    slab->used     = 0;
+
+    return slab;
+}
+//------------------------------------------------------------------------------
+static
+void slabs_release(slab_t *slab)
+{
+    while( slab )
+    {
+        slab_t *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+}
 //------------------------------------------------------------------------------
 //---- Element -----------------------------------------------------------------
 //------------------------------------------------------------------------------
 static
-element_t* element_create(void *key, void *value)
+element_t* element_create_without_lock(ccntr_man_map_t *self, void *key, void *value)
 {
-    element_t *ele = malloc(sizeof(element_t));
-    if( !ele ) abort_message("ERROR: Cannot allocate more memory!\n");
+    element_t *ele = self->free_elements;
+    if( ele )
+    {
+        self->free_elements = ele->value;
+    }
+    else
+    {
+        if( !self->slabs || self->slabs->used == self->slabs->capacity )
+            self->slabs = slab_create(self->slabs);
+
+        ele = &self->slabs->elements[ self->slabs->used ++ ];
+    }
 
     ele->node.key = key;
     ele->value = value;
@@ -28,22 +84,39 @@ element_t* element_create(void *key, void *value)
 }
 //------------------------------------------------------------------------------
 static
-void element_release(element_t                    *ele,
-                     ccntr_man_map_release_key_t   release_key,
-                     ccntr_man_map_release_value_t release_value)
+void element_free_without_lock(ccntr_man_map_t *self, element_t *ele)
 {
-    release_key(ele->node.key);
-    release_value(ele->value);
-    free(ele);
+    ele->value = self->free_elements;
+    self->free_elements = ele;
 }
 //------------------------------------------------------------------------------
 static
-void* element_release_but_keep_key_and_value(element_t *ele)
+void element_release(ccntr_man_map_t *self, element_t *ele)
 {
+    // The key and value are read under the lock,
+    // because slabs may be released by clearing concurrently.
+    ccntr_spinlock_lock(&self->super.lock);
+    void *key   = ele->node.key;
     void *value = ele->value;
-    free(ele);
+    element_free_without_lock(self, ele);
+    ccntr_spinlock_unlock(&self->super.lock);
 
-    return value;
+    self->release_key(key);
+    self->release_value(value);
+}
+//------------------------------------------------------------------------------
+static
+void element_unlink_and_release(ccntr_man_map_t *self, element_t *ele)
+{
+    ccntr_spinlock_lock(&self->super.lock);
+    void *key   = ele->node.key;
+    void *value = ele->value;
+    ccntr_map_unlink_without_lock(&self->super, &ele->node);
+    element_free_without_lock(self, ele);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    self->release_key(key);
+    self->release_value(value);
 }
 //------------------------------------------------------------------------------
 //---- Iterator ----------------------------------------------------------------
@@ -118,6 +191,9 @@ void ccntr_man_map_init(ccntr_man_map_t              *self,
 
     self->release_key = release_key ? release_key : release_key_default;
     self->release_value = release_value ? release_value : release_value_default;
+
+    self->slabs         = NULL;
+    self->free_elements = NULL;
 }
 //------------------------------------------------------------------------------
 void ccntr_man_map_destroy(ccntr_man_map_t *self)
@@ -253,14 +329,125 @@ void ccntr_man_map_insert(ccntr_man_map_t *self, void *key, void *value)
      * @remarks If the container already have a value with the same key, then
      *          the old value (and key) will be replaced by the new one.
      */
-    element_t *ele = element_create(key, value);
+    ccntr_spinlock_lock(&self->super.lock);
+
+    element_t *ele = element_create_without_lock(self, key, value);
+
+    void *key_old = NULL, *value_old = NULL;
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(&self->super, key, &comp_res);
+    bool replaced = closest && !comp_res;
+    if( replaced )
+    {
+        element_t *duplicated = container_of(closest, element_t, node);
+        key_old   = duplicated->node.key;
+        value_old = duplicated->value;
+
+        ccntr_map_replace_without_lock(&self->super, closest, &ele->node);
+        element_free_without_lock(self, duplicated);
+    }
+    else
+    {
+        ccntr_map_link_child_without_lock(&self->super, closest, comp_res < 0, &ele->node);
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( replaced )
+    {
+        self->release_key(key_old);
+        self->release_value(value_old);
+    }
+}
+//------------------------------------------------------------------------------
+bool ccntr_man_map_upsert(ccntr_man_map_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Insert a value, or update the value in place if the key is existed.
+     * @details Comparing to ccntr_man_map_t::ccntr_man_map_insert,
+     *          the tree is searched once, and no element be created
+     *          or released if the key is already existed.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     * @return TRUE if a new value is inserted;
+     *         and FALSE if an existed value is updated.
+     *
+     * @remarks If the key is already existed, then the old value
+     *          and the input key will be released, and the old key will be kept.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
+
+    void *value_old = NULL;
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(&self->super, key, &comp_res);
+    bool inserted = !closest || comp_res;
+    if( inserted )
+    {
+        element_t *ele = element_create_without_lock(self, key, value);
+        ccntr_map_link_child_without_lock(&self->super, closest, comp_res < 0, &ele->node);
+    }
+    else
+    {
+        element_t *ele = container_of(closest, element_t, node);
+        value_old = ele->value;
+        ele->value = value;
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( !inserted )
+    {
+        self->release_key(key);
+        self->release_value(value_old);
+    }
+
+    return inserted;
+}
+//------------------------------------------------------------------------------
+void** ccntr_man_map_find_or_insert(ccntr_man_map_t *self, void *key, bool *inserted)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Find a value, or insert an empty value if the key is not existed.
+     * @details The tree is searched once, and an element will be created
+     *          only if the key is not existed,
+     *          so that the value can be constructed lazily by the caller.
+     *
+     * @param self     Object instance.
+     * @param key      Key of the value.
+     * @param inserted Returns TRUE if a new element is inserted;
+     *                 and FALSE if the key is already existed.
+     *                 This parameter can be NULL if the result is not needed.
+     * @return The storage of the value.
+     *         The storage of a new element will be set to NULL,
+     *         and the caller should store the value to it.
+     *
+     * @remarks The container will own the input key only if a new element is inserted.
+     * @attention The storage will be invalid after the value be erased.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
 
-    node_t *node = ccntr_map_link(&self->super, &ele->node);
-    if( node )
+    element_t *ele;
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(&self->super, key, &comp_res);
+    bool is_new = !closest || comp_res;
+    if( is_new )
+    {
+        ele = element_create_without_lock(self, key, NULL);
+        ccntr_map_link_child_without_lock(&self->super, closest, comp_res < 0, &ele->node);
+    }
+    else
     {
-        element_t *duplicated = container_of(node, element_t, node);
-        element_release(duplicated, self->release_key, self->release_value);
+        ele = container_of(closest, element_t, node);
     }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( inserted ) *inserted = is_new;
+    return &ele->value;
 }
 //------------------------------------------------------------------------------
 void ccntr_man_map_erase(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos)
@@ -278,11 +465,10 @@ void ccntr_man_map_erase(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos)
     node_t *node = pos->node;
     if( !node ) return;
 
-    ccntr_map_unlink(&self->super, node);
     ccntr_man_map_iter_init(pos, NULL, NULL);
 
     element_t *ele = container_of(node, element_t, node);
-    element_release(ele, self->release_key, self->release_value);
+    element_unlink_and_release(self, ele);
 }
 //------------------------------------------------------------------------------
 void ccntr_man_map_erase_by_key(ccntr_man_map_t *self, const void *key)
@@ -294,11 +480,79 @@ void ccntr_man_map_erase_by_key(ccntr_man_map_t *self, const void *key)
      * @param self Object instance.
      * @param key  Key of the value.
      */
-    node_t *node = ccntr_map_unlink_by_key(&self->super, key);
-    if( !node ) return;
+    ccntr_spinlock_lock(&self->super.lock);
 
-    element_t *ele = container_of(node, element_t, node);
-    element_release(ele, self->release_key, self->release_value);
+    int comp_res;
+    node_t *node = ccntr_map_find_closest_without_lock(&self->super, key, &comp_res);
+    bool found = node && !comp_res;
+
+    void *key_old = NULL, *value_old = NULL;
+    if( found )
+    {
+        element_t *ele = container_of(node, element_t, node);
+        key_old   = ele->node.key;
+        value_old = ele->value;
+
+        ccntr_map_unlink_without_lock(&self->super, node);
+        element_free_without_lock(self, ele);
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( found )
+    {
+        self->release_key(key_old);
+        self->release_value(value_old);
+    }
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_man_map_erase_range(ccntr_man_map_t *self, const void *lower, const void *upper)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Erase all values which have keys in a range.
+     *
+     * @param self  Object instance.
+     * @param lower The lower bound of keys (inclusive).
+     * @param upper The upper bound of keys (exclusive).
+     * @return Count of values be erased.
+     */
+    ccntr_map_t removed;
+    ccntr_map_init(&removed, self->super.compare);
+
+    // Keys and values are copied out, and elements are returned to the arena
+    // before the lock be released, because slabs may be released by clearing concurrently.
+    // Then keys and values are released without the lock.
+    ccntr_spinlock_lock(&self->super.lock);
+
+    unsigned count = ccntr_map_unlink_range_without_lock(&self->super, lower, upper, &removed);
+
+    void **pairs = count ? malloc(2 * count * sizeof(void*)) : NULL;
+    if( count && !pairs ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    unsigned index = 0;
+    node_t *node = ccntr_map_get_first_postorder(&removed);
+    while( node )
+    {
+        element_t *ele = container_of(node, element_t, node);
+        node = ccntr_map_node_get_next_postorder(node);
+
+        pairs[ index ++ ] = ele->node.key;
+        pairs[ index ++ ] = ele->value;
+        element_free_without_lock(self, ele);
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    for(index = 0; index < 2 * count; index += 2)
+    {
+        self->release_key(pairs[index]);
+        self->release_value(pairs[ index + 1 ]);
+    }
+
+    free(pairs);
+
+    return count;
 }
 //------------------------------------------------------------------------------
 static
@@ -310,8 +564,12 @@ void move_contents_to_shadow_object(ccntr_man_map_t *shadow, ccntr_man_map_t *sr
     ccntr_spinlock_init(&shadow->super.lock);
 
     src->super.root  = NULL;
+    src->super.last  = NULL;
     src->super.count = 0;
 
+    src->slabs         = NULL;
+    src->free_elements = NULL;
+
     ccntr_spinlock_unlock(&src->super.lock);
 }
 //------------------------------------------------------------------------------
@@ -326,14 +584,74 @@ void ccntr_man_map_clear(ccntr_man_map_t *self)
     ccntr_man_map_t shadow;
     move_contents_to_shadow_object(&shadow, self);
 
-    node_t *node = ccntr_map_get_first_postorder(&shadow.super);
-    while( node )
+    // Elements are released with their slabs,
+    // and the tree is walked only if there are keys or values to be released.
+    if( shadow.release_key != release_key_default || shadow.release_value != release_value_default )
     {
-        element_t *ele = container_of(node, element_t, node);
-        node = ccntr_map_node_get_next_postorder(node);
-
-        element_release(ele, shadow.release_key, shadow.release_value);
+        for(node_t *node = ccntr_map_get_first_postorder(&shadow.super);
+            node;
+            node = ccntr_map_node_get_next_postorder(node))
+        {
+            element_t *ele = container_of(node, element_t, node);
+            shadow.release_key(ele->node.key);
+            shadow.release_value(ele->value);
+        }
     }
+
+    slabs_release(shadow.slabs);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_map_discard_all(ccntr_man_map_t *self)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Erase all values it contained, but not release keys and values.
+     * @details This function is used when all keys and values
+     *          have already be moved to other owners.
+     *
+     * @param self Object instance.
+     */
+    ccntr_man_map_t shadow;
+    move_contents_to_shadow_object(&shadow, self);
+
+    slabs_release(shadow.slabs);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_map_build_sorted(ccntr_man_map_t *self,
+                                void *const     *keys,
+                                void *const     *values,
+                                unsigned         count)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Replace all values by values which are already sorted in linear time.
+     *
+     * @param self   Object instance.
+     * @param keys   Keys of values to be inserted, which must be sorted in ascending order,
+     *               and must not have duplicated keys.
+     * @param values Values to be inserted.
+     * @param count  Count of keys and values.
+     *
+     * @remarks All existing values of the container will be erased.
+     */
+    ccntr_man_map_clear(self);
+    if( !count ) return;
+
+    node_t **nodes = malloc(count * sizeof(node_t*));
+    if( !nodes ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    // Elements are linked before the lock be released,
+    // or they may be released with slabs by clearing concurrently.
+    ccntr_spinlock_lock(&self->super.lock);
+
+    for(unsigned i = 0; i < count; ++i)
+        nodes[i] = &element_create_without_lock(self, keys[i], values[i])->node;
+
+    ccntr_map_build_sorted_without_lock(&self->super, nodes, count);
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    free(nodes);
 }
 //------------------------------------------------------------------------------
 void* ccntr_man_map_pop(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos)
@@ -356,11 +674,105 @@ void* ccntr_man_map_pop(ccntr_man_map_t *self, ccntr_man_map_iter_t *pos)
     node_t *node = pos->node;
     if( !node ) return NULL;
 
-    ccntr_map_unlink(&self->super, node);
     ccntr_man_map_iter_init(pos, NULL, pos->node);
 
     element_t *ele = container_of(node, element_t, node);
-    return element_release_but_keep_key_and_value(ele);
+
+    ccntr_spinlock_lock(&self->super.lock);
+    void *value = ele->value;
+    ccntr_map_unlink_without_lock(&self->super, node);
+    element_free_without_lock(self, ele);
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+ccntr_map_node_t* ccntr_man_map_create_node_without_lock(ccntr_man_map_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Create a node with a key and a value.
+     * @details This function is used by specialised containers which
+     *          search the tree by their self, and link the node by
+     *          ccntr_map_t::ccntr_map_link_child_without_lock.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value.
+     * @param value The value.
+     * @return The new node which is not linked in any container.
+     *
+     * @attention The lock of the container must be held by the caller,
+     *            and the node must be linked before the lock be released,
+     *            because the node is allocated from slabs of the container.
+     */
+    element_t *ele = element_create_without_lock(self, key, value);
+    return &ele->node;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_map_release_node(ccntr_man_map_t *self, ccntr_map_node_t *node)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Release a node (and the key and value of it)
+     *        which is created by ccntr_man_map_t::ccntr_man_map_create_node_without_lock.
+     *
+     * @param self Object instance.
+     * @param node The node which is not linked in any container.
+     *
+     * @attention The node must not be unlinked in another critical section,
+     *            or it may be released by clearing concurrently.
+     *            Use ccntr_man_map_t::ccntr_man_map_release_node_without_lock
+     *            for nodes which are unlinked by the caller.
+     */
+    element_t *ele = container_of(node, element_t, node);
+    element_release(self, ele);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_map_release_node_without_lock(ccntr_man_map_t  *self,
+                                             ccntr_map_node_t *node,
+                                             void            **key,
+                                             void            **value)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Return a node to the container without releasing its key and value.
+     * @details This function is used by specialised containers which
+     *          unlink or replace the node by their self,
+     *          and the key and value should be released after the lock be released.
+     *
+     * @param self  Object instance.
+     * @param node  The node which is created by
+     *              ccntr_man_map_t::ccntr_man_map_create_node_without_lock,
+     *              and is not linked in any container.
+     * @param key   Return the key of the node.
+     * @param value Return the value of the node.
+     *              The key and value can be released by
+     *              ccntr_man_map_t::ccntr_man_map_release_key_value.
+     *
+     * @attention The lock of the container must be held by the caller,
+     *            and the node must be unlinked in the same critical section,
+     *            because slabs may be released by clearing concurrently.
+     */
+    element_t *ele = container_of(node, element_t, node);
+    *key   = ele->node.key;
+    *value = ele->value;
+    element_free_without_lock(self, ele);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_map_release_key_value(ccntr_man_map_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_map_t
+     * @brief Release a key and a value by the release functions of the container.
+     *
+     * @param self  Object instance.
+     * @param key   The key to be released.
+     * @param value The value to be released.
+     *
+     * @remarks The lock of the container should not be held by the caller.
+     */
+    self->release_key(key);
+    self->release_value(value);
 }
 //------------------------------------------------------------------------------
 
@@ -0,0 +1,789 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_pmap.h"
+
+#ifdef CCNTR_MAN_PMAP_ENABLED
+
+#define ATOMIC_UINT(var) ( (atomic_uint*) &(var) )
+#define ATOMIC_SNAP(var) ( (_Atomic(snap_t*)*) &(var) )
+
+typedef struct ccntr_man_pmap_snap_t snap_t;
+
+/*
+ * Keys and values are shared by all copies of a node,
+ * and be released when the last copy is released.
+ */
+typedef struct entry_t
+{
+    unsigned  refcnt;
+    void     *key;
+    void     *value;
+} entry_t;
+
+/*
+ * Nodes are immutable after they are published,
+ * and be shared by all versions which can reach them.
+ */
+typedef struct ccntr_man_pmap_node_t
+{
+    struct ccntr_man_pmap_node_t *left;
+    struct ccntr_man_pmap_node_t *right;
+
+    void     *key;  // The same as the key of the entry, to save an indirection on searching.
+    entry_t  *entry;
+    unsigned  refcnt;
+    bool      is_red;
+} node_t;
+
+struct ccntr_man_pmap_snap_t
+{
+    ccntr_epoch_node_t  retired;
+    ccntr_man_pmap_t   *owner;
+    node_t             *root;
+    unsigned            count;
+    unsigned            refcnt;     // Snapshots, and the container if it is the current version.
+};
+
+//------------------------------------------------------------------------------
+//---- Entry -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+entry_t* entry_create(void *key, void *value)
+{
+    entry_t *entry = malloc(sizeof(entry_t));
+    if( !entry ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    atomic_init(ATOMIC_UINT(entry->refcnt), 1);
+    entry->key   = key;
+    entry->value = value;
+
+    return entry;
+}
+//------------------------------------------------------------------------------
+static
+entry_t* entry_ref(entry_t *entry)
+{
+    atomic_fetch_add(ATOMIC_UINT(entry->refcnt), 1);
+    return entry;
+}
+//------------------------------------------------------------------------------
+static
+void entry_unref(const ccntr_man_pmap_t *owner, entry_t *entry)
+{
+    if( atomic_fetch_sub(ATOMIC_UINT(entry->refcnt), 1) != 1 ) return;
+
+    owner->release_key(entry->key);
+    owner->release_value(entry->value);
+    free(entry);
+}
+//------------------------------------------------------------------------------
+//---- Node --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+/*
+ * All the following functions take the ownership of the node (and entry)
+ * references which are passed in, and return owned references.
+ */
+//------------------------------------------------------------------------------
+static
+node_t* node_create(bool is_red, node_t *left, entry_t *entry, node_t *right)
+{
+    node_t *node = malloc(sizeof(node_t));
+    if( !node ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    atomic_init(ATOMIC_UINT(node->refcnt), 1);
+    node->left   = left;
+    node->right  = right;
+    node->key    = entry->key;
+    node->entry  = entry;
+    node->is_red = is_red;
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+node_t* node_ref(node_t *node)
+{
+    if( node ) atomic_fetch_add(ATOMIC_UINT(node->refcnt), 1);
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+void node_unref(const ccntr_man_pmap_t *owner, node_t *node)
+{
+    while( node && atomic_fetch_sub(ATOMIC_UINT(node->refcnt), 1) == 1 )
+    {
+        node_t *right = node->right;
+
+        node_unref(owner, node->left);
+        entry_unref(owner, node->entry);
+        free(node);
+
+        node = right;
+    }
+}
+//------------------------------------------------------------------------------
+static
+void node_take(const ccntr_man_pmap_t *owner,
+               node_t                 *node,
+               node_t                **left,
+               entry_t               **entry,
+               node_t                **right)
+{
+    // Take the members of a node, and give up the reference of the node.
+
+    if( atomic_load(ATOMIC_UINT(node->refcnt)) == 1 )
+    {
+        // Nobody else can reach the node, so that its references can be moved.
+        *left  = node->left;
+        *entry = node->entry;
+        *right = node->right;
+        free(node);
+    }
+    else
+    {
+        *left  = node_ref(node->left);
+        *entry = entry_ref(node->entry);
+        *right = node_ref(node->right);
+        node_unref(owner, node);
+    }
+}
+//------------------------------------------------------------------------------
+static inline
+bool node_is_red(const node_t *node)
+{
+    return node && node->is_red;
+}
+//------------------------------------------------------------------------------
+static inline
+bool node_is_black(const node_t *node)
+{
+    // Check if it is a black node, and not an empty tree.
+    return node && !node->is_red;
+}
+//------------------------------------------------------------------------------
+static
+node_t* node_recolour(const ccntr_man_pmap_t *owner, node_t *node, bool is_red)
+{
+    if( !node || node->is_red == is_red ) return node;
+
+    if( atomic_load(ATOMIC_UINT(node->refcnt)) == 1 )
+    {
+        // Nobody else can reach the node, so that it can be modified.
+        node->is_red = is_red;
+        return node;
+    }
+
+    node_t  *left, *right;
+    entry_t *entry;
+    node_take(owner, node, &left, &entry, &right);
+
+    return node_create(is_red, left, entry, right);
+}
+//------------------------------------------------------------------------------
+//---- Tree Operations ---------------------------------------------------------
+//------------------------------------------------------------------------------
+/*
+ * Insertion and deletion are implemented by the functional red-black tree
+ * algorithms (Okasaki's balance and Kahrs' deletion),
+ * so that nodes are never modified after they are shared.
+ */
+//------------------------------------------------------------------------------
+static
+node_t* tree_balance(const ccntr_man_pmap_t *owner, node_t *a, entry_t *x, node_t *b)
+{
+    node_t  *t1, *t2, *t3, *t4, *t5;
+    entry_t *e1, *e2;
+
+    if( node_is_red(a) && node_is_red(b) )
+    {
+        node_take(owner, a, &t1, &e1, &t2);
+        node_take(owner, b, &t3, &e2, &t4);
+        return node_create(true,
+                           node_create(false, t1, e1, t2),
+                           x,
+                           node_create(false, t3, e2, t4));
+    }
+
+    if( node_is_red(a) && node_is_red(a->left) )
+    {
+        node_take(owner, a, &t5, &e2, &t3);
+        node_take(owner, t5, &t1, &e1, &t2);
+        return node_create(true,
+                           node_create(false, t1, e1, t2),
+                           e2,
+                           node_create(false, t3, x, b));
+    }
+
+    if( node_is_red(a) && node_is_red(a->right) )
+    {
+        node_take(owner, a, &t1, &e1, &t5);
+        node_take(owner, t5, &t2, &e2, &t3);
+        return node_create(true,
+                           node_create(false, t1, e1, t2),
+                           e2,
+                           node_create(false, t3, x, b));
+    }
+
+    if( node_is_red(b) && node_is_red(b->right) )
+    {
+        node_take(owner, b, &t2, &e1, &t5);
+        node_take(owner, t5, &t3, &e2, &t4);
+        return node_create(true,
+                           node_create(false, a, x, t2),
+                           e1,
+                           node_create(false, t3, e2, t4));
+    }
+
+    if( node_is_red(b) && node_is_red(b->left) )
+    {
+        node_take(owner, b, &t5, &e2, &t4);
+        node_take(owner, t5, &t2, &e1, &t3);
+        return node_create(true,
+                           node_create(false, a, x, t2),
+                           e1,
+                           node_create(false, t3, e2, t4));
+    }
+
+    return node_create(false, a, x, b);
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_insert(const ccntr_man_pmap_t *owner, node_t *tree, entry_t *entry, bool *replaced)
+{
+    if( !tree ) return node_create(true, NULL, entry, NULL);
+
+    int      cmp    = owner->compare(entry->key, tree->key);
+    bool     is_red = tree->is_red;
+    node_t  *left, *right;
+    entry_t *x;
+    node_take(owner, tree, &left, &x, &right);
+
+    if( cmp < 0 )
+    {
+        left = tree_insert(owner, left, entry, replaced);
+        return is_red ? node_create(true, left, x, right) : tree_balance(owner, left, x, right);
+    }
+    else if( cmp > 0 )
+    {
+        right = tree_insert(owner, right, entry, replaced);
+        return is_red ? node_create(true, left, x, right) : tree_balance(owner, left, x, right);
+    }
+    else
+    {
+        *replaced = true;
+        entry_unref(owner, x);
+        return node_create(is_red, left, entry, right);
+    }
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_balance_left(const ccntr_man_pmap_t *owner, node_t *a, entry_t *x, node_t *b)
+{
+    // Rebalance after the black height of the left subtree was decreased.
+
+    node_t  *t1, *t2, *t3, *t4;
+    entry_t *e1, *e2;
+
+    if( node_is_red(a) )
+        return node_create(true, node_recolour(owner, a, false), x, b);
+
+    if( node_is_black(b) )
+        return tree_balance(owner, a, x, node_recolour(owner, b, true));
+
+    assert( node_is_red(b) && node_is_black(b->left) );
+    node_take(owner, b, &t4, &e2, &t3);
+    node_take(owner, t4, &t1, &e1, &t2);
+    return node_create(true,
+                       node_create(false, a, x, t1),
+                       e1,
+                       tree_balance(owner, t2, e2, node_recolour(owner, t3, true)));
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_balance_right(const ccntr_man_pmap_t *owner, node_t *a, entry_t *x, node_t *b)
+{
+    // Rebalance after the black height of the right subtree was decreased.
+
+    node_t  *t1, *t2, *t3, *t4;
+    entry_t *e1, *e2;
+
+    if( node_is_red(b) )
+        return node_create(true, a, x, node_recolour(owner, b, false));
+
+    if( node_is_black(a) )
+        return tree_balance(owner, node_recolour(owner, a, true), x, b);
+
+    assert( node_is_red(a) && node_is_black(a->right) );
+    node_take(owner, a, &t1, &e1, &t4);
+    node_take(owner, t4, &t2, &e2, &t3);
+    return node_create(true,
+                       tree_balance(owner, node_recolour(owner, t1, true), e1, t2),
+                       e2,
+                       node_create(false, t3, x, b));
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_append(const ccntr_man_pmap_t *owner, node_t *a, node_t *b)
+{
+    // Concatenate two trees with the same black height,
+    // and all keys of the left tree are less than the right one.
+
+    if( !a ) return b;
+    if( !b ) return a;
+
+    node_t  *t1, *t2, *t3, *t4, *t5, *t6;
+    entry_t *e1, *e2, *e3;
+
+    if( a->is_red && b->is_red )
+    {
+        node_take(owner, a, &t1, &e1, &t2);
+        node_take(owner, b, &t3, &e2, &t4);
+
+        node_t *mid = tree_append(owner, t2, t3);
+        if( node_is_red(mid) )
+        {
+            node_take(owner, mid, &t5, &e3, &t6);
+            return node_create(true,
+                               node_create(true, t1, e1, t5),
+                               e3,
+                               node_create(true, t6, e2, t4));
+        }
+
+        return node_create(true, t1, e1, node_create(true, mid, e2, t4));
+    }
+
+    if( !a->is_red && !b->is_red )
+    {
+        node_take(owner, a, &t1, &e1, &t2);
+        node_take(owner, b, &t3, &e2, &t4);
+
+        node_t *mid = tree_append(owner, t2, t3);
+        if( node_is_red(mid) )
+        {
+            node_take(owner, mid, &t5, &e3, &t6);
+            return node_create(true,
+                               node_create(false, t1, e1, t5),
+                               e3,
+                               node_create(false, t6, e2, t4));
+        }
+
+        return tree_balance_left(owner, t1, e1, node_create(false, mid, e2, t4));
+    }
+
+    if( b->is_red )
+    {
+        node_take(owner, b, &t1, &e1, &t2);
+        return node_create(true, tree_append(owner, a, t1), e1, t2);
+    }
+
+    node_take(owner, a, &t1, &e1, &t2);
+    return node_create(true, t1, e1, tree_append(owner, t2, b));
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_erase(const ccntr_man_pmap_t *owner, node_t *tree, const void *key)
+{
+    // The key must be contained in the tree.
+
+    int      cmp = owner->compare(key, tree->key);
+    node_t  *left, *right;
+    entry_t *x;
+
+    if( cmp < 0 )
+    {
+        bool left_black = node_is_black(tree->left);
+        node_take(owner, tree, &left, &x, &right);
+
+        left = tree_erase(owner, left, key);
+        return left_black ?
+               tree_balance_left(owner, left, x, right) :
+               node_create(true, left, x, right);
+    }
+    else if( cmp > 0 )
+    {
+        bool right_black = node_is_black(tree->right);
+        node_take(owner, tree, &left, &x, &right);
+
+        right = tree_erase(owner, right, key);
+        return right_black ?
+               tree_balance_right(owner, left, x, right) :
+               node_create(true, left, x, right);
+    }
+    else
+    {
+        node_take(owner, tree, &left, &x, &right);
+        entry_unref(owner, x);
+        return tree_append(owner, left, right);
+    }
+}
+//------------------------------------------------------------------------------
+static
+const node_t* tree_find(const ccntr_man_pmap_t *owner, const node_t *tree, const void *key)
+{
+    while( tree )
+    {
+        int cmp = owner->compare(key, tree->key);
+        if( cmp == 0 ) break;
+
+        tree = ( cmp < 0 )?( tree->left ):( tree->right );
+    }
+
+    return tree;
+}
+//------------------------------------------------------------------------------
+//---- Snapshot ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+snap_t* snap_create(ccntr_man_pmap_t *owner, node_t *root, unsigned count)
+{
+    snap_t *snap = malloc(sizeof(snap_t));
+    if( !snap ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    atomic_init(ATOMIC_UINT(snap->refcnt), 1);
+    snap->owner = owner;
+    snap->root  = root;
+    snap->count = count;
+
+    return snap;
+}
+//------------------------------------------------------------------------------
+static
+void snap_release_retired(ccntr_epoch_node_t *retired)
+{
+    // Drop the reference of the container after the grace period.
+    ccntr_man_pmap_snap_release(container_of(retired, snap_t, retired));
+}
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_snap_release(snap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_snap_t
+     * @brief Release the snapshot.
+     * @details Nodes and values which are not accessible by any versions
+     *          will be released.
+     *
+     * @param self Object instance.
+     */
+    if( atomic_fetch_sub(ATOMIC_UINT(self->refcnt), 1) != 1 ) return;
+
+    node_unref(self->owner, self->root);
+    free(self);
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_man_pmap_snap_get_count(const snap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_snap_t
+     * @brief Get count of values it contained.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    return self->count;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_pmap_snap_find_value(const snap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_pmap_snap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; and NULL if not found.
+     */
+    const node_t *node = tree_find(self->owner, self->root, key);
+    return node ? node->entry->value : NULL;
+}
+//------------------------------------------------------------------------------
+static
+void citer_push_left(ccntr_man_pmap_citer_t *self, const node_t *node)
+{
+    for(; node; node = node->left)
+        self->stack[ self->depth ++ ] = node;
+}
+//------------------------------------------------------------------------------
+ccntr_man_pmap_citer_t ccntr_man_pmap_snap_get_first(const snap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_snap_t
+     * @brief Get the first value (in order).
+     *
+     * @param self Object instance.
+     * @return An iterator point to the first value.
+     */
+    ccntr_man_pmap_citer_t iter;
+    iter.depth = 0;
+    citer_push_left(&iter, self->root);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_pmap_citer_t ccntr_man_pmap_snap_find_nearest_great(const snap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_pmap_snap_t
+     * @brief Find value with nearest key which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator point to the value if found;
+     *         or an iterator point to nothing if not found.
+     */
+    ccntr_man_pmap_citer_t iter;
+    iter.depth = 0;
+
+    // Only nodes with greater keys are kept in the stack,
+    // and they are the nodes will be visited later.
+    const node_t *node = self->root;
+    while( node )
+    {
+        int cmp = self->owner->compare(key, node->key);
+        if( cmp <= 0 )
+            iter.stack[ iter.depth ++ ] = node;
+
+        if( cmp == 0 ) break;
+        node = ( cmp < 0 )?( node->left ):( node->right );
+    }
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_citer_move_next(ccntr_man_pmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->depth ) return;
+
+    const node_t *node = self->stack[ -- self->depth ];
+    citer_push_left(self, node->right);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_pmap_citer_get_key(const ccntr_man_pmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    return self->depth ? self->stack[ self->depth - 1 ]->key : NULL;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_pmap_citer_get_value(const ccntr_man_pmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->depth ? self->stack[ self->depth - 1 ]->entry->value : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Persistent Key Map Container --------------------------------------------
+//------------------------------------------------------------------------------
+static
+int compare_default(const void *key1, const void *key2)
+{
+    return ( (intptr_t) key1 > (intptr_t) key2 ) - ( (intptr_t) key1 < (intptr_t) key2 );
+}
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void publish_without_lock(ccntr_man_pmap_t *self, node_t *root, unsigned count)
+{
+    // Replace the current version, and retire the old one.
+
+    snap_t *old = self->current;
+    atomic_store(ATOMIC_SNAP(self->current), snap_create(self, root, count));
+
+    // Readers may be getting the old version, and must be waited.
+    ccntr_epoch_retire(&self->epoch, &old->retired, snap_release_retired);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_init(ccntr_man_pmap_t              *self,
+                         ccntr_map_compare_keys_t       compare,
+                         ccntr_man_pmap_release_key_t   release_key,
+                         ccntr_man_pmap_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param compare       A function to be used to compare keys.
+     *                      If this parameter is NULL, then
+     *                      all keys will be treated as integral values.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_epoch_init(&self->epoch);
+    ccntr_spinlock_init(&self->lock);
+
+    self->compare       = compare ? compare : compare_default;
+    self->release_key   = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+
+    atomic_init(ATOMIC_SNAP(self->current), snap_create(self, NULL, 0));
+}
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_destroy(ccntr_man_pmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     *            All snapshots must be released before the container be destructed.
+     */
+    ccntr_epoch_destroy(&self->epoch);
+
+    ccntr_man_pmap_snap_release(self->current);
+    self->current = NULL;
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_man_pmap_get_count(const ccntr_man_pmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Get count of values of the current version.
+     *
+     * @param self Object instance.
+     * @return The count of values.
+     */
+    ccntr_epoch_t *epoch = (ccntr_epoch_t*) &self->epoch;
+
+    unsigned ticket = ccntr_epoch_read_lock(epoch);
+    unsigned count  = atomic_load(ATOMIC_SNAP(self->current))->count;
+    ccntr_epoch_read_unlock(epoch, ticket);
+
+    return count;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_insert(ccntr_man_pmap_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Insert a value, and publish a new version.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one,
+     *          and be released after all versions which contain it are released.
+     */
+    entry_t *entry    = entry_create(key, value);
+    bool     replaced = false;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    const snap_t *current = self->current;
+    node_t *root = tree_insert(self, node_ref(current->root), entry, &replaced);
+    root = node_recolour(self, root, false);
+
+    publish_without_lock(self, root, current->count + !replaced);
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+bool ccntr_man_pmap_erase_by_key(ccntr_man_pmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Erase value, and publish a new version.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     * @return TRUE if the value is found and erased; and FALSE if not found.
+     *
+     * @remarks The value will be released after all versions which contain it are released.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    const snap_t *current = self->current;
+    bool found = tree_find(self, current->root, key);
+    if( found )
+    {
+        node_t *root = tree_erase(self, node_ref(current->root), key);
+        root = node_recolour(self, root, false);
+
+        publish_without_lock(self, root, current->count - 1);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return found;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_pmap_clear(ccntr_man_pmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Erase all values, and publish an empty version.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    publish_without_lock(self, NULL, 0);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+snap_t* ccntr_man_pmap_get_snapshot(ccntr_man_pmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_pmap_t
+     * @brief Get a snapshot of the current version.
+     * @details The snapshot will not be changed by further modifications,
+     *          and can be read without locks until it be released.
+     *
+     * @param self Object instance.
+     * @return The snapshot, and must be released by
+     *         ccntr_man_pmap_snap_t::ccntr_man_pmap_snap_release.
+     */
+    unsigned ticket = ccntr_epoch_read_lock(&self->epoch);
+
+    // The version can not be released in the read section,
+    // because the reference of the container is dropped after the grace period.
+    snap_t *snap = atomic_load(ATOMIC_SNAP(self->current));
+    atomic_fetch_add(ATOMIC_UINT(snap->refcnt), 1);
+
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+
+    return snap;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_PMAP_ENABLED
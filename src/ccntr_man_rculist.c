@@ -0,0 +1,234 @@
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_rculist.h"
+
+#ifdef CCNTR_MAN_RCULIST_ENABLED
+
+typedef ccntr_rculist_node_t node_t;
+
+typedef struct element_t
+{
+    ccntr_epoch_node_t   retired;
+    ccntr_man_rculist_t *owner;
+    void                *value;
+    node_t               node;
+} element_t;
+
+//------------------------------------------------------------------------------
+//---- Element -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+element_t* element_create(ccntr_man_rculist_t *owner, void *value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    if( !ele ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    ele->owner = owner;
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release_retired(ccntr_epoch_node_t *retired)
+{
+    element_t *ele = container_of(retired, element_t, retired);
+
+    ele->owner->release_value(ele->value);
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void element_retire(element_t *ele)
+{
+    // The element may still be accessed by readers, and will be released later.
+    ccntr_epoch_retire(&ele->owner->epoch, &ele->retired, element_release_retired);
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void* ccntr_man_rculist_iter_get_value(ccntr_man_rculist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->node ) return NULL;
+
+    element_t *ele = container_of(self->node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+const void* ccntr_man_rculist_citer_get_value(const ccntr_man_rculist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->node ) return NULL;
+
+    element_t *ele = container_of(self->node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+//---- Read-Mostly List --------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_init(ccntr_man_rculist_t *self, ccntr_man_rculist_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_rculist_init(&self->super);
+    ccntr_epoch_init(&self->epoch);
+
+    self->release_value = release_value ? release_value : release_value_default;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_destroy(ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_rculist_clear(self);
+    ccntr_epoch_destroy(&self->epoch);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_insert(ccntr_man_rculist_t *self, ccntr_man_rculist_iter_t *pos, void *value)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param pos   Position that the new value will be inserted before it.
+     *              This parameter can be NULL or point to nothing
+     *              to insert the value at the end of the list.
+     * @param value The value to be inserted.
+     */
+    if( pos && pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    element_t *ele = element_create(self, value);
+    ccntr_rculist_link(&self->super, pos ? pos->node : NULL, &ele->node);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_insert_first(ccntr_man_rculist_t *self, void *value)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Insert a value to be the first one.
+     *
+     * @param self  Object instance.
+     * @param value The value to be inserted.
+     */
+    element_t *ele = element_create(self, value);
+    ccntr_rculist_link_first(&self->super, &ele->node);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_insert_last(ccntr_man_rculist_t *self, void *value)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Insert a value to be the last one.
+     *
+     * @param self  Object instance.
+     * @param value The value to be inserted.
+     */
+    element_t *ele = element_create(self, value);
+    ccntr_rculist_link_last(&self->super, &ele->node);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_erase(ccntr_man_rculist_t *self, ccntr_man_rculist_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Erase a value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value to be erased.
+     *             The iterator will point to the next value after this operation.
+     */
+    if( !pos->node ) return;
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    node_t *node = pos->node;
+    pos->node = ccntr_rculist_node_get_next(node);
+
+    if( ccntr_rculist_unlink(&self->super, node) )
+        element_retire(container_of(node, element_t, node));
+}
+//------------------------------------------------------------------------------
+bool ccntr_man_rculist_erase_value(ccntr_man_rculist_t *self, const void *value)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Erase the first value which is equal to (the same pointer as) a specific value.
+     *
+     * @param self  Object instance.
+     * @param value The value to be erased.
+     * @return TRUE if a value be erased; and FALSE if not found.
+     */
+    unsigned ticket = ccntr_epoch_read_lock(&self->epoch);
+
+    node_t *node = ccntr_rculist_get_first(&self->super);
+    while( node && container_of(node, element_t, node)->value != value )
+        node = ccntr_rculist_node_get_next(node);
+
+    bool erased = node && ccntr_rculist_unlink(&self->super, node);
+
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+
+    if( erased )
+        element_retire(container_of(node, element_t, node));
+
+    return erased;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_rculist_clear(ccntr_man_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_man_rculist_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    node_t *node = ccntr_rculist_discard_all(&self->super);
+    while( node )
+    {
+        element_t *ele = container_of(node, element_t, node);
+        node = node->next;
+
+        element_retire(ele);
+    }
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_RCULIST_ENABLED
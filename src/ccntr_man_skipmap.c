@@ -0,0 +1,289 @@
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_skipmap.h"
+
+#ifdef CCNTR_MAN_SKIPMAP_ENABLED
+
+typedef ccntr_skipmap_node_t node_t;
+
+typedef struct element_t
+{
+    ccntr_epoch_node_t   retired;
+    ccntr_man_skipmap_t *owner;
+    void                *value;
+    node_t               node;
+} element_t;
+
+//------------------------------------------------------------------------------
+//---- Element -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+element_t* element_create(ccntr_man_skipmap_t *owner, void *key, void *value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    if( !ele ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    ele->owner    = owner;
+    ele->value    = value;
+    ele->node.key = key;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ele->owner->release_key(ele->node.key);
+    ele->owner->release_value(ele->value);
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void element_release_retired(ccntr_epoch_node_t *retired)
+{
+    element_release(container_of(retired, element_t, retired));
+}
+//------------------------------------------------------------------------------
+static
+void element_retire(element_t *ele)
+{
+    // The element may still be accessed by readers, and will be released later.
+    ccntr_epoch_retire(&ele->owner->epoch, &ele->retired, element_release_retired);
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_iter_move_prev(ccntr_man_skipmap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_skipmap_get_prev(&self->container->super, self->node);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_skipmap_iter_get_value(ccntr_man_skipmap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->node ? container_of(self->node, element_t, node)->value : NULL;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_citer_move_prev(ccntr_man_skipmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_citer_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( self->node )
+        self->node = ccntr_skipmap_get_prev_c(&self->container->super, self->node);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_skipmap_citer_get_value(const ccntr_man_skipmap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    return self->node ? container_of(self->node, const element_t, node)->value : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Skip List Key Map Container ---------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_init(ccntr_man_skipmap_t              *self,
+                            ccntr_map_compare_keys_t          compare,
+                            ccntr_man_skipmap_release_key_t   release_key,
+                            ccntr_man_skipmap_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param compare       A function to be used to compare keys.
+     *                      If this parameter is NULL, then
+     *                      all keys will be treated as integral values.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_skipmap_init(&self->super, compare);
+    ccntr_epoch_init(&self->epoch);
+
+    self->release_key = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_destroy(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_skipmap_clear(self);
+    ccntr_epoch_destroy(&self->epoch);
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_skipmap_find_value(ccntr_man_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    unsigned ticket = ccntr_epoch_read_lock(&self->epoch);
+
+    node_t *node = ccntr_skipmap_find(&self->super, key);
+    void *value = node ? container_of(node, element_t, node)->value : NULL;
+
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_skipmap_find_value_c(const ccntr_man_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    return ccntr_man_skipmap_find_value((ccntr_man_skipmap_t*)self, key);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_insert(ccntr_man_skipmap_t *self, void *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     */
+    element_t *ele = element_create(self, key, value);
+
+    while( true )
+    {
+        unsigned ticket = ccntr_epoch_read_lock(&self->epoch);
+
+        node_t *node = ccntr_skipmap_link(&self->super, &ele->node);
+        bool unlinked = node && ccntr_skipmap_unlink(&self->super, node);
+
+        ccntr_epoch_read_unlock(&self->epoch, ticket);
+
+        if( !node ) break;
+
+        // Replace the old one, and try again.
+        if( unlinked )
+            element_retire(container_of(node, element_t, node));
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_erase(ccntr_man_skipmap_t *self, ccntr_man_skipmap_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value to be erased.
+     *             The iterator will point to the next value after this operation.
+     */
+    if( !pos->node ) return;
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    node_t *node = pos->node;
+    pos->node = ccntr_skipmap_node_get_next(node);
+
+    if( ccntr_skipmap_unlink(&self->super, node) )
+        element_retire(container_of(node, element_t, node));
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_erase_by_key(ccntr_man_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     */
+    unsigned ticket = ccntr_epoch_read_lock(&self->epoch);
+    node_t *node = ccntr_skipmap_unlink_by_key(&self->super, key);
+    ccntr_epoch_read_unlock(&self->epoch, ticket);
+
+    if( node )
+        element_retire(container_of(node, element_t, node));
+}
+//------------------------------------------------------------------------------
+void ccntr_man_skipmap_clear(ccntr_man_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_man_skipmap_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     *
+     * @attention This function is not safe with concurrent operations,
+     *            and values will be released immediately.
+     */
+    node_t *node = self->super.head.next[0];
+    ccntr_skipmap_discard_all(&self->super);
+
+    while( node )
+    {
+        element_t *ele = container_of(node, element_t, node);
+        node = node->next[0];
+
+        element_release(ele);
+    }
+
+    ccntr_epoch_reclaim(&self->epoch);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_SKIPMAP_ENABLED
@@ -0,0 +1,586 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_smap.h"
+
+#ifdef CCNTR_MAN_SMAP_ENABLED
+
+#define PREFIX_SIZE sizeof(uint64_t)
+
+typedef ccntr_map_node_t node_t;
+
+/*
+ * Keys of map nodes are pointed to string keys,
+ * which are stored in elements (near the nodes) or on stack for searching.
+ */
+typedef struct strkey_t
+{
+    uint64_t    prefix;     // The first bytes in big-endian order, and padded with zeros.
+    size_t      length;
+    const char *str;
+} strkey_t;
+
+typedef struct element_t
+{
+    node_t    node;
+    strkey_t  key;
+    void     *value;
+} element_t;
+
+//------------------------------------------------------------------------------
+//---- String Key --------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void strkey_init(strkey_t *self, const char *str)
+{
+    size_t length = strlen(str);
+
+    uint64_t prefix = 0;
+    for(size_t i = 0; i < PREFIX_SIZE; ++i)
+        prefix = prefix << 8 | ( i < length ? (uint8_t) str[i] : 0 );
+
+    self->prefix = prefix;
+    self->length = length;
+    self->str    = str;
+}
+//------------------------------------------------------------------------------
+static
+int strkey_compare(const void *key1, const void *key2)
+{
+    /*
+     * Prefixes are compared as integers, which is the same as comparing bytes.
+     * Strings are different if their prefixes are different,
+     * and are equal if their prefixes are equal and one of them is not longer than the prefix
+     * (since strings do not contain zeros, they must have the same length in this case).
+     * Keys are accessed only if their prefixes are equal and both of them are longer.
+     */
+
+    const strkey_t *strkey1 = key1;
+    const strkey_t *strkey2 = key2;
+
+    if( strkey1->prefix != strkey2->prefix )
+        return ( strkey1->prefix < strkey2->prefix )?( -1 ):( 1 );
+
+    size_t length = strkey1->length < strkey2->length ? strkey1->length : strkey2->length;
+    if( length > PREFIX_SIZE )
+    {
+        int res = memcmp(strkey1->str + PREFIX_SIZE, strkey2->str + PREFIX_SIZE, length - PREFIX_SIZE);
+        if( res ) return res;
+    }
+
+    return ( strkey1->length > strkey2->length ) - ( strkey1->length < strkey2->length );
+}
+//------------------------------------------------------------------------------
+//---- Element -----------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+element_t* element_create(char *key, void *value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    if( !ele ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    strkey_init(&ele->key, key);
+    ele->node.key = &ele->key;
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t                     *ele,
+                     ccntr_man_smap_release_key_t   release_key,
+                     ccntr_man_smap_release_value_t release_value)
+{
+    release_key((char*) ele->key.str);
+    release_value(ele->value);
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void* element_release_but_keep_key_and_value(element_t *ele)
+{
+    void *value = ele->value;
+    free(ele);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+char* ccntr_man_smap_iter_get_key(ccntr_man_smap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_iter_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     *
+     * @attention Do NOT modify the key directly, except
+     *            the key (and value) has already be popped from the container.
+     */
+    if( !self->node ) return NULL;
+
+    element_t *ele = container_of(self->node, element_t, node);
+    return (char*) ele->key.str;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_smap_iter_get_value(ccntr_man_smap_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->node ) return NULL;
+
+    element_t *ele = container_of(self->node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+const char* ccntr_man_smap_citer_get_key(const ccntr_man_smap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_citer_t
+     * @brief Get key.
+     *
+     * @param self Object instance.
+     * @return The key be pointed by the iterator.
+     */
+    if( !self->node ) return NULL;
+
+    const element_t *ele = container_of(self->node, element_t, node);
+    return ele->key.str;
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_smap_citer_get_value(const ccntr_man_smap_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->node ) return NULL;
+
+    const element_t *ele = container_of(self->node, element_t, node);
+    return ele->value;
+}
+//------------------------------------------------------------------------------
+//---- String Key Map Container ------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_key_default(void *key)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_init(ccntr_man_smap_t              *self,
+                         ccntr_man_smap_release_key_t   release_key,
+                         ccntr_man_smap_release_value_t release_value)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Constructor.
+     *
+     * @param self          Object instance.
+     * @param release_key   Callback to release contained keys,
+     *                      and can be NULL to do nothing.
+     * @param release_value Callback to release contained values,
+     *                      and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_map_init(&self->super, strkey_compare);
+
+    self->release_key = release_key ? release_key : release_key_default;
+    self->release_value = release_value ? release_value : release_value_default;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_destroy(ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_smap_clear(self);
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_iter_t ccntr_man_smap_find(ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_iter_t iter;
+    ccntr_man_smap_iter_init(&iter, self, ccntr_map_find(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_citer_t ccntr_man_smap_find_c(const ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_citer_t iter;
+    ccntr_man_smap_citer_init(&iter, self, ccntr_map_find_c(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_smap_find_value(ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_smap_iter_t iter = ccntr_man_smap_find(self, key);
+    return ccntr_man_smap_iter_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_smap_find_value_c(const ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find value by key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to serch for the value.
+     * @return The value if found; or NULL if not found.
+     */
+    ccntr_man_smap_citer_t iter = ccntr_man_smap_find_c(self, key);
+    return ccntr_man_smap_citer_get_value(&iter);
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_iter_t ccntr_man_smap_find_nearest_less(ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_iter_t iter;
+    ccntr_man_smap_iter_init(&iter, self, ccntr_map_find_nearest_less(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_citer_t ccntr_man_smap_find_nearest_less_c(const ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find nearest value which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_citer_t iter;
+    ccntr_man_smap_citer_init(&iter, self, ccntr_map_find_nearest_less_c(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_iter_t ccntr_man_smap_find_nearest_great(ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_iter_t iter;
+    ccntr_man_smap_iter_init(&iter, self, ccntr_map_find_nearest_great(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_smap_citer_t ccntr_man_smap_find_nearest_great_c(const ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find nearest value which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be used to search for the value.
+     * @return An iterator be pointed to the value if found;
+     *         or an empty iterator if not found.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_man_smap_citer_t iter;
+    ccntr_man_smap_citer_init(&iter, self, ccntr_map_find_nearest_great_c(&self->super, &strkey));
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_insert(ccntr_man_smap_t *self, char *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Insert a value.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     *
+     * @remarks If the container already have a value with the same key, then
+     *          the old value (and key) will be replaced by the new one.
+     */
+    element_t *ele = element_create(key, value);
+
+    node_t *node = ccntr_map_link(&self->super, &ele->node);
+    if( node )
+    {
+        element_t *duplicated = container_of(node, element_t, node);
+        element_release(duplicated, self->release_key, self->release_value);
+    }
+}
+//------------------------------------------------------------------------------
+bool ccntr_man_smap_upsert(ccntr_man_smap_t *self, char *key, void *value)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Insert a value, or update the value in place if the key is existed.
+     *
+     * @param self  Object instance.
+     * @param key   Key of the value to be inserted.
+     * @param value The value to be inserted.
+     * @return TRUE if a new value is inserted;
+     *         and FALSE if an existed value is updated.
+     *
+     * @remarks If the key is already existed, then the old value
+     *          and the input key will be released, and the old key will be kept.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_spinlock_lock(&self->super.lock);
+
+    void *value_old = NULL;
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(&self->super, &strkey, &comp_res);
+    bool inserted = !closest || comp_res;
+    if( inserted )
+    {
+        element_t *ele = element_create(key, value);
+        ccntr_map_link_child_without_lock(&self->super, closest, comp_res < 0, &ele->node);
+    }
+    else
+    {
+        element_t *ele = container_of(closest, element_t, node);
+        value_old = ele->value;
+        ele->value = value;
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( !inserted )
+    {
+        self->release_key(key);
+        self->release_value(value_old);
+    }
+
+    return inserted;
+}
+//------------------------------------------------------------------------------
+void** ccntr_man_smap_find_or_insert(ccntr_man_smap_t *self, char *key, bool *inserted)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Find a value, or insert an empty value if the key is not existed.
+     *
+     * @param self     Object instance.
+     * @param key      Key of the value.
+     * @param inserted Returns TRUE if a new element is inserted;
+     *                 and FALSE if the key is already existed.
+     *                 This parameter can be NULL if the result is not needed.
+     * @return The storage of the value.
+     *         The storage of a new element will be set to NULL,
+     *         and the caller should store the value to it.
+     *
+     * @remarks The container will own the input key only if a new element is inserted.
+     * @attention The storage will be invalid after the value be erased.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    ccntr_spinlock_lock(&self->super.lock);
+
+    element_t *ele;
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(&self->super, &strkey, &comp_res);
+    bool is_new = !closest || comp_res;
+    if( is_new )
+    {
+        ele = element_create(key, NULL);
+        ccntr_map_link_child_without_lock(&self->super, closest, comp_res < 0, &ele->node);
+    }
+    else
+    {
+        ele = container_of(closest, element_t, node);
+    }
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    if( inserted ) *inserted = is_new;
+    return &ele->value;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_erase(ccntr_man_smap_t *self, ccntr_man_smap_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    node_t *node = pos->node;
+    if( !node ) return;
+
+    ccntr_map_unlink(&self->super, node);
+    ccntr_man_smap_iter_init(pos, NULL, NULL);
+
+    element_t *ele = container_of(node, element_t, node);
+    element_release(ele, self->release_key, self->release_value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_erase_by_key(ccntr_man_smap_t *self, const char *key)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Erase value.
+     *
+     * @param self Object instance.
+     * @param key  Key of the value.
+     */
+    strkey_t strkey;
+    strkey_init(&strkey, key);
+
+    node_t *node = ccntr_map_unlink_by_key(&self->super, &strkey);
+    if( !node ) return;
+
+    element_t *ele = container_of(node, element_t, node);
+    element_release(ele, self->release_key, self->release_value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_smap_clear(ccntr_man_smap_t *self)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->super.lock);
+
+    ccntr_man_smap_t shadow = *self;
+    ccntr_spinlock_init(&shadow.super.lock);
+
+    self->super.root  = NULL;
+    self->super.last  = NULL;
+    self->super.count = 0;
+
+    ccntr_spinlock_unlock(&self->super.lock);
+
+    node_t *node = ccntr_map_get_first_postorder(&shadow.super);
+    while( node )
+    {
+        element_t *ele = container_of(node, element_t, node);
+        node = ccntr_map_node_get_next_postorder(node);
+
+        element_release(ele, shadow.release_key, shadow.release_value);
+    }
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_smap_pop(ccntr_man_smap_t *self, ccntr_man_smap_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_smap_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_smap_t::ccntr_man_smap_erase,
+     *          but just remove the value and key from the container,
+     *          and will not release them.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     * @return The value be removed from container;
+     *         or NULL if no value available.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    node_t *node = pos->node;
+    if( !node ) return NULL;
+
+    ccntr_map_unlink(&self->super, node);
+    ccntr_man_smap_iter_init(pos, NULL, NULL);
+
+    element_t *ele = container_of(node, element_t, node);
+    return element_release_but_keep_key_and_value(ele);
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_SMAP_ENABLED
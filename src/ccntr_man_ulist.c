@@ -0,0 +1,554 @@
+#include <assert.h>
+#include <string.h>
+#include "container_of.h"
+#include "abort_message.h"
+#include "ccntr_man_ulist.h"
+
+#ifdef CCNTR_MAN_ULIST_ENABLED
+
+typedef ccntr_list_node_t node_t;
+
+typedef struct chunk_t
+{
+    node_t    node;
+    unsigned  count;
+    void     *values[];
+} chunk_t;
+
+//------------------------------------------------------------------------------
+//---- Chunk -------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+chunk_t* chunk_create(unsigned capacity)
+{
+    chunk_t *chunk = malloc(offsetof(chunk_t, values) + capacity * sizeof(void*));
+    if( !chunk ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    chunk->count = 0;
+
+    return chunk;
+}
+//------------------------------------------------------------------------------
+static
+void chunk_release(chunk_t *chunk, ccntr_man_ulist_release_value_t release_value)
+{
+    for(unsigned i = 0; i < chunk->count; ++i)
+        release_value(chunk->values[i]);
+
+    free(chunk);
+}
+//------------------------------------------------------------------------------
+static
+chunk_t* chunk_from_node(const node_t *node)
+{
+    return node ? container_of(node, chunk_t, node) : NULL;
+}
+//------------------------------------------------------------------------------
+//---- Iterator ----------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_iter_move_prev(ccntr_man_ulist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_iter_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->chunk ) return;
+
+    if( self->index )
+    {
+        -- self->index;
+    }
+    else
+    {
+        self->chunk = self->chunk->prev;
+        self->index = self->chunk ? chunk_from_node(self->chunk)->count - 1 : 0;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_iter_move_next(ccntr_man_ulist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_iter_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->chunk ) return;
+
+    if( ++ self->index >= chunk_from_node(self->chunk)->count )
+    {
+        self->chunk = self->chunk->next;
+        self->index = 0;
+    }
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_ulist_iter_get_value(ccntr_man_ulist_iter_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_iter_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->chunk ) return NULL;
+
+    chunk_t *chunk = chunk_from_node(self->chunk);
+    return chunk->values[self->index];
+}
+//------------------------------------------------------------------------------
+//---- Constant Iterator -------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_citer_move_prev(ccntr_man_ulist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_citer_t
+     * @brief Move iterator to the previous value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->chunk ) return;
+
+    if( self->index )
+    {
+        -- self->index;
+    }
+    else
+    {
+        self->chunk = self->chunk->prev;
+        self->index = self->chunk ? chunk_from_node(self->chunk)->count - 1 : 0;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_citer_move_next(ccntr_man_ulist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_citer_t
+     * @brief Move iterator to the next value.
+     *
+     * @param self Object instance.
+     */
+    if( !self->chunk ) return;
+
+    if( ++ self->index >= chunk_from_node(self->chunk)->count )
+    {
+        self->chunk = self->chunk->next;
+        self->index = 0;
+    }
+}
+//------------------------------------------------------------------------------
+const void* ccntr_man_ulist_citer_get_value(const ccntr_man_ulist_citer_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_citer_t
+     * @brief Get value.
+     *
+     * @param self Object instance.
+     * @return The value be pointed by the iterator.
+     */
+    if( !self->chunk ) return NULL;
+
+    const chunk_t *chunk = chunk_from_node(self->chunk);
+    return chunk->values[self->index];
+}
+//------------------------------------------------------------------------------
+//---- Unrolled List (Internal Operations) -------------------------------------
+//------------------------------------------------------------------------------
+static
+chunk_t* link_new_chunk(ccntr_man_ulist_t *self, chunk_t *pos)
+{
+    // Create and link a new chunk before @a pos (or to the last if it is NULL).
+    chunk_t *chunk = chunk_create(self->chunk_capacity);
+    ccntr_list_link(&self->super, pos ? &pos->node : NULL, &chunk->node);
+
+    return chunk;
+}
+//------------------------------------------------------------------------------
+static
+void unlink_chunk(ccntr_man_ulist_t *self, chunk_t *chunk)
+{
+    ccntr_list_unlink(&self->super, &chunk->node);
+    free(chunk);
+}
+//------------------------------------------------------------------------------
+static
+void insert_without_lock(ccntr_man_ulist_t  *self,
+                         chunk_t           **chunk,
+                         unsigned           *index,
+                         void               *value)
+{
+    /*
+     * Insert a value before the position (@a chunk, @a index),
+     * and the position will be updated to where the new value be placed.
+     * The chunk can be NULL to append value to the last position.
+     */
+    chunk_t  *curr = *chunk;
+    unsigned  idx  = *index;
+
+    if( !curr )
+    {
+        curr = chunk_from_node(self->super.last);
+        idx  = curr ? curr->count : 0;
+    }
+
+    if( curr && !idx && curr->count == self->chunk_capacity )
+    {
+        // Try to put the value at the end of the previous chunk.
+        chunk_t *prev = chunk_from_node(curr->node.prev);
+        if( prev && prev->count < self->chunk_capacity )
+        {
+            curr = prev;
+            idx  = prev->count;
+        }
+    }
+
+    if( !curr )
+    {
+        curr = link_new_chunk(self, NULL);
+        idx  = 0;
+    }
+    else if( curr->count < self->chunk_capacity )
+    {
+        // Nothing to do.
+    }
+    else if( idx == curr->count )
+    {
+        // Sequential append: start a new chunk instead of split a full one.
+        curr = link_new_chunk(self, chunk_from_node(curr->node.next));
+        idx  = 0;
+    }
+    else if( !idx )
+    {
+        // Sequential prepend: start a new chunk instead of split a full one.
+        curr = link_new_chunk(self, curr);
+    }
+    else
+    {
+        // Split the full chunk into halves.
+        unsigned half = curr->count / 2;
+
+        chunk_t *next = link_new_chunk(self, chunk_from_node(curr->node.next));
+        memcpy(next->values, curr->values + half, ( curr->count - half ) * sizeof(void*));
+        next->count = curr->count - half;
+        curr->count = half;
+
+        if( idx > half )
+        {
+            curr = next;
+            idx -= half;
+        }
+    }
+
+    assert( idx <= curr->count && curr->count < self->chunk_capacity );
+    memmove(curr->values + idx + 1, curr->values + idx, ( curr->count - idx ) * sizeof(void*));
+    curr->values[idx] = value;
+    ++ curr->count;
+    ++ self->count;
+
+    *chunk = curr;
+    *index = idx;
+}
+//------------------------------------------------------------------------------
+static
+void* remove_without_lock(ccntr_man_ulist_t *self, chunk_t *chunk, unsigned index)
+{
+    assert( index < chunk->count );
+
+    void *value = chunk->values[index];
+    memmove(chunk->values + index, chunk->values + index + 1, ( chunk->count - index - 1 ) * sizeof(void*));
+    -- chunk->count;
+
+    assert( self->count );
+    -- self->count;
+
+    chunk_t *prev = chunk_from_node(chunk->node.prev);
+    chunk_t *next = chunk_from_node(chunk->node.next);
+    unsigned limit = self->chunk_capacity / 2;
+
+    if( !chunk->count )
+    {
+        unlink_chunk(self, chunk);
+    }
+    else if( next && chunk->count + next->count <= limit )
+    {
+        // Merge the next chunk into the current one to keep chunks dense.
+        memcpy(chunk->values + chunk->count, next->values, next->count * sizeof(void*));
+        chunk->count += next->count;
+        unlink_chunk(self, next);
+    }
+    else if( prev && prev->count + chunk->count <= limit )
+    {
+        // Merge the current chunk into the previous one to keep chunks dense.
+        memcpy(prev->values + prev->count, chunk->values, chunk->count * sizeof(void*));
+        prev->count += chunk->count;
+        unlink_chunk(self, chunk);
+    }
+
+    return value;
+}
+//------------------------------------------------------------------------------
+//---- Unrolled List -----------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void release_value_default(void *value)
+{
+    // Nothing to do.
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_init(ccntr_man_ulist_t               *self,
+                          unsigned                         chunk_capacity,
+                          ccntr_man_ulist_release_value_t  release_value)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Constructor.
+     *
+     * @param self           Object instance.
+     * @param chunk_capacity The maximum count of values can be stored in each chunk,
+     *                       and can be ZERO to use the default capacity
+     *                       (::CCNTR_MAN_ULIST_DEFAULT_CHUNK_CAPACITY).
+     * @param release_value  Callback to release contained values,
+     *                       and can be NULL to do nothing.
+     *
+     * @attention Object must be initialised (and once only) before using.
+     */
+    ccntr_list_init(&self->super);
+
+    if( !chunk_capacity ) chunk_capacity = CCNTR_MAN_ULIST_DEFAULT_CHUNK_CAPACITY;
+    if( chunk_capacity < 2 ) chunk_capacity = 2;
+
+    self->count          = 0;
+    self->chunk_capacity = chunk_capacity;
+    self->release_value  = release_value ? release_value : release_value_default;
+
+    ccntr_spinlock_init(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_destroy(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     *
+     * @attention Object must be destructed to finish using,
+     *            and must not make any operation to the object after it be destructed.
+     */
+    ccntr_man_ulist_clear(self);
+}
+//------------------------------------------------------------------------------
+ccntr_man_ulist_iter_t ccntr_man_ulist_get_first(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Get the first value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the first value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t *chunk = ccntr_list_get_first(&self->super);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_ulist_iter_t iter;
+    ccntr_man_ulist_iter_init(&iter, self, chunk, 0);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+ccntr_man_ulist_iter_t ccntr_man_ulist_get_last(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Get the last value.
+     *
+     * @param self Object instance.
+     * @return An iterator be pointed to the last value,
+     *         or an empty iterator if no any values contained.
+     */
+    ccntr_spinlock_lock(&self->lock);
+    node_t  *chunk = ccntr_list_get_last(&self->super);
+    unsigned index = chunk ? chunk_from_node(chunk)->count - 1 : 0;
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_ulist_iter_t iter;
+    ccntr_man_ulist_iter_init(&iter, self, chunk, index);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_insert(ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos, void *value)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Insert a value to the specific position.
+     *
+     * @param self  Object instance.
+     * @param pos   The position to insert value.
+     *              It will still be pointed to the same value after the operation.
+     * @param value The value to be added.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    ccntr_spinlock_lock(&self->lock);
+
+    bool     have_pos = pos->chunk;
+    chunk_t *chunk    = chunk_from_node(pos->chunk);
+    unsigned index    = pos->index;
+    insert_without_lock(self, &chunk, &index, value);
+
+    // Move the position to the value next to the new one.
+    if( have_pos )
+        ccntr_man_ulist_iter_init(pos, self, &chunk->node, index);
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( have_pos )
+        ccntr_man_ulist_iter_move_next(pos);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_insert_first(ccntr_man_ulist_t *self, void *value)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Insert a value to the first position.
+     *
+     * @param self  Object instance.
+     * @param value The value to be added.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    chunk_t *chunk = chunk_from_node(self->super.first);
+    unsigned index = 0;
+    insert_without_lock(self, &chunk, &index, value);
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_insert_last(ccntr_man_ulist_t *self, void *value)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Insert a value to the last position.
+     *
+     * @param self  Object instance.
+     * @param value The value to be added.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    chunk_t *chunk = NULL;
+    unsigned index = 0;
+    insert_without_lock(self, &chunk, &index, value);
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_erase(ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Erase value at the specific position.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     */
+    void *value = ccntr_man_ulist_pop(self, pos);
+    if( value ) self->release_value(value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_erase_first(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Erase value at the first position.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    chunk_t *chunk = chunk_from_node(self->super.first);
+    void *value = chunk ? remove_without_lock(self, chunk, 0) : NULL;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( chunk ) self->release_value(value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_erase_last(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Erase value at the last position.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    chunk_t *chunk = chunk_from_node(self->super.last);
+    void *value = chunk ? remove_without_lock(self, chunk, chunk->count - 1) : NULL;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    if( chunk ) self->release_value(value);
+}
+//------------------------------------------------------------------------------
+void ccntr_man_ulist_clear(ccntr_man_ulist_t *self)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Erase all values it contained.
+     *
+     * @param self Object instance.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *node = ccntr_list_get_first(&self->super);
+    ccntr_list_discard_all(&self->super);
+    self->count = 0;
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    while( node )
+    {
+        chunk_t *chunk = chunk_from_node(node);
+        node = node->next;
+
+        chunk_release(chunk, self->release_value);
+    }
+}
+//------------------------------------------------------------------------------
+void* ccntr_man_ulist_pop(ccntr_man_ulist_t *self, ccntr_man_ulist_iter_t *pos)
+{
+    /**
+     * @memberof ccntr_man_ulist_t
+     * @brief Pop value from container.
+     * @details Similarly to ccntr_man_ulist_t::ccntr_man_ulist_erase,
+     *          but just remove the value from container,
+     *          and will not release the value.
+     *
+     * @param self Object instance.
+     * @param pos  Position of the value.
+     * @return The value be removed form container.
+     */
+    if( pos->container != self )
+        abort_message("ERROR: Operator iterator with different container!\n");
+
+    chunk_t *chunk = chunk_from_node(pos->chunk);
+    if( !chunk ) return NULL;
+
+    ccntr_spinlock_lock(&self->lock);
+    void *value = remove_without_lock(self, chunk, pos->index);
+    ccntr_spinlock_unlock(&self->lock);
+
+    ccntr_man_ulist_iter_init(pos, NULL, NULL, 0);
+
+    return value;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_MAN_ULIST_ENABLED
@@ -1,19 +1,53 @@
 #include <assert.h>
+#include <limits.h>
 #include <stdint.h>
+#include "abort_message.h"
 #include "ccntr_map.h"
 
 typedef ccntr_map_node_t node_t;
 
+//------------------------------------------------------------------------------
+//---- Node Fields -------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t* node_get_parent(const node_t *node)
+{
+    return ccntr_map_node_get_parent(node);
+}
+//------------------------------------------------------------------------------
+static
+void node_set_parent(node_t *node, node_t *parent)
+{
+#ifdef CCNTR_MAP_COMPACT_NODE
+    assert( !( (uintptr_t) parent & 1 ) );
+    node->parent_and_color = (uintptr_t) parent | ( node->parent_and_color & 1 );
+#else
+    node->parent = parent;
+#endif
+}
+//------------------------------------------------------------------------------
+static
+void node_set_red(node_t *node, bool is_red)
+{
+#ifdef CCNTR_MAP_COMPACT_NODE
+    node->parent_and_color = ( node->parent_and_color & ~(uintptr_t) 1 ) | ( is_red ? 1 : 0 );
+#else
+    node->is_red = is_red;
+#endif
+}
 //------------------------------------------------------------------------------
 //---- Node Initialise ---------------------------------------------------------
 //------------------------------------------------------------------------------
 static
 void node_reset(node_t *node)
 {
-    node->parent = NULL;
+    node_set_parent(node, NULL);
     node->left   = NULL;
     node->right  = NULL;
-    node->is_red = true;
+    node_set_red(node, true);
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    node->size   = 1;
+#endif
 }
 //------------------------------------------------------------------------------
 //---- Node Characteristics ----------------------------------------------------
@@ -21,13 +55,13 @@ void node_reset(node_t *node)
 static
 bool node_is_black(node_t *node)
 {
-    return !node || !node->is_red;
+    return !node || !ccntr_map_node_is_red(node);
 }
 //------------------------------------------------------------------------------
 static
 bool node_is_red(node_t *node)
 {
-    return node && node->is_red;
+    return node && ccntr_map_node_is_red(node);
 }
 //------------------------------------------------------------------------------
 static
@@ -42,6 +76,33 @@ bool node_have_full_child(node_t *node)
     return node && node->left && node->right;
 }
 //------------------------------------------------------------------------------
+//---- Node Augmentation -------------------------------------------------------
+//------------------------------------------------------------------------------
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+static
+unsigned node_get_size(const node_t *node)
+{
+    return node ? node->size : 0;
+}
+#endif
+//------------------------------------------------------------------------------
+static
+void node_update(node_t *node, ccntr_map_augment_t augment)
+{
+    // Recalculate augmented fields of a node from its children.
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    node->size = 1 + node_get_size(node->left) + node_get_size(node->right);
+#endif
+    if( augment ) augment(node);
+}
+//------------------------------------------------------------------------------
+static
+void node_update_upward(node_t *node, ccntr_map_augment_t augment)
+{
+    for(; node; node = node_get_parent(node))
+        node_update(node, augment);
+}
+//------------------------------------------------------------------------------
 //---- Node Family -------------------------------------------------------------
 //------------------------------------------------------------------------------
 static
@@ -67,11 +128,11 @@ node_t* node_get_leftmost_parent(node_t *node)
 {
     if( !node ) return NULL;
 
-    for(node_t *parent = node->parent;
+    for(node_t *parent = node_get_parent(node);
         parent && parent->right == node;)
     {
         node = parent;
-        parent = node->parent;
+        parent = node_get_parent(node);
     }
 
     return node;
@@ -82,11 +143,11 @@ node_t* node_get_rightmost_parent(node_t *node)
 {
     if( !node ) return NULL;
 
-    for(node_t *parent = node->parent;
+    for(node_t *parent = node_get_parent(node);
         parent && parent->left == node;)
     {
         node = parent;
-        parent = node->parent;
+        parent = node_get_parent(node);
     }
 
     return node;
@@ -95,7 +156,7 @@ node_t* node_get_rightmost_parent(node_t *node)
 static
 node_t* node_get_grand_parent(node_t *node)
 {
-    return ( node && node->parent )?( node->parent->parent ):( NULL );
+    return ( node && node_get_parent(node) )?( node_get_parent(node_get_parent(node)) ):( NULL );
 }
 //------------------------------------------------------------------------------
 static
@@ -103,10 +164,10 @@ node_t* node_get_uncle(node_t *node)
 {
     if( !node ) return NULL;
 
-    node_t *parent = node->parent;
+    node_t *parent = node_get_parent(node);
     if( !parent ) return NULL;
 
-    node_t *grand_parent = parent->parent;
+    node_t *grand_parent = node_get_parent(parent);
     if( !grand_parent ) return NULL;
 
     return ( parent == grand_parent->left )?( grand_parent->right ):( grand_parent->left );
@@ -131,7 +192,7 @@ void node_link_left(node_t *main, node_t *node)
     if( node )
     {
         main->left   = node;
-        node->parent = main;
+        node_set_parent(node, main);
     }
 }
 //------------------------------------------------------------------------------
@@ -144,7 +205,7 @@ void node_link_right(node_t *main, node_t *node)
     if( node )
     {
         main->right  = node;
-        node->parent = main;
+        node_set_parent(node, main);
     }
 }
 //------------------------------------------------------------------------------
@@ -157,7 +218,7 @@ void node_unlink_left(node_t *node)
     if( child )
     {
         node ->left   = NULL;
-        child->parent = NULL;
+        node_set_parent(child, NULL);
     }
 }
 //------------------------------------------------------------------------------
@@ -170,7 +231,7 @@ void node_unlink_right(node_t *node)
     if( child )
     {
         node ->right  = NULL;
-        child->parent = NULL;
+        node_set_parent(child, NULL);
     }
 }
 //------------------------------------------------------------------------------
@@ -181,7 +242,7 @@ node_t* tree_move_node_parent(node_t *root, node_t *from, node_t *to)
 {
     assert( from );
 
-    node_t *parent = from->parent;
+    node_t *parent = node_get_parent(from);
     if( parent )
     {
         if( from == parent->left )
@@ -189,16 +250,16 @@ node_t* tree_move_node_parent(node_t *root, node_t *from, node_t *to)
         else
             parent->right = to;
 
-        if( to ) to->parent = parent;
+        if( to ) node_set_parent(to, parent);
     }
     else
     {
         assert( root == from );
         root = to;
-        if( to ) to->parent = NULL;
+        if( to ) node_set_parent(to, NULL);
     }
 
-    from->parent = NULL;
+    node_set_parent(from, NULL);
 
     return root;
 }
@@ -208,7 +269,10 @@ node_t* tree_replace_node(node_t *root, node_t *node_old, node_t *node_new)
 {
     assert( root && node_old && node_new );
 
-    node_new->is_red = node_old->is_red;
+    node_set_red(node_new, node_is_red(node_old));
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    node_new->size   = node_old->size;
+#endif
 
     node_t *left = node_old->left;
     node_unlink_left(node_old);
@@ -235,7 +299,7 @@ node_t* tree_swap_node(node_t *root, node_t *node1, node_t *node2)
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_rotate_node_left(node_t *root, node_t *node)
+node_t* tree_rotate_node_left(node_t *root, node_t *node, ccntr_map_augment_t augment)
 {
     assert( node && node->right );
 
@@ -249,11 +313,14 @@ node_t* tree_rotate_node_left(node_t *root, node_t *node)
     node_link_left(right, left);
     node_link_right(left, middle);
 
+    node_update(left, augment);
+    node_update(right, augment);
+
     return root;
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_rotate_node_right(node_t *root, node_t *node)
+node_t* tree_rotate_node_right(node_t *root, node_t *node, ccntr_map_augment_t augment)
 {
     assert( node && node->left );
 
@@ -267,26 +334,31 @@ node_t* tree_rotate_node_right(node_t *root, node_t *node)
     node_link_right(left, right);
     node_link_left(right, middle);
 
+    node_update(right, augment);
+    node_update(left, augment);
+
     return root;
 }
 //------------------------------------------------------------------------------
 //---- Tree Adjust -------------------------------------------------------------
 //------------------------------------------------------------------------------
 static
-node_t* tree_insert_adjust_case_parent_red_uncle_black_and_node_inner(node_t *root, node_t **node)
+node_t* tree_insert_adjust_case_parent_red_uncle_black_and_node_inner(node_t             *root,
+                                                                     node_t            **node,
+                                                                     ccntr_map_augment_t augment)
 {
-    node_t *parent = (*node)->parent;
+    node_t *parent = node_get_parent(*node);
     node_t *grand  = node_get_grand_parent(*node);
     assert( parent && grand );
 
     if( (*node) == parent->right && parent == grand->left )
     {
-        root = tree_rotate_node_left(root, parent);
+        root = tree_rotate_node_left(root, parent, augment);
         (*node) = (*node)->left;
     }
     else if( (*node) == parent->left && parent == grand->right )
     {
-        root = tree_rotate_node_right(root, parent);
+        root = tree_rotate_node_right(root, parent, augment);
         (*node) = (*node)->right;
     }
 
@@ -294,61 +366,66 @@ node_t* tree_insert_adjust_case_parent_red_uncle_black_and_node_inner(node_t *ro
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_insert_adjust_case_parent_red_uncle_black_and_node_outer(node_t *root, node_t *node)
+node_t* tree_insert_adjust_case_parent_red_uncle_black_and_node_outer(node_t             *root,
+                                                                     node_t             *node,
+                                                                     ccntr_map_augment_t augment)
 {
-    node_t *parent = node->parent;
+    node_t *parent = node_get_parent(node);
     node_t *grand  = node_get_grand_parent(node);
 
-    parent->is_red = false;
-    grand ->is_red = true;
+    node_set_red(parent, false);
+    node_set_red(grand, true);
 
     if( node == parent->left && parent == grand->left )
     {
-        root = tree_rotate_node_right(root, grand);
+        root = tree_rotate_node_right(root, grand, augment);
     }
     else if( node == parent->right && parent == grand->right )
     {
-        root = tree_rotate_node_left(root, grand);
+        root = tree_rotate_node_left(root, grand, augment);
     }
 
     return root;
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_insert_adjust(node_t *root, node_t *node)
+node_t* tree_insert_adjust(node_t *root, node_t *node, ccntr_map_augment_t augment)
 {
     assert( root && node );
 
-    node_t *parent = node->parent;
+    node_t *parent = node_get_parent(node);
     node_t *grand  = node_get_grand_parent(node);
     node_t *uncle  = node_get_uncle(node);
 
     if( !parent )
     {
-        node->is_red = false;
+        node_set_red(node, false);
     }
-    else if( !parent->is_red )
+    else if( !node_is_red(parent) )
     {
         // Nothing to do.
     }
-    else if( uncle && uncle->is_red )
+    else if( uncle && node_is_red(uncle) )
     {
-        parent->is_red = false;
-        uncle ->is_red = false;
-        grand ->is_red = true;
-        root = tree_insert_adjust(root, grand);
+        node_set_red(parent, false);
+        node_set_red(uncle, false);
+        node_set_red(grand, true);
+        root = tree_insert_adjust(root, grand, augment);
     }
     else
     {
-        root = tree_insert_adjust_case_parent_red_uncle_black_and_node_inner(root, &node);
-        root = tree_insert_adjust_case_parent_red_uncle_black_and_node_outer(root, node);
+        root = tree_insert_adjust_case_parent_red_uncle_black_and_node_inner(root, &node, augment);
+        root = tree_insert_adjust_case_parent_red_uncle_black_and_node_outer(root, node, augment);
     }
 
     return root;
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_erase_adjust_case_brother_child_red_inner(node_t *root, node_t *parent, node_t *node)
+node_t* tree_erase_adjust_case_brother_child_red_inner(node_t             *root,
+                                                      node_t             *parent,
+                                                      node_t             *node,
+                                                      ccntr_map_augment_t augment)
 {
     node_t *brother = node_get_brother(node, parent);
     assert( brother );
@@ -361,25 +438,28 @@ node_t* tree_erase_adjust_case_brother_child_red_inner(node_t *root, node_t *par
         node_is_red(broleft) &&
         node_is_black(broright) )
     {
-        brother->is_red = true;
-        broleft->is_red = false;
-        root = tree_rotate_node_right(root, brother);
+        node_set_red(brother, true);
+        node_set_red(broleft, false);
+        root = tree_rotate_node_right(root, brother, augment);
     }
     else if( node == parent->right &&
              node_is_black(brother) &&
              node_is_black(broleft) &&
              node_is_red(broright) )
     {
-        brother ->is_red = true;
-        broright->is_red = false;
-        root = tree_rotate_node_left(root, brother);
+        node_set_red(brother, true);
+        node_set_red(broright, false);
+        root = tree_rotate_node_left(root, brother, augment);
     }
 
     return root;
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_erase_adjust_case_brother_child_red_outer(node_t *root, node_t *parent, node_t *node)
+node_t* tree_erase_adjust_case_brother_child_red_outer(node_t             *root,
+                                                      node_t             *parent,
+                                                      node_t             *node,
+                                                      ccntr_map_augment_t augment)
 {
     node_t *brother = node_get_brother(node, parent);
     assert( brother );
@@ -387,27 +467,30 @@ node_t* tree_erase_adjust_case_brother_child_red_outer(node_t *root, node_t *par
     node_t *broleft  = brother->left;
     node_t *broright = brother->right;
 
-    brother->is_red = parent->is_red;
-    parent ->is_red = false;
+    node_set_red(brother, node_is_red(parent));
+    node_set_red(parent, false);
 
     if( node == parent->left )
     {
         assert( broright );
-        broright->is_red = false;
-        root = tree_rotate_node_left(root, parent);
+        node_set_red(broright, false);
+        root = tree_rotate_node_left(root, parent, augment);
     }
     else
     {
         assert( broleft );
-        broleft->is_red = false;
-        root = tree_rotate_node_right(root, parent);
+        node_set_red(broleft, false);
+        root = tree_rotate_node_right(root, parent, augment);
     }
 
     return root;
 }
 //------------------------------------------------------------------------------
 static
-node_t* tree_erase_adjust(node_t *root, node_t *parent, node_t *node)
+node_t* tree_erase_adjust(node_t             *root,
+                          node_t             *parent,
+                          node_t             *node,
+                          ccntr_map_augment_t augment)
 {
     if( !parent ) return root;
 
@@ -415,12 +498,12 @@ node_t* tree_erase_adjust(node_t *root, node_t *parent, node_t *node)
 
     if( node_is_red(brother) )
     {
-        parent ->is_red = true;
-        brother->is_red = false;
+        node_set_red(parent, true);
+        node_set_red(brother, false);
         if( node == parent->left )
-            root = tree_rotate_node_left(root, parent);
+            root = tree_rotate_node_left(root, parent, augment);
         else
-            root = tree_rotate_node_right(root, parent);
+            root = tree_rotate_node_right(root, parent, augment);
     }
 
     brother = node_get_brother(node, parent);
@@ -433,21 +516,21 @@ node_t* tree_erase_adjust(node_t *root, node_t *parent, node_t *node)
         node_is_black(broleft) &&
         node_is_black(broright) )
     {
-        brother->is_red = true;
-        root = tree_erase_adjust(root, parent->parent, parent);
+        node_set_red(brother, true);
+        root = tree_erase_adjust(root, node_get_parent(parent), parent, augment);
     }
     else if( node_is_red(parent) &&
              node_is_black(brother) &&
              node_is_black(broleft) &&
              node_is_black(broright) )
     {
-        brother->is_red = true;
-        parent ->is_red = false;;
+        node_set_red(brother, true);
+        node_set_red(parent, false);
     }
     else
     {
-        root = tree_erase_adjust_case_brother_child_red_inner(root, parent, node);
-        root = tree_erase_adjust_case_brother_child_red_outer(root, parent, node);
+        root = tree_erase_adjust_case_brother_child_red_inner(root, parent, node, augment);
+        root = tree_erase_adjust_case_brother_child_red_outer(root, parent, node, augment);
     }
 
     return root;
@@ -474,7 +557,7 @@ node_t* node_get_next_inorder(node_t *node)
 
     return ( node->right )?
            ( node_get_leftmost_child(node->right) ):
-           ( node_get_leftmost_parent(node)->parent );
+           ( node_get_parent(node_get_leftmost_parent(node)) );
 }
 //------------------------------------------------------------------------------
 static
@@ -484,7 +567,7 @@ node_t* node_get_prev_inorder(node_t *node)
 
     return ( node->left )?
            ( node_get_rightmost_child(node->left) ):
-           ( node_get_rightmost_parent(node)->parent );
+           ( node_get_parent(node_get_rightmost_parent(node)) );
 }
 //------------------------------------------------------------------------------
 //---- Node Visit (Post Order) -------------------------------------------------
@@ -502,9 +585,9 @@ node_t* tree_get_first_postorder(node_t *root)
 static
 node_t* node_get_next_postorder(node_t *node)
 {
-    if( !node || !node->parent ) return NULL;
+    if( !node || !node_get_parent(node) ) return NULL;
 
-    node_t *parent = node->parent;
+    node_t *parent = node_get_parent(node);
     return ( parent->right && parent->right != node )?
            ( tree_get_first_postorder(parent->right) ):
            ( parent );
@@ -539,6 +622,38 @@ node_t* tree_find_closest(node_t *root, const void *key, ccntr_map_compare_keys_
 }
 //------------------------------------------------------------------------------
 static
+node_t* tree_find_closest_from(node_t                  *root,
+                               node_t                  *finger,
+                               const void              *key,
+                               ccntr_map_compare_keys_t compare)
+{
+    /*
+     * Climb from the finger node until the subtree must contain the key,
+     * that is an ancestor be reached from its left side and it is greater than the key
+     * (or from its right side and it is less than the key),
+     * and then search downward from there.
+     * The cost is proportional to the logarithm of the distance between the keys.
+     */
+    if( !finger ) return tree_find_closest(root, key, compare);
+
+    int comp_res = compare(finger->key, key);
+    if( comp_res == 0 ) return finger;
+
+    node_t *node = finger;
+    for(node_t *parent = node_get_parent(node); parent; node = parent, parent = node_get_parent(node))
+    {
+        bool toward_greater = comp_res < 0;
+        if( node != ( toward_greater ? parent->left : parent->right ) ) continue;
+
+        int parent_res = compare(parent->key, key);
+        if( parent_res == 0 ) return parent;
+        if( toward_greater == ( parent_res > 0 ) ) break;
+    }
+
+    return tree_find_closest(node, key, compare);
+}
+//------------------------------------------------------------------------------
+static
 node_t* tree_find_match(node_t *root, const void *key, ccntr_map_compare_keys_t compare)
 {
     node_t *node = root;
@@ -580,6 +695,256 @@ node_t* tree_find_nearest_great(node_t *root, const void *key, ccntr_map_compare
     return node;
 }
 //------------------------------------------------------------------------------
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+static
+unsigned tree_get_rank(const node_t *root, const void *key, ccntr_map_compare_keys_t compare)
+{
+    // Count nodes which are less than the key.
+    unsigned rank = 0;
+    const node_t *node = root;
+    while( node )
+    {
+        if( compare(node->key, key) < 0 )
+        {
+            rank += node_get_size(node->left) + 1;
+            node = node->right;
+        }
+        else
+        {
+            node = node->left;
+        }
+    }
+
+    return rank;
+}
+#endif
+//------------------------------------------------------------------------------
+//---- Tree Build --------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+node_t* tree_build_sorted(node_t *const       *nodes,
+                          unsigned             count,
+                          node_t              *parent,
+                          unsigned             depth,
+                          unsigned             red_depth,
+                          ccntr_map_augment_t  augment)
+{
+    /*
+     * The middle node be the root of each subtree,
+     * so that sizes of the two subtrees are different by one at most,
+     * and all empty children are placed in the last two levels.
+     * Nodes in the deepest level are red if the level is not full,
+     * and others are black, so that all paths have the same black count.
+     */
+    if( !count ) return NULL;
+
+    unsigned mid = count / 2;
+    node_t *node = nodes[mid];
+
+    node_set_parent(node, parent);
+    node_set_red(node, depth == red_depth);
+    node->left   = tree_build_sorted(nodes, mid, node, depth + 1, red_depth, augment);
+    node->right  = tree_build_sorted(nodes + mid + 1, count - mid - 1, node, depth + 1, red_depth, augment);
+    node_update(node, augment);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+//---- Tree Split and Join -----------------------------------------------------
+//------------------------------------------------------------------------------
+/*
+ * The height used in this section is the black height of a tree,
+ * that is the count of black nodes on each path from the root to empty children.
+ */
+//------------------------------------------------------------------------------
+static
+unsigned tree_get_black_height(node_t *root)
+{
+    unsigned height = 0;
+    for(node_t *node = root; node; node = node->left)
+        height += node_is_red(node) ? 0 : 1;
+
+    return height;
+}
+//------------------------------------------------------------------------------
+static
+unsigned tree_get_black_height_from(node_t *root, node_t *node, unsigned height)
+{
+    // Calculate the height of tree by a node which its height is known.
+    if( !node ) return tree_get_black_height(root);
+
+    for(node = node_get_parent(node); node; node = node_get_parent(node))
+        height += node_is_red(node) ? 0 : 1;
+
+    return height;
+}
+//------------------------------------------------------------------------------
+static
+node_t* tree_join(node_t             *left,
+                  unsigned            left_height,
+                  node_t             *middle,
+                  node_t             *right,
+                  unsigned            right_height,
+                  unsigned           *height,
+                  ccntr_map_augment_t augment)
+{
+    /*
+     * Join two trees and a middle node which key is
+     * greater than the left tree and less than the right tree.
+     * The middle node is linked into the taller tree at the spine node
+     * which have the same height with the shorter tree,
+     * and then the tree is adjusted like the insertion.
+     * Costs are proportional to the difference of heights.
+     */
+    if( node_is_red(left) )
+    {
+        node_set_red(left, false);
+        ++ left_height;
+    }
+
+    if( node_is_red(right) )
+    {
+        node_set_red(right, false);
+        ++ right_height;
+    }
+
+    node_reset(middle);
+
+    if( left_height == right_height )
+    {
+        node_set_red(middle, false);
+        node_link_left(middle, left);
+        node_link_right(middle, right);
+        node_update(middle, augment);
+
+        *height = left_height + 1;
+        return middle;
+    }
+
+    node_t *root;
+    node_t *anchor;
+    unsigned anchor_height;
+
+    if( left_height > right_height )
+    {
+        node_t *parent = NULL;
+        node_t *node   = left;
+        unsigned node_height = left_height;
+        while( node_is_red(node) || node_height != right_height )
+        {
+            node_height -= node_is_red(node) ? 0 : 1;
+            parent = node;
+            node   = node->right;
+        }
+
+        assert( parent );
+        node_unlink_right(parent);
+        node_link_right(parent, middle);
+        node_link_left(middle, node);
+        node_link_right(middle, right);
+
+        anchor = right ? right : node;
+        anchor_height = right_height;
+
+        node_update(middle, augment);
+        node_update_upward(parent, augment);
+        root = tree_insert_adjust(left, middle, augment);
+    }
+    else
+    {
+        node_t *parent = NULL;
+        node_t *node   = right;
+        unsigned node_height = right_height;
+        while( node_is_red(node) || node_height != left_height )
+        {
+            node_height -= node_is_red(node) ? 0 : 1;
+            parent = node;
+            node   = node->left;
+        }
+
+        assert( parent );
+        node_unlink_left(parent);
+        node_link_left(parent, middle);
+        node_link_right(middle, node);
+        node_link_left(middle, left);
+
+        anchor = left ? left : node;
+        anchor_height = left_height;
+
+        node_update(middle, augment);
+        node_update_upward(parent, augment);
+        root = tree_insert_adjust(right, middle, augment);
+    }
+
+    // Subtrees under the middle node are not changed by the adjustment,
+    // so that the height can be calculated from them.
+    *height = tree_get_black_height_from(root, anchor, anchor_height);
+    return root;
+}
+//------------------------------------------------------------------------------
+static
+void tree_split(node_t                   *root,
+                unsigned                  height,
+                const void               *key,
+                ccntr_map_compare_keys_t  compare,
+                ccntr_map_augment_t       augment,
+                node_t                  **left,
+                unsigned                 *left_height,
+                node_t                  **right,
+                unsigned                 *right_height)
+{
+    /*
+     * Split a tree to two trees,
+     * one have all nodes less than the key, and another have the others.
+     * Subtrees on the search path are joined to the result trees from bottom to top,
+     * and the total costs are proportional to the height of the tree.
+     */
+    if( !root )
+    {
+        *left  = NULL;
+        *right = NULL;
+        *left_height  = 0;
+        *right_height = 0;
+        return;
+    }
+
+    node_t *child_left  = root->left;
+    node_t *child_right = root->right;
+    unsigned child_height = height - ( node_is_red(root) ? 0 : 1 );
+
+    node_unlink_left(root);
+    node_unlink_right(root);
+
+    if( compare(root->key, key) < 0 )
+    {
+        node_t *sub;
+        unsigned sub_height;
+        tree_split(child_right, child_height, key, compare, augment, &sub, &sub_height, right, right_height);
+        *left = tree_join(child_left, child_height, root, sub, sub_height, left_height, augment);
+    }
+    else
+    {
+        node_t *sub;
+        unsigned sub_height;
+        tree_split(child_left, child_height, key, compare, augment, left, left_height, &sub, &sub_height);
+        *right = tree_join(sub, sub_height, root, child_right, child_height, right_height, augment);
+    }
+}
+//------------------------------------------------------------------------------
+static
+unsigned tree_count_nodes(node_t *root)
+{
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    return node_get_size(root);
+#else
+    unsigned count = 0;
+    for(node_t *node = tree_get_first_postorder(root); node; node = node_get_next_postorder(node))
+        ++ count;
+
+    return count;
+#endif
+}
+//------------------------------------------------------------------------------
 //---- Container Iterator ------------------------------------------------------
 //------------------------------------------------------------------------------
 node_t* ccntr_map_node_get_next(node_t *self)
@@ -647,12 +1012,64 @@ void ccntr_map_init(ccntr_map_t *self, ccntr_map_compare_keys_t compare)
      *                all keys will be treated as integral values.
      */
     self->root    = NULL;
+    self->last    = NULL;
     self->count   = 0;
     self->compare = compare ? compare : compare_default;
+    self->augment = NULL;
 
     ccntr_spinlock_init(&self->lock);
 }
 //------------------------------------------------------------------------------
+void ccntr_map_set_augment(ccntr_map_t *self, ccntr_map_augment_t augment)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Set the function to maintain user defined summaries of nodes.
+     * @details The summary of each node will be kept up to date
+     *          through linking, unlinking and rotations,
+     *          so that aggregations of key ranges (ccntr_map_t::ccntr_map_aggregate_range)
+     *          can be calculated in logarithmic time.
+     *
+     * @param self    Object instance.
+     * @param augment The function to recalculate the summary of a node,
+     *                or NULL to stop maintaining summaries.
+     *
+     * @remarks Summaries of nodes already linked in the container
+     *          will be recalculated in linear time.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    self->augment = augment;
+    if( augment )
+    {
+        for(node_t *node = tree_get_first_postorder(self->root);
+            node;
+            node = node_get_next_postorder(node))
+        {
+            augment(node);
+        }
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_map_refresh_augment(ccntr_map_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Recalculate summaries after the user data of a node is changed.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container,
+     *             and its user data which the summary is depend on is changed.
+     */
+    if( !node ) return;
+
+    ccntr_spinlock_lock(&self->lock);
+    if( self->augment ) node_update_upward(node, self->augment);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
 node_t* ccntr_map_get_first(ccntr_map_t *self)
 {
     /**
@@ -685,7 +1102,7 @@ node_t* ccntr_map_get_last(ccntr_map_t *self)
      *          and the last node will have the largest key.
      */
     ccntr_spinlock_lock(&self->lock);
-    ccntr_map_node_t *node = tree_get_last_inorder(self->root);
+    ccntr_map_node_t *node = self->last;
     ccntr_spinlock_unlock(&self->lock);
 
     return node;
@@ -727,6 +1144,52 @@ node_t* ccntr_map_find(ccntr_map_t *self, const void *key)
     return node;
 }
 //------------------------------------------------------------------------------
+unsigned ccntr_map_find_many(ccntr_map_t       *self,
+                             const void *const *keys,
+                             unsigned           count,
+                             node_t           **nodes)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Find nodes of multiple keys.
+     * @details The lock is taken once for all keys,
+     *          and each key is searched from the node found by the previous key,
+     *          so that neighbouring keys will be found quickly.
+     *
+     * @param self  Object instance.
+     * @param keys  Keys to be searched,
+     *              and they should be sorted (in either order) for better locality.
+     * @param count Count of keys.
+     * @param nodes An array to receive the nodes found (at least @a count elements),
+     *              and NULL will be set for keys which are not found.
+     * @return Count of nodes found.
+     */
+    unsigned found  = 0;
+    node_t  *finger = NULL;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    for(unsigned i = 0; i < count; ++i)
+    {
+        node_t *node = tree_find_closest_from(self->root, finger, keys[i], self->compare);
+        finger = node;
+
+        if( node && self->compare(node->key, keys[i]) == 0 )
+        {
+            nodes[i] = node;
+            ++ found;
+        }
+        else
+        {
+            nodes[i] = NULL;
+        }
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return found;
+}
+//------------------------------------------------------------------------------
 ccntr_map_node_t* ccntr_map_find_nearest_less(ccntr_map_t *self, const void *key)
 {
     /**
@@ -775,43 +1238,26 @@ node_t* ccntr_map_link(ccntr_map_t *self, node_t *node)
      * @return A node be pop out which have the same key with the new node;
      *         or NULL if there do not have node with duplicated keys.
      *
+     * @remarks Linking nodes in increasing order of keys is amortised constant time,
+     *          if order statistics are disabled and no augmentation function is set.
      * @attention The new node to be linked must be isolated (not linked in any container),
      *            or the bahaviour is undefuned!
      */
     if( !node ) return NULL;
 
-    node_reset(node);
-
     ccntr_spinlock_lock(&self->lock);
 
     node_t *duplicated = NULL;
-    node_t *closest = tree_find_closest(self->root, node->key, self->compare);
-    if( closest )
+    int comp_res;
+    node_t *closest = ccntr_map_find_closest_without_lock(self, node->key, &comp_res);
+    if( closest && !comp_res )
     {
-        int comp_res = self->compare(closest->key, node->key);
-        if( comp_res < 0 )
-        {
-            node_link_right(closest, node);
-            self->root = tree_insert_adjust(self->root, node);
-            ++ self->count;
-        }
-        else if( comp_res > 0 )
-        {
-            node_link_left(closest, node);
-            self->root = tree_insert_adjust(self->root, node);
-            ++ self->count;
-        }
-        else
-        {
-            self->root = tree_replace_node(self->root, closest, node);
-            duplicated = closest;
-        }
+        ccntr_map_replace_without_lock(self, closest, node);
+        duplicated = closest;
     }
     else
     {
-        self->root = node;
-        self->root = tree_insert_adjust(self->root, node);
-        ++ self->count;
+        ccntr_map_link_child_without_lock(self, closest, comp_res < 0, node);
     }
 
     ccntr_spinlock_unlock(&self->lock);
@@ -819,11 +1265,192 @@ node_t* ccntr_map_link(ccntr_map_t *self, node_t *node)
     return duplicated;
 }
 //------------------------------------------------------------------------------
-static
+node_t* ccntr_map_link_hint(ccntr_map_t *self, node_t *hint, node_t *node)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Link a node into the container with a hint of its position.
+     * @details If the new node will be adjacent to the hint node,
+     *          then it will be linked without searching from the root.
+     *          That is useful for linking nodes which are nearly sorted,
+     *          by using the last linked node to be the hint.
+     *
+     * @param self Object instance.
+     * @param hint A node in the container which is expected to be
+     *             the nearest node before or after the new node.
+     *             This parameter can be NULL to use the general searching.
+     * @param node The new node to be linked.
+     *             If the container already have a node with the same key,
+     *             then the old node will be pop out,
+     *             and the new one will be saved.
+     * @return A node be pop out which have the same key with the new node;
+     *         or NULL if there do not have node with duplicated keys.
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            and the hint node must be a member of this container,
+     *            or the bahaviour is undefuned!
+     */
+    if( !node ) return NULL;
+    if( !hint ) return ccntr_map_link(self, node);
+
+    ccntr_spinlock_lock(&self->lock);
+
+    // Find the two adjacent nodes which the new node will be placed between,
+    // or the node which have the same key.
+    node_t *prev = NULL;
+    node_t *next = NULL;
+    node_t *same = NULL;
+    bool    near = true;
+
+    int comp_res = self->compare(hint->key, node->key);
+    if( comp_res < 0 )
+    {
+        prev = hint;
+        next = node_get_next_inorder(hint);
+        comp_res = next ? self->compare(next->key, node->key) : 1;
+        if( comp_res == 0 ) same = next;
+        near = comp_res >= 0;
+    }
+    else if( comp_res > 0 )
+    {
+        prev = node_get_prev_inorder(hint);
+        next = hint;
+        comp_res = prev ? self->compare(prev->key, node->key) : -1;
+        if( comp_res == 0 ) same = prev;
+        near = comp_res <= 0;
+    }
+    else
+    {
+        same = hint;
+    }
+
+    if( same )
+    {
+        ccntr_map_replace_without_lock(self, same, node);
+    }
+    else if( near )
+    {
+        // One of the adjacent nodes must have an empty child on the side to each other.
+        if( prev && !prev->right )
+            ccntr_map_link_child_without_lock(self, prev, true, node);
+        else
+            ccntr_map_link_child_without_lock(self, next, false, node);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    // Search from the root if the hint is not adjacent to the new node.
+    return near ? same : ccntr_map_link(self, node);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_map_find_closest_without_lock(const ccntr_map_t *self, const void *key, int *comp_res)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Find the node which have the key,
+     *        or the node which a new node with the key should be linked to.
+     *
+     * @param self     Object instance.
+     * @param key      The key to be searched.
+     * @param comp_res Returns the result of comparing the key of the found node with @a key,
+     *                 and that is ZERO if the node have the same key.
+     * @return The node found; or NULL if the container is empty.
+     *
+     * @attention The lock of the container must be held by the caller.
+     */
+    // Keys greater than the last node are found directly.
+    if( self->last && self->compare(self->last->key, key) < 0 )
+    {
+        *comp_res = -1;
+        return self->last;
+    }
+
+    node_t *node = tree_find_closest(self->root, key, self->compare);
+    *comp_res = node ? self->compare(node->key, key) : 0;
+
+    return node;
+}
+//------------------------------------------------------------------------------
+void ccntr_map_link_child_without_lock(ccntr_map_t *self,
+                                       node_t      *parent,
+                                       bool         at_right,
+                                       node_t      *node)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Link a node to be a child of a specific node, and rebalance the tree.
+     *
+     * @param self     Object instance.
+     * @param parent   The node to be the parent of the new node,
+     *                 which is found by searching the key of the new node,
+     *                 and the child of the specified side must be empty.
+     *                 This parameter can be NULL if the container is empty.
+     * @param at_right TRUE to link the new node to the right side (the greater side);
+     *                 and FALSE to link to the left side.
+     * @param node     The new node to be linked.
+     *
+     * @attention The lock of the container must be held by the caller.
+     */
+    node_reset(node);
+
+    if( !parent || ( at_right && parent == self->last ) )
+        self->last = node;
+
+    if( !parent )
+        self->root = node;
+    else if( at_right )
+        node_link_right(parent, node);
+    else
+        node_link_left(parent, node);
+
+    // Ancestors are not walked if they have no augmented fields,
+    // so that a node appended to the last one costs only the rebalancing,
+    // which is constant time in amortised.
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    node_update_upward(node, self->augment);
+#else
+    if( self->augment ) node_update_upward(node, self->augment);
+#endif
+    self->root = tree_insert_adjust(self->root, node, self->augment);
+    ++ self->count;
+}
+//------------------------------------------------------------------------------
+void ccntr_map_replace_without_lock(ccntr_map_t *self, node_t *node_old, node_t *node_new)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Replace a node in the container by a new node with the same key.
+     *
+     * @param self     Object instance.
+     * @param node_old The node in the container to be replaced.
+     * @param node_new The new node to be linked.
+     *
+     * @attention The lock of the container must be held by the caller.
+     */
+    node_reset(node_new);
+    self->root = tree_replace_node(self->root, node_old, node_new);
+    if( self->augment ) node_update_upward(node_new, self->augment);
+
+    if( self->last == node_old )
+        self->last = node_new;
+}
+//------------------------------------------------------------------------------
 void ccntr_map_unlink_without_lock(ccntr_map_t *self, node_t *node)
 {
+    /**
+     * @memberof ccntr_map_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     *
+     * @attention The lock of the container must be held by the caller.
+     */
     assert( node );
 
+    if( self->last == node )
+        self->last = node_get_prev_inorder(node);
+
     // Exchange node position with the nearest single/no child node.
     if( node_have_full_child(node) )
     {
@@ -832,9 +1459,14 @@ void ccntr_map_unlink_without_lock(ccntr_map_t *self, node_t *node)
     }
 
     // Unlink the node, and use its child to replace the position.
-    node_t *parent = node->parent;
+    node_t *parent = node_get_parent(node);
     node_t *child  = node->left ? node->left : node->right;
     self->root = tree_move_node_parent(self->root, node, child);
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    node_update_upward(parent, self->augment);
+#else
+    if( self->augment ) node_update_upward(parent, self->augment);
+#endif
 
     // Nodes adjust.
     if( node_is_red(node) )
@@ -843,11 +1475,11 @@ void ccntr_map_unlink_without_lock(ccntr_map_t *self, node_t *node)
     }
     else if( node_is_red(child) )
     {
-        child->is_red = false;
+        node_set_red(child, false);
     }
     else
     {
-        self->root = tree_erase_adjust(self->root, parent, child);
+        self->root = tree_erase_adjust(self->root, parent, child, self->augment);
     }
 
     assert( self->count );
@@ -896,3 +1528,356 @@ node_t* ccntr_map_unlink_by_key(ccntr_map_t *self, const void *key)
     return node;
 }
 //------------------------------------------------------------------------------
+void ccntr_map_build_sorted(ccntr_map_t *self, node_t *const *nodes, unsigned count)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Link nodes which are already sorted into the container in linear time.
+     *
+     * @param self  Object instance.
+     * @param nodes Nodes to be linked, which must be sorted by keys in ascending order,
+     *              and must not have duplicated keys.
+     * @param count Count of nodes.
+     *
+     * @attention The nodes to be linked must be isolated (not linked in any container),
+     *            and the container must be empty, or the existing nodes will be discarded!
+     */
+    ccntr_spinlock_lock(&self->lock);
+    ccntr_map_build_sorted_without_lock(self, nodes, count);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_map_build_sorted_without_lock(ccntr_map_t *self, node_t *const *nodes, unsigned count)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Link nodes which are already sorted into the container in linear time.
+     * @details The same as ccntr_map_t::ccntr_map_build_sorted,
+     *          but the lock of the container must be held by the caller.
+     *
+     * @param self  Object instance.
+     * @param nodes Nodes to be linked, which must be sorted by keys in ascending order,
+     *              and must not have duplicated keys.
+     * @param count Count of nodes.
+     */
+    // The deepest level which the balanced tree will have.
+    unsigned depth = 0;
+    while( ( 2u << depth ) - 1 < count ) ++ depth;
+
+    bool level_full = count == ( 2u << depth ) - 1;
+    unsigned red_depth = ( depth && !level_full )?( depth ):( UINT_MAX );
+
+#ifndef NDEBUG
+    for(unsigned i = 1; i < count; ++i)
+        assert( self->compare(nodes[ i - 1 ]->key, nodes[i]->key) < 0 );
+#endif
+
+    self->root  = tree_build_sorted(nodes, count, NULL, 0, red_depth, self->augment);
+    self->last  = count ? nodes[ count - 1 ] : NULL;
+    self->count = count;
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+node_t* ccntr_map_select(ccntr_map_t *self, unsigned index)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Find node by its order.
+     *
+     * @param self  Object instance.
+     * @param index Zero based index of the node in key order.
+     * @return The node if found; and NULL if the index is out of range.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *node = self->root;
+    while( node )
+    {
+        unsigned left_size = node_get_size(node->left);
+        if( index < left_size )
+        {
+            node = node->left;
+        }
+        else if( index > left_size )
+        {
+            index -= left_size + 1;
+            node = node->right;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return node;
+}
+#endif
+//------------------------------------------------------------------------------
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+unsigned ccntr_map_rank(const ccntr_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Get count of nodes which have keys less than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  The key to be compared.
+     * @return Count of nodes which are less than the key,
+     *         and that is also the index of the node with the key if it is contained.
+     */
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+    unsigned rank = tree_get_rank(self->root, key, self->compare);
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return rank;
+}
+#endif
+//------------------------------------------------------------------------------
+unsigned ccntr_map_unlink_range(ccntr_map_t *self,
+                                const void  *lower,
+                                const void  *upper,
+                                ccntr_map_t *removed)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Unlink all nodes which have keys in a range.
+     * @details The nodes are detached by splitting and joining the tree,
+     *          so that costs are proportional to the height of the tree.
+     *
+     * @param self    Object instance.
+     * @param lower   The lower bound of keys (inclusive).
+     * @param upper   The upper bound of keys (exclusive).
+     * @param removed A container to receive the unlinked nodes,
+     *                which must be initialised with the same compare function,
+     *                and must be empty.
+     * @return Count of nodes be unlinked.
+     *
+     * @remarks The unlinked nodes are counted by traversing them
+     *          if the order statistics option is disabled,
+     *          so that the cost will be proportional to the count of them in addition.
+     * @attention The container to receive nodes must be different with the source container!
+     */
+    assert( self != removed );
+
+#ifdef CCNTR_THREAD_SAFE
+    // Locks are acquired in the order of addresses,
+    // so that ranges can be moved between two containers in both directions concurrently.
+    ccntr_spinlock_t *first  = (uintptr_t) self < (uintptr_t) removed ? &self->lock : &removed->lock;
+    ccntr_spinlock_t *second = (uintptr_t) self < (uintptr_t) removed ? &removed->lock : &self->lock;
+#endif
+
+    ccntr_spinlock_lock(first);
+    ccntr_spinlock_lock(second);
+
+    unsigned count = ccntr_map_unlink_range_without_lock(self, lower, upper, removed);
+
+    ccntr_spinlock_unlock(second);
+    ccntr_spinlock_unlock(first);
+
+    return count;
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_map_unlink_range_without_lock(ccntr_map_t *self,
+                                             const void  *lower,
+                                             const void  *upper,
+                                             ccntr_map_t *removed)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Unlink all nodes which have keys in a range.
+     * @details The same as ccntr_map_t::ccntr_map_unlink_range,
+     *          but locks of both containers must be held by the caller.
+     *
+     * @param self    Object instance.
+     * @param lower   The lower bound of keys (inclusive).
+     * @param upper   The upper bound of keys (exclusive).
+     * @param removed A container to receive the unlinked nodes, and must be empty.
+     * @return Count of nodes be unlinked.
+     */
+    assert( self != removed );
+
+    if( removed->root )
+        abort_message("ERROR: The container to receive nodes is not empty!\n");
+
+    node_t *range = NULL;
+    unsigned count = 0;
+
+    if( self->root && self->compare(lower, upper) < 0 )
+    {
+        node_t *left, *middle, *right;
+        unsigned left_height, middle_height, right_height;
+
+        unsigned height = tree_get_black_height(self->root);
+        tree_split(self->root,
+                   height,
+                   lower,
+                   self->compare,
+                   self->augment,
+                   &left,
+                   &left_height,
+                   &right,
+                   &right_height);
+        tree_split(right,
+                   right_height,
+                   upper,
+                   self->compare,
+                   self->augment,
+                   &middle,
+                   &middle_height,
+                   &right,
+                   &right_height);
+
+        range = middle;
+        if( range ) node_set_red(range, false);
+        count = tree_count_nodes(range);
+
+        // Join the remaining trees by the first node of the right tree.
+        node_t *first = tree_get_first_inorder(right);
+        if( first )
+        {
+            ccntr_map_t rest;
+            ccntr_map_init(&rest, self->compare);
+            rest.root    = right;
+            rest.augment = self->augment;
+            rest.count   = self->count - count;
+
+            ccntr_map_unlink_without_lock(&rest, first);
+            right = rest.root;
+            right_height = tree_get_black_height(right);
+
+            self->root = tree_join(left, left_height, first, right, right_height, &height, self->augment);
+        }
+        else
+        {
+            self->root = left;
+        }
+
+        if( self->root ) node_set_red(self->root, false);
+        self->last   = tree_get_last_inorder(self->root);
+        self->count -= count;
+    }
+
+    removed->root  = range;
+    removed->last  = tree_get_last_inorder(range);
+    removed->count = count;
+
+    return count;
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_map_count_range(const ccntr_map_t *self, const void *lower, const void *upper)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Get count of nodes which have keys in a range.
+     *
+     * @param self  Object instance.
+     * @param lower The lower bound of keys (inclusive).
+     * @param upper The upper bound of keys (exclusive).
+     * @return Count of nodes in the range.
+     *
+     * @remarks The cost is logarithmic if the order statistics option is enabled,
+     *          or it will be proportional to the count of nodes in the range.
+     */
+    if( self->compare(lower, upper) >= 0 ) return 0;
+
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    unsigned count = tree_get_rank(self->root, upper, self->compare) -
+                     tree_get_rank(self->root, lower, self->compare);
+#else
+    unsigned count = 0;
+    for(node_t *node = tree_find_nearest_great(self->root, lower, self->compare);
+        node && self->compare(node->key, upper) < 0;
+        node = node_get_next_inorder(node))
+    {
+        ++ count;
+    }
+#endif
+
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+
+    return count;
+}
+//------------------------------------------------------------------------------
+void ccntr_map_aggregate_range(const ccntr_map_t    *self,
+                               const void           *lower,
+                               const void           *upper,
+                               ccntr_map_aggregate_t aggregate,
+                               void                 *result)
+{
+    /**
+     * @memberof ccntr_map_t
+     * @brief Aggregate all nodes which have keys in a range.
+     * @details The range is decomposed to whole subtrees and single nodes
+     *          on the boundary paths, and each of them is passed to @a aggregate,
+     *          so that the cost is logarithmic.
+     *
+     * @param self      Object instance.
+     * @param lower     The lower bound of keys (inclusive).
+     * @param upper     The upper bound of keys (exclusive).
+     * @param aggregate The function to accumulate nodes into the result,
+     *                  which will be called with summaries of subtrees
+     *                  maintained by the augmentation function
+     *                  (ccntr_map_t::ccntr_map_set_augment).
+     * @param result    The result object to be passed to @a aggregate.
+     *
+     * @remarks Subtrees and nodes are not passed in key order,
+     *          so that the aggregation should be commutative (like sum or maximum).
+     */
+    if( self->compare(lower, upper) >= 0 ) return;
+
+    ccntr_spinlock_lock( (ccntr_spinlock_t*) &self->lock );
+
+    // Find the top node in the range, and the range be split to its two sides.
+    const node_t *top = self->root;
+    while( top )
+    {
+        if( self->compare(top->key, lower) < 0 )
+            top = top->right;
+        else if( self->compare(top->key, upper) >= 0 )
+            top = top->left;
+        else
+            break;
+    }
+
+    if( top )
+    {
+        aggregate(result, top, false);
+
+        // Nodes on the left side are less than the upper bound.
+        for(const node_t *node = top->left; node; )
+        {
+            if( self->compare(node->key, lower) < 0 )
+            {
+                node = node->right;
+            }
+            else
+            {
+                if( node->right ) aggregate(result, node->right, true);
+                aggregate(result, node, false);
+                node = node->left;
+            }
+        }
+
+        // Nodes on the right side are not less than the lower bound.
+        for(const node_t *node = top->right; node; )
+        {
+            if( self->compare(node->key, upper) >= 0 )
+            {
+                node = node->left;
+            }
+            else
+            {
+                if( node->left ) aggregate(result, node->left, true);
+                aggregate(result, node, false);
+                node = node->right;
+            }
+        }
+    }
+
+    ccntr_spinlock_unlock( (ccntr_spinlock_t*) &self->lock );
+}
+//------------------------------------------------------------------------------
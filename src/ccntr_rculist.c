@@ -0,0 +1,189 @@
+#include <stdatomic.h>
+#include "ccntr_rculist.h"
+
+typedef ccntr_rculist_node_t node_t;
+
+#define LOAD_PTR(var) \
+    atomic_load_explicit((_Atomic(node_t*)*) &(var), memory_order_acquire)
+#define PUBLISH_PTR(var, value) \
+    atomic_store_explicit((_Atomic(node_t*)*) &(var), (value), memory_order_release)
+
+#define ATOMIC_UINT(var) ( (atomic_uint*) &(var) )
+
+//------------------------------------------------------------------------------
+//---- Node --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+node_t* ccntr_rculist_node_get_next(node_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_node_t
+     * @brief Get the next node.
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     *
+     * @remarks This function can be called by readers concurrently with writers.
+     */
+    return LOAD_PTR(self->next);
+}
+//------------------------------------------------------------------------------
+//---- List --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+unsigned ccntr_rculist_get_count(const ccntr_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     */
+    return atomic_load_explicit(ATOMIC_UINT(self->count), memory_order_relaxed);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_rculist_get_first(ccntr_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Get the first node.
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     *
+     * @remarks This function can be called by readers concurrently with writers.
+     */
+    return LOAD_PTR(self->first);
+}
+//------------------------------------------------------------------------------
+static
+void link_without_lock(ccntr_rculist_t *self, node_t *pos, node_t *node)
+{
+    node_t *prev = pos ? pos->prev : self->last;
+
+    // Initialise the node completely before it be published to readers.
+    node->prev = prev;
+    node->next = pos;
+
+    if( prev )
+        PUBLISH_PTR(prev->next, node);
+    else
+        PUBLISH_PTR(self->first, node);
+
+    if( pos )
+        pos->prev = node;
+    else
+        self->last = node;
+
+    atomic_fetch_add_explicit(ATOMIC_UINT(self->count), 1, memory_order_relaxed);
+}
+//------------------------------------------------------------------------------
+void ccntr_rculist_link(ccntr_rculist_t *self, node_t *pos, node_t *node)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Link a node into the list.
+     *
+     * @param self Object instance.
+     * @param pos  A node in the list that the new node will be linked before it.
+     *             This parameter can be NULL to link the node to be the last one.
+     * @param node The node to be linked.
+     *
+     * @attention The node to be linked must be isolated (not linked in any container),
+     *            and the position node must be linked in this list,
+     *            or the bahaviour is undefuned!
+     */
+    if( !node ) return;
+
+    ccntr_spinlock_lock(&self->lock);
+    link_without_lock(self, pos, node);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+void ccntr_rculist_link_first(ccntr_rculist_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Link a node to be the first one.
+     *
+     * @param self Object instance.
+     * @param node The node to be linked.
+     */
+    if( !node ) return;
+
+    ccntr_spinlock_lock(&self->lock);
+    link_without_lock(self, self->first, node);
+    ccntr_spinlock_unlock(&self->lock);
+}
+//------------------------------------------------------------------------------
+bool ccntr_rculist_unlink(ccntr_rculist_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Unlink a node from the list.
+     *
+     * @param self Object instance.
+     * @param node The node to be unlinked.
+     * @return TRUE if the node be unlinked by this call;
+     *         and FALSE if the node was already be unlinked (by the other writer).
+     *
+     * @remarks The next link of the node will be kept,
+     *          so that readers which are visiting the node can go on.
+     */
+    if( !node ) return false;
+
+    ccntr_spinlock_lock(&self->lock);
+
+    // An unlinked node have its previous link point to itself.
+    bool linked = node->prev != node;
+    if( linked )
+    {
+        node_t *prev = node->prev;
+        node_t *next = node->next;
+
+        if( prev )
+            PUBLISH_PTR(prev->next, next);
+        else
+            PUBLISH_PTR(self->first, next);
+
+        if( next )
+            next->prev = prev;
+        else
+            self->last = prev;
+
+        node->prev = node;
+
+        atomic_fetch_sub_explicit(ATOMIC_UINT(self->count), 1, memory_order_relaxed);
+    }
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return linked;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_rculist_discard_all(ccntr_rculist_t *self)
+{
+    /**
+     * @memberof ccntr_rculist_t
+     * @brief Discard all linkage of nodes in the list.
+     *
+     * @param self Object instance.
+     * @return The original first node.
+     *
+     * @remarks Nodes will be marked as unlinked, but the next links of them will be kept,
+     *          so that the discarded nodes can still be traversed from the original first node.
+     */
+    ccntr_spinlock_lock(&self->lock);
+
+    node_t *first = self->first;
+    for(node_t *node = first; node; node = node->next)
+        node->prev = node;
+
+    PUBLISH_PTR(self->first, NULL);
+    self->last = NULL;
+    atomic_store_explicit(ATOMIC_UINT(self->count), 0, memory_order_relaxed);
+
+    ccntr_spinlock_unlock(&self->lock);
+
+    return first;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,272 @@
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "abort_message.h"
+#include "ccntr_sharded_map.h"
+
+#ifdef CCNTR_SHARDED_MAP_ENABLED
+
+typedef ccntr_map_node_t node_t;
+
+//------------------------------------------------------------------------------
+//---- Shards ------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+ccntr_map_t* shard_get_by_key(const ccntr_sharded_map_t *self, const void *key)
+{
+    size_t index = self->hash(key) & ( self->shard_count - 1 );
+    return &self->shards[index].map;
+}
+//------------------------------------------------------------------------------
+//---- Container ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_init(ccntr_sharded_map_t     *self,
+                            ccntr_map_compare_keys_t compare,
+                            ccntr_hash_hash_key_t    hash,
+                            unsigned                 shard_count)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Constructor.
+     *
+     * @param self        Object instance.
+     * @param compare     A function to be used to compare keys.
+     * @param hash        A function to be used to calculate hash value of keys,
+     *                    and keys which are equivalent must have the same hash value.
+     * @param shard_count Count of shards, which will be rounded up to a power of two,
+     *                    and be limited to CCNTR_SHARDED_MAP_MAX_SHARDS.
+     *                    This parameter can be ZERO to use the default count.
+     *
+     * @remarks If @a compare or @a hash is NULL, then
+     *          all keys will be treated as integral values.
+     */
+    if( !shard_count ) shard_count = CCNTR_SHARDED_MAP_DEFAULT_SHARDS;
+    if( shard_count > CCNTR_SHARDED_MAP_MAX_SHARDS ) shard_count = CCNTR_SHARDED_MAP_MAX_SHARDS;
+
+    unsigned count = 1;
+    while( count < shard_count ) count *= 2;
+
+    // Allocate one more cache line to align shards.
+    size_t align = CCNTR_SHARDED_MAP_CACHE_LINE_SIZE;
+    self->shards_buffer = malloc(count * sizeof(ccntr_sharded_map_shard_t) + align - 1);
+    if( !self->shards_buffer ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    uintptr_t addr = ( (uintptr_t) self->shards_buffer + align - 1 ) & ~(uintptr_t)( align - 1 );
+    self->shards      = (ccntr_sharded_map_shard_t*) addr;
+    self->shard_count = count;
+    self->hash        = hash ? hash : ccntr_hash_hash_integral;
+
+    for(unsigned i = 0; i < count; ++i)
+        ccntr_map_init(&self->shards[i].map, compare);
+}
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_destroy(ccntr_sharded_map_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Destructor.
+     * @details The shards will be released,
+     *          and all nodes will be discarded (but not released).
+     *
+     * @param self Object instance.
+     */
+    free(self->shards_buffer);
+
+    self->shards        = NULL;
+    self->shards_buffer = NULL;
+    self->shard_count   = 0;
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_sharded_map_get_count(const ccntr_sharded_map_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     *
+     * @remarks Shards are counted one by one,
+     *          and the result may be inaccurate if other threads are modifying the container.
+     */
+    unsigned count = 0;
+    for(unsigned i = 0; i < self->shard_count; ++i)
+        count += ccntr_map_get_count(&self->shards[i].map);
+
+    return count;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_sharded_map_find(ccntr_sharded_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    return ccntr_map_find(shard_get_by_key(self, key), key);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_sharded_map_link(ccntr_sharded_map_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Link a node into the container.
+     *
+     * @param self Object instance.
+     * @param node The new node to be linked.
+     *             If the container already have a node with the same key,
+     *             then the old node will be pop out,
+     *             and the new one will be saved.
+     * @return A node be pop out which have the same key with the new node;
+     *         or NULL if there do not have node with duplicated keys.
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            or the bahaviour is undefuned!
+     */
+    if( !node ) return NULL;
+    return ccntr_map_link(shard_get_by_key(self, node->key), node);
+}
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_unlink(ccntr_sharded_map_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     *
+     * @attention The node to be unlinkd must be a member of this container,
+     *            or the behaviour is undefuned!
+     */
+    if( !node ) return;
+    ccntr_map_unlink(shard_get_by_key(self, node->key), node);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_sharded_map_unlink_by_key(ccntr_sharded_map_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Search and unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node which just be found and unlinked;
+     *         or NULL if there does not have a node with the key.
+     */
+    return ccntr_map_unlink_by_key(shard_get_by_key(self, key), key);
+}
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_discard_all(ccntr_sharded_map_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_t
+     * @brief Discard all linkage of nodes in the container.
+     *
+     * @param self Object instance.
+     */
+    for(unsigned i = 0; i < self->shard_count; ++i)
+        ccntr_map_discard_all(&self->shards[i].map);
+}
+//------------------------------------------------------------------------------
+//---- Scan --------------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+bool scan_is_less(const ccntr_sharded_map_scan_t *self, unsigned index1, unsigned index2)
+{
+    return self->compare(self->heap[index1]->key, self->heap[index2]->key) < 0;
+}
+//------------------------------------------------------------------------------
+static
+void scan_swap(ccntr_sharded_map_scan_t *self, unsigned index1, unsigned index2)
+{
+    node_t *node = self->heap[index1];
+    self->heap[index1] = self->heap[index2];
+    self->heap[index2] = node;
+}
+//------------------------------------------------------------------------------
+static
+void scan_sift_down(ccntr_sharded_map_scan_t *self, unsigned index)
+{
+    while( true )
+    {
+        unsigned smallest = index;
+        unsigned left     = 2 * index + 1;
+        unsigned right    = 2 * index + 2;
+
+        if( left  < self->count && scan_is_less(self, left,  smallest) ) smallest = left;
+        if( right < self->count && scan_is_less(self, right, smallest) ) smallest = right;
+        if( smallest == index ) break;
+
+        scan_swap(self, index, smallest);
+        index = smallest;
+    }
+}
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_scan_init(ccntr_sharded_map_scan_t *self, ccntr_sharded_map_t *container)
+{
+    /**
+     * @memberof ccntr_sharded_map_scan_t
+     * @brief Constructor.
+     *
+     * @param self      Object instance.
+     * @param container The container to be scanned.
+     */
+    self->heap = malloc(container->shard_count * sizeof(node_t*));
+    if( !self->heap ) abort_message("ERROR: Cannot allocate more memory!\n");
+
+    self->count   = 0;
+    self->compare = container->shards[0].map.compare;
+
+    for(unsigned i = 0; i < container->shard_count; ++i)
+    {
+        node_t *node = ccntr_map_get_first(&container->shards[i].map);
+        if( node ) self->heap[ self->count ++ ] = node;
+    }
+
+    for(unsigned i = self->count / 2; i > 0; --i)
+        scan_sift_down(self, i - 1);
+}
+//------------------------------------------------------------------------------
+void ccntr_sharded_map_scan_destroy(ccntr_sharded_map_scan_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_scan_t
+     * @brief Destructor.
+     *
+     * @param self Object instance.
+     */
+    free(self->heap);
+
+    self->heap  = NULL;
+    self->count = 0;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_sharded_map_scan_get_next(ccntr_sharded_map_scan_t *self)
+{
+    /**
+     * @memberof ccntr_sharded_map_scan_t
+     * @brief Get the next node in key order.
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if all nodes are visited.
+     */
+    if( !self->count ) return NULL;
+
+    node_t *node = self->heap[0];
+    node_t *next = ccntr_map_node_get_next(node);
+    if( next )
+        self->heap[0] = next;
+    else
+        self->heap[0] = self->heap[ -- self->count ];
+
+    scan_sift_down(self, 0);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+
+#endif  // CCNTR_SHARDED_MAP_ENABLED
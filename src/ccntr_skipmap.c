@@ -0,0 +1,532 @@
+#include <stdint.h>
+#include <stdatomic.h>
+#include "ccntr_skipmap.h"
+
+typedef ccntr_skipmap_node_t node_t;
+
+#define LOAD_NEXT(node, level) \
+    atomic_load_explicit((_Atomic(node_t*)*) &(node)->next[(level)], memory_order_acquire)
+#define STORE_NEXT(node, level, value) \
+    atomic_store_explicit((_Atomic(node_t*)*) &(node)->next[(level)], (value), memory_order_release)
+
+#define LOAD_FLAG(var) \
+    atomic_load_explicit((_Atomic(unsigned char)*) &(var), memory_order_acquire)
+#define STORE_FLAG(var, value) \
+    atomic_store_explicit((_Atomic(unsigned char)*) &(var), (value), memory_order_release)
+
+#define ATOMIC_UINT(var) ( (atomic_uint*) &(var) )
+
+//------------------------------------------------------------------------------
+//---- Node Characteristics ----------------------------------------------------
+//------------------------------------------------------------------------------
+static
+unsigned node_random_level(void)
+{
+    static atomic_uint seed_counter = 0;
+    static _Thread_local uint32_t seed = 0;
+
+    if( !seed )
+        seed = 0x9E3779B9u * ( atomic_fetch_add(&seed_counter, 1) + 1 ) | 1;
+
+    // Xorshift random number.
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    // Each level have 1/4 probability to be promoted.
+    unsigned level = 1;
+    for(uint32_t bits = seed; level < CCNTR_SKIPMAP_MAX_LEVEL && !( bits & 3 ); bits >>= 2)
+        ++ level;
+
+    return level;
+}
+//------------------------------------------------------------------------------
+static
+bool node_is_valid(node_t *node)
+{
+    // The node is completely linked and is not being removed.
+    return LOAD_FLAG(node->fully_linked) && !LOAD_FLAG(node->marked);
+}
+//------------------------------------------------------------------------------
+static
+node_t* node_skip_invalid(node_t *node)
+{
+    while( node && !node_is_valid(node) )
+        node = LOAD_NEXT(node, 0);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+//---- Node Lock ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+void nodes_lock(node_t *nodes[], unsigned count)
+{
+    // Nodes are sorted from the larger key to the smaller,
+    // and a node may be appeared multiple times continuously.
+    node_t *locked = NULL;
+    for(unsigned i = 0; i < count; ++i)
+    {
+        if( nodes[i] == locked ) continue;
+
+        locked = nodes[i];
+        ccntr_spinlock_lock(&locked->lock);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void nodes_unlock(node_t *nodes[], unsigned count)
+{
+    node_t *locked = NULL;
+    for(unsigned i = 0; i < count; ++i)
+    {
+        if( nodes[i] == locked ) continue;
+
+        locked = nodes[i];
+        ccntr_spinlock_unlock(&locked->lock);
+    }
+}
+//------------------------------------------------------------------------------
+//---- Node Search -------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+int list_find_preds(ccntr_skipmap_t *self, const void *key, node_t *preds[], node_t *succs[])
+{
+    /*
+     * Search for the last nodes less than the key (preds),
+     * and the nodes next to them (succs) in each level.
+     * Return the highest level that have a node with the key; or -1 if not found.
+     */
+    int     found = -1;
+    node_t *pred  = &self->head;
+
+    for(int level = CCNTR_SKIPMAP_MAX_LEVEL - 1; level >= 0; --level)
+    {
+        node_t *curr = LOAD_NEXT(pred, level);
+        int comp_res = 1;
+        while( curr && ( comp_res = self->compare(curr->key, key) ) < 0 )
+        {
+            pred = curr;
+            curr = LOAD_NEXT(pred, level);
+        }
+
+        if( found < 0 && curr && comp_res == 0 )
+            found = level;
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return found;
+}
+//------------------------------------------------------------------------------
+//---- Container Iterator ------------------------------------------------------
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_node_get_next(node_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_node_t
+     * @brief Get the next node (in order).
+     *
+     * @param self Object instance.
+     * @return The next node; or NULL if there does not have the next node.
+     */
+    return node_skip_invalid(LOAD_NEXT(self, 0));
+}
+//------------------------------------------------------------------------------
+//---- Container ---------------------------------------------------------------
+//------------------------------------------------------------------------------
+static
+int compare_default(const void *key1, const void *key2)
+{
+    return ( (intptr_t) key1 > (intptr_t) key2 ) - ( (intptr_t) key1 < (intptr_t) key2 );
+}
+//------------------------------------------------------------------------------
+void ccntr_skipmap_init(ccntr_skipmap_t *self, ccntr_map_compare_keys_t compare)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Constructor.
+     *
+     * @param self    Object instance.
+     * @param compare A function to be used to compare keys.
+     *                If this parameter is NULL, then
+     *                all keys will be treated as integral values.
+     */
+    self->head.key          = NULL;
+    self->head.level        = CCNTR_SKIPMAP_MAX_LEVEL;
+    self->head.marked       = 0;
+    self->head.fully_linked = 1;
+    ccntr_spinlock_init(&self->head.lock);
+
+    for(unsigned level = 0; level < CCNTR_SKIPMAP_MAX_LEVEL; ++level)
+        self->head.next[level] = NULL;
+
+    atomic_init(ATOMIC_UINT(self->count), 0);
+    self->compare = compare ? compare : compare_default;
+}
+//------------------------------------------------------------------------------
+unsigned ccntr_skipmap_get_count(const ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get nodes count.
+     *
+     * @param self Object instance.
+     * @return The nodes count.
+     */
+    return atomic_load(ATOMIC_UINT(self->count));
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_get_first(ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the first node (in order).
+     *
+     * @param self Object instance.
+     * @return The first node; or NULL if no any nodes contained.
+     */
+    return node_skip_invalid(LOAD_NEXT(&self->head, 0));
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_get_last(ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the last node (in order).
+     *
+     * @param self Object instance.
+     * @return The last node; or NULL if no any nodes contained.
+     */
+    while( true )
+    {
+        node_t *node = &self->head;
+        for(int level = CCNTR_SKIPMAP_MAX_LEVEL - 1; level >= 0; --level)
+        {
+            node_t *next;
+            while(( next = LOAD_NEXT(node, level) ))
+                node = next;
+        }
+
+        if( node == &self->head ) return NULL;
+        if( node_is_valid(node) ) return node;
+
+        // The last node is being linked or unlinked, search for the previous one.
+        node = ccntr_skipmap_get_prev(self, node);
+        if( !node || node_skip_invalid(node) == node ) return node;
+    }
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_get_prev(ccntr_skipmap_t *self, const node_t *node)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Get the previous node (in order) of a specific node.
+     *
+     * @param self Object instance.
+     * @param node A node in the container.
+     * @return The previous node; or NULL if there does not have the previous node.
+     *
+     * @remarks The skip list is linked in one direction only,
+     *          so that this function needs a search from the top level
+     *          and takes O(log n) time.
+     */
+    node_t *preds[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *succs[CCNTR_SKIPMAP_MAX_LEVEL];
+
+    while( true )
+    {
+        list_find_preds(self, node->key, preds, succs);
+
+        node_t *pred = preds[0];
+        if( pred == &self->head ) return NULL;
+        if( node_is_valid(pred) ) return pred;
+
+        // The previous node is being linked or unlinked, and search again.
+        if( !LOAD_FLAG(pred->marked) )
+            node = pred;
+    }
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_find(ccntr_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find node by key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    node_t *node = &self->head;
+    for(int level = CCNTR_SKIPMAP_MAX_LEVEL - 1; level >= 0; --level)
+    {
+        node_t *curr = LOAD_NEXT(node, level);
+        while( curr )
+        {
+            int comp_res = self->compare(curr->key, key);
+            if( comp_res > 0 ) break;
+            if( comp_res == 0 ) return node_is_valid(curr) ? curr : NULL;
+
+            node = curr;
+            curr = LOAD_NEXT(node, level);
+        }
+    }
+
+    return NULL;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_find_nearest_less(ccntr_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find nearest node which is less or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    node_t *preds[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *succs[CCNTR_SKIPMAP_MAX_LEVEL];
+
+    while( true )
+    {
+        int found = list_find_preds(self, key, preds, succs);
+        if( found >= 0 && node_is_valid(succs[found]) )
+            return succs[found];
+
+        node_t *pred = preds[0];
+        if( pred == &self->head ) return NULL;
+        if( node_is_valid(pred) ) return pred;
+
+        // The previous node is being linked or unlinked.
+        if( !LOAD_FLAG(pred->marked) )
+            return ccntr_skipmap_get_prev(self, pred);
+    }
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_find_nearest_great(ccntr_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Find nearest node which is greater or equal than the specified key.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node if found; and NULL if not found.
+     */
+    node_t *preds[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *succs[CCNTR_SKIPMAP_MAX_LEVEL];
+
+    list_find_preds(self, key, preds, succs);
+    return node_skip_invalid(succs[0]);
+}
+//------------------------------------------------------------------------------
+static
+bool validate_link(node_t *preds[], node_t *succs[], unsigned level_count)
+{
+    for(unsigned level = 0; level < level_count; ++level)
+    {
+        node_t *pred = preds[level];
+        node_t *succ = succs[level];
+
+        if( LOAD_FLAG(pred->marked) ) return false;
+        if( succ && LOAD_FLAG(succ->marked) ) return false;
+        if( LOAD_NEXT(pred, level) != succ ) return false;
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_link(ccntr_skipmap_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Link a node into the container.
+     *
+     * @param self Object instance.
+     * @param node The new node to be linked.
+     * @return The node which already in the container and have the same key
+     *         with the new node, and the new node will not be linked in that case;
+     *         or NULL if the new node be linked.
+     *
+     * @attention The new node to be linked must be isolated (not linked in any container),
+     *            or the bahaviour is undefuned!
+     *
+     * @remarks Different from ccntr_map_t::ccntr_map_link,
+     *          an existed node will not be replaced by the new one,
+     *          because nodes in the container may be accessed by
+     *          concurrent readers at any time.
+     */
+    if( !node ) return NULL;
+
+    node_t *preds[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *succs[CCNTR_SKIPMAP_MAX_LEVEL];
+    unsigned level_count = node_random_level();
+
+    while( true )
+    {
+        int found = list_find_preds(self, node->key, preds, succs);
+        if( found >= 0 )
+        {
+            node_t *existed = succs[found];
+            if( !LOAD_FLAG(existed->marked) )
+            {
+                // Wait for the node be completely linked by the other thread.
+                while( !LOAD_FLAG(existed->fully_linked) )
+                {}
+
+                return existed;
+            }
+
+            // The existed node is being unlinked, and try again.
+            continue;
+        }
+
+        nodes_lock(preds, level_count);
+
+        if( !validate_link(preds, succs, level_count) )
+        {
+            nodes_unlock(preds, level_count);
+            continue;
+        }
+
+        node->level        = level_count;
+        node->marked       = 0;
+        node->fully_linked = 0;
+        ccntr_spinlock_init(&node->lock);
+
+        for(unsigned level = 0; level < CCNTR_SKIPMAP_MAX_LEVEL; ++level)
+            node->next[level] = ( level < level_count )?( succs[level] ):( NULL );
+
+        for(unsigned level = 0; level < level_count; ++level)
+            STORE_NEXT(preds[level], level, node);
+
+        STORE_FLAG(node->fully_linked, 1);
+
+        nodes_unlock(preds, level_count);
+
+        atomic_fetch_add(ATOMIC_UINT(self->count), 1);
+
+        return NULL;
+    }
+}
+//------------------------------------------------------------------------------
+static
+bool validate_unlink(node_t *preds[], node_t *victim, unsigned level_count)
+{
+    for(unsigned level = 0; level < level_count; ++level)
+    {
+        node_t *pred = preds[level];
+
+        if( LOAD_FLAG(pred->marked) ) return false;
+        if( LOAD_NEXT(pred, level) != victim ) return false;
+    }
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+node_t* list_unlink(ccntr_skipmap_t *self, const void *key, node_t *expected)
+{
+    node_t *preds[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *succs[CCNTR_SKIPMAP_MAX_LEVEL];
+    node_t *victim = NULL;
+    unsigned level_count = 0;
+
+    while( true )
+    {
+        int found = list_find_preds(self, key, preds, succs);
+
+        if( !victim )
+        {
+            if( found < 0 ) return NULL;
+
+            node_t *node = succs[found];
+            if( expected && node != expected ) return NULL;
+
+            // The node must be completely linked, and is found in its top level.
+            if( !node_is_valid(node) || node->level != found + 1 ) return NULL;
+
+            ccntr_spinlock_lock(&node->lock);
+            if( LOAD_FLAG(node->marked) )
+            {
+                // The node is being unlinked by the other thread.
+                ccntr_spinlock_unlock(&node->lock);
+                return NULL;
+            }
+
+            // Mark the node (logical unlink), and keep it locked.
+            STORE_FLAG(node->marked, 1);
+            victim      = node;
+            level_count = node->level;
+        }
+
+        nodes_lock(preds, level_count);
+
+        if( !validate_unlink(preds, victim, level_count) )
+        {
+            nodes_unlock(preds, level_count);
+            continue;
+        }
+
+        for(int level = level_count - 1; level >= 0; --level)
+            STORE_NEXT(preds[level], level, LOAD_NEXT(victim, level));
+
+        ccntr_spinlock_unlock(&victim->lock);
+        nodes_unlock(preds, level_count);
+
+        atomic_fetch_sub(ATOMIC_UINT(self->count), 1);
+
+        return victim;
+    }
+}
+//------------------------------------------------------------------------------
+bool ccntr_skipmap_unlink(ccntr_skipmap_t *self, node_t *node)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param node The node which is linked in the container.
+     * @return TRUE if the node be unlinked by this call;
+     *         and FALSE if the node is not in the container
+     *         (or it is unlinked by the other thread).
+     */
+    if( !node ) return false;
+
+    return list_unlink(self, node->key, node);
+}
+//------------------------------------------------------------------------------
+node_t* ccntr_skipmap_unlink_by_key(ccntr_skipmap_t *self, const void *key)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Search and unlink a node from the container.
+     *
+     * @param self Object instance.
+     * @param key  Key of the node.
+     * @return The node which just be found and unlinked;
+     *         or NULL if there does not have a node with the key.
+     */
+    return list_unlink(self, key, NULL);
+}
+//------------------------------------------------------------------------------
+void ccntr_skipmap_discard_all(ccntr_skipmap_t *self)
+{
+    /**
+     * @memberof ccntr_skipmap_t
+     * @brief Discard all linkage of nodes in the container.
+     *
+     * @param self Object instance.
+     *
+     * @attention This function is not safe with concurrent operations.
+     */
+    for(unsigned level = 0; level < CCNTR_SKIPMAP_MAX_LEVEL; ++level)
+        STORE_NEXT(&self->head, level, NULL);
+
+    atomic_store(ATOMIC_UINT(self->count), 0);
+}
+//------------------------------------------------------------------------------
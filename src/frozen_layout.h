@@ -0,0 +1,86 @@
+#ifndef _FROZEN_LAYOUT_H_
+#define _FROZEN_LAYOUT_H_
+
+/*
+ * Keys are placed in the Eytzinger layout:
+ * the root is at index 1, and children of index i are at 2i and 2i+1.
+ * Descendants four levels below a node are contiguous (from index 16i),
+ * and are prefetched while the search goes through the next levels.
+ */
+#define PREFETCH_FACTOR 16
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define PREFETCH(addr) __builtin_prefetch(addr)
+#else
+    #define PREFETCH(addr)
+#endif
+
+static inline
+unsigned layout_leave_right_path(unsigned index)
+{
+    // Climb while the node is a right child, and then climb once more,
+    // that is the last ancestor which the path turned left from.
+
+#if defined(__GNUC__) || defined(__clang__)
+    return index >> ( __builtin_ctz(~index) + 1 );
+#else
+    while( index & 1 ) index >>= 1;
+    return index >> 1;
+#endif
+}
+
+static inline
+unsigned layout_leave_left_path(unsigned index)
+{
+    // Climb while the node is a left child, and then climb once more,
+    // that is the last ancestor which the path turned right from.
+
+    while( !( index & 1 ) ) index >>= 1;
+    return index >> 1;
+}
+
+static inline
+unsigned layout_get_first(unsigned count)
+{
+    if( !count ) return 0;
+
+    unsigned index = 1;
+    while( 2 * index <= count ) index = 2 * index;
+
+    return index;
+}
+
+static inline
+unsigned layout_get_last(unsigned count)
+{
+    if( !count ) return 0;
+
+    unsigned index = 1;
+    while( 2 * index + 1 <= count ) index = 2 * index + 1;
+
+    return index;
+}
+
+static inline
+unsigned layout_get_next(unsigned index, unsigned count)
+{
+    if( 2 * index + 1 > count ) return layout_leave_right_path(index);
+
+    index = 2 * index + 1;
+    while( 2 * index <= count ) index = 2 * index;
+
+    return index;
+}
+
+static inline
+unsigned layout_get_prev(unsigned index, unsigned count)
+{
+    if( 2 * index > count ) return layout_leave_left_path(index);
+
+    index = 2 * index;
+    while( 2 * index + 1 <= count ) index = 2 * index + 1;
+
+    return index;
+}
+
+#endif
@@ -2,6 +2,9 @@
 
 #include "test_list.h"
 #include "test_man_list.h"
+#include "test_man_ulist.h"
+#include "test_rculist.h"
+#include "test_man_rculist.h"
 
 #include "test_queue.h"
 #include "test_man_queue.h"
@@ -11,6 +14,23 @@
 
 #include "test_map.h"
 #include "test_man_map.h"
+#include "test_man_smap.h"
+#include "test_frozen_map.h"
+#include "test_frozen_image.h"
+#include "test_itree.h"
+
+#include "test_lru.h"
+#include "test_man_lru.h"
+
+#include "test_skipmap.h"
+#include "test_man_skipmap.h"
+#include "test_hash.h"
+#include "test_man_hash.h"
+#include "test_man_flathash.h"
+#include "test_man_btree.h"
+#include "test_sharded_map.h"
+#include "test_man_pmap.h"
+#include "test_man_art.h"
 
 int main(void)
 {
@@ -20,6 +40,9 @@ int main(void)
 
     if(( ret = test_list() )) return ret;
     if(( ret = test_man_list() )) return ret;
+    if(( ret = test_man_ulist() )) return ret;
+    if(( ret = test_rculist() )) return ret;
+    if(( ret = test_man_rculist() )) return ret;
 
     if(( ret = test_queue() )) return ret;
     if(( ret = test_man_queue() )) return ret;
@@ -29,6 +52,23 @@ int main(void)
 
     if(( ret = test_map() )) return ret;
     if(( ret = test_man_map() )) return ret;
+    if(( ret = test_man_smap() )) return ret;
+    if(( ret = test_frozen_map() )) return ret;
+    if(( ret = test_frozen_image() )) return ret;
+    if(( ret = test_itree() )) return ret;
+
+    if(( ret = test_lru() )) return ret;
+    if(( ret = test_man_lru() )) return ret;
+
+    if(( ret = test_skipmap() )) return ret;
+    if(( ret = test_man_skipmap() )) return ret;
+    if(( ret = test_hash() )) return ret;
+    if(( ret = test_man_hash() )) return ret;
+    if(( ret = test_man_flathash() )) return ret;
+    if(( ret = test_man_btree() )) return ret;
+    if(( ret = test_sharded_map() )) return ret;
+    if(( ret = test_man_pmap() )) return ret;
+    if(( ret = test_man_art() )) return ret;
 
     return 0;
 }
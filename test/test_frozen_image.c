@@ -0,0 +1,236 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_frozen_image.h"
+
+//------------------------------------------------------------------------------
+static
+void* key_from_int(int key)
+{
+    return (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+size_t value_serialise(const void *value, void *buffer)
+{
+    size_t size = strlen(value) + 1;
+    if( buffer ) memcpy(buffer, value, size);
+
+    return size;
+}
+//------------------------------------------------------------------------------
+static
+size_t value_serialise_growing(const void *value, void *buffer)
+{
+    // The size of values are increased on each call.
+    static size_t size = 0;
+    ++ size;
+    if( buffer ) memset(buffer, 0xFF, size);
+
+    return size;
+}
+//------------------------------------------------------------------------------
+static
+int compare_reversed(const void *key1, const void *key2)
+{
+    intptr_t num1 = (intptr_t) key1;
+    intptr_t num2 = (intptr_t) key2;
+    return num1 < num2 ? 1 : num1 > num2 ? -1 : 0;
+}
+//------------------------------------------------------------------------------
+static
+void* image_create(int count, size_t *size)
+{
+    // Keys of the image are even numbers from -count,
+    // and values are strings of the key.
+
+    ccntr_man_map_t map;
+    ccntr_man_map_init(&map, NULL, NULL, free);
+
+    for(int k = 0; k < count; ++k)
+    {
+        int   key   = 2 * ( k * 7 % count ) - count;
+        char *value = malloc(32);
+        sprintf(value, "value%d", key);
+        ccntr_man_map_insert(&map, key_from_int(key), value);
+    }
+
+    ccntr_frozen_map_t frozen;
+    ccntr_man_map_freeze(&map, &frozen);
+    ccntr_man_map_destroy(&map);
+
+    *size = ccntr_frozen_map_write_image(&frozen, value_serialise, NULL, 0);
+    assert_true( *size );
+    assert_int_equal( ccntr_frozen_map_write_image(&frozen, value_serialise, NULL, *size), *size );
+
+    void *data = malloc(*size);
+    assert_int_equal( ccntr_frozen_map_write_image(&frozen, value_serialise, data, *size - 1), *size );
+    assert_int_equal( ccntr_frozen_map_write_image(&frozen, value_serialise, data, *size), *size );
+
+    ccntr_frozen_map_destroy(&frozen);
+
+    return data;
+}
+//------------------------------------------------------------------------------
+static
+void frozen_image_search_test(void **state)
+{
+    static const int counts[] = { 0, 1, 2, 3, 8, 100, 1000 };
+
+    for(unsigned i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        int count = counts[i];
+
+        // The image is position independent,
+        // and is still valid after moved to another address.
+        size_t size;
+        void  *written = image_create(count, &size);
+        void  *data    = malloc(size);
+        memcpy(data, written, size);
+        free(written);
+
+        ccntr_frozen_image_t image;
+        assert_true( ccntr_frozen_image_open(&image, data, size) );
+        assert_int_equal( ccntr_frozen_image_get_count(&image), count );
+
+        int key = -count;
+        for(ccntr_frozen_image_iter_t iter = ccntr_frozen_image_get_first(&image);
+            ccntr_frozen_image_iter_have_value(&iter);
+            ccntr_frozen_image_iter_move_next(&iter))
+        {
+            char expect[32];
+            sprintf(expect, "value%d", key);
+
+            size_t value_size;
+            assert_int_equal( ccntr_frozen_image_iter_get_key(&iter), key );
+            assert_string_equal( ccntr_frozen_image_iter_get_value(&iter, &value_size), expect );
+            assert_int_equal( value_size, strlen(expect) + 1 );
+            key += 2;
+        }
+        assert_int_equal( key, count );
+
+        for(ccntr_frozen_image_iter_t iter = ccntr_frozen_image_get_last(&image);
+            ccntr_frozen_image_iter_have_value(&iter);
+            ccntr_frozen_image_iter_move_prev(&iter))
+        {
+            key -= 2;
+            assert_int_equal( ccntr_frozen_image_iter_get_key(&iter), key );
+        }
+        assert_int_equal( key, -count );
+
+        for(key = -count - 1; key <= count; ++key)
+        {
+            bool exist = key >= -count && key < count && ( key + count ) % 2 == 0;
+
+            ccntr_frozen_image_iter_t iter = ccntr_frozen_image_find(&image, key);
+            if( exist )
+                assert_int_equal( ccntr_frozen_image_iter_get_key(&iter), key );
+            else
+                assert_false( ccntr_frozen_image_iter_have_value(&iter) );
+
+            int less = exist ? key : key - 1;
+            if( less > count - 2 ) less = count - 2;
+            iter = ccntr_frozen_image_find_nearest_less(&image, key);
+            if( less >= -count )
+                assert_int_equal( ccntr_frozen_image_iter_get_key(&iter), less );
+            else
+                assert_false( ccntr_frozen_image_iter_have_value(&iter) );
+
+            int great = exist ? key : key + 1;
+            if( great < -count ) great = -count;
+            iter = ccntr_frozen_image_find_nearest_great(&image, key);
+            if( great < count )
+                assert_int_equal( ccntr_frozen_image_iter_get_key(&iter), great );
+            else
+                assert_false( ccntr_frozen_image_iter_have_value(&iter) );
+        }
+
+        char expect[32];
+        sprintf(expect, "value%d", -count);
+        if( count )
+            assert_string_equal( ccntr_frozen_image_find_value(&image, -count, NULL), expect );
+        assert_null( ccntr_frozen_image_find_value(&image, count, NULL) );
+
+        free(data);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void frozen_image_invalid_test(void **state)
+{
+    size_t size;
+    char  *data = image_create(10, &size);
+
+    ccntr_frozen_image_t image;
+    assert_false( ccntr_frozen_image_open(&image, NULL, size) );
+    assert_false( ccntr_frozen_image_open(&image, data, 16) );
+    assert_false( ccntr_frozen_image_open(&image, data, size - 1) );
+    assert_int_equal( ccntr_frozen_image_get_count(&image), 0 );
+
+    ccntr_frozen_image_iter_t iter = ccntr_frozen_image_get_first(&image);
+    assert_false( ccntr_frozen_image_iter_have_value(&iter) );
+    assert_null( ccntr_frozen_image_find_value(&image, 0, NULL) );
+
+    // Misaligned data.
+    char *moved = malloc(size + 8);
+    memcpy(moved + 4, data, size);
+    assert_false( ccntr_frozen_image_open(&image, moved + 4, size) );
+    free(moved);
+
+    // Corrupted magic number.
+    data[0] ^= 1;
+    assert_false( ccntr_frozen_image_open(&image, data, size) );
+    data[0] ^= 1;
+    assert_true( ccntr_frozen_image_open(&image, data, size) );
+
+    free(data);
+
+    // Keys which are not sorted by their integer values cannot be written.
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_reversed);
+
+    ccntr_map_node_t nodes[3];
+    for(int k = 0; k < 3; ++k)
+    {
+        nodes[k].key = key_from_int(k);
+        ccntr_map_link(&map, &nodes[k]);
+    }
+
+    ccntr_frozen_map_t frozen;
+    ccntr_map_freeze(&map, &frozen);
+    assert_int_equal( ccntr_frozen_map_write_image(&frozen, NULL, NULL, 0), 0 );
+
+    ccntr_frozen_map_destroy(&frozen);
+    ccntr_map_discard_all(&map);
+
+    // Values which grow after the image size be calculated cannot be written.
+    ccntr_map_init(&map, NULL);
+    for(int k = 0; k < 3; ++k)
+        ccntr_map_link(&map, &nodes[k]);
+    ccntr_map_freeze(&map, &frozen);
+
+    size = ccntr_frozen_map_write_image(&frozen, value_serialise_growing, NULL, 0);
+    data = malloc(size);
+    assert_int_equal( ccntr_frozen_map_write_image(&frozen, value_serialise_growing, data, size), 0 );
+    free(data);
+
+    ccntr_frozen_map_destroy(&frozen);
+    ccntr_map_discard_all(&map);
+}
+//------------------------------------------------------------------------------
+int test_frozen_image(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(frozen_image_search_test),
+        cmocka_unit_test(frozen_image_invalid_test),
+    };
+
+    return cmocka_run_group_tests_name("frozen map image test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_FROZEN_IMAGE_H_
+#define _TEST_FROZEN_IMAGE_H_
+
+int test_frozen_image(void);
+
+#endif
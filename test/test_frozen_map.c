@@ -0,0 +1,165 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_frozen_map.h"
+
+typedef ccntr_map_node_t node_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+void* key_from_int(int key)
+{
+    return (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+int key_to_int(const void *key)
+{
+    return (intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+void value_release(void *value)
+{
+    ++ released_count;
+    free(value);
+}
+//------------------------------------------------------------------------------
+static
+void frozen_map_check(const ccntr_frozen_map_t *frozen, int count)
+{
+    // Keys of the map are even numbers from zero.
+
+    assert_int_equal( ccntr_frozen_map_get_count(frozen), count );
+
+    int key = 0;
+    for(ccntr_frozen_map_iter_t iter = ccntr_frozen_map_get_first(frozen);
+        ccntr_frozen_map_iter_have_value(&iter);
+        ccntr_frozen_map_iter_move_next(&iter))
+    {
+        assert_int_equal( key_to_int(ccntr_frozen_map_iter_get_key(&iter)), key );
+        key += 2;
+    }
+    assert_int_equal( key, 2 * count );
+
+    for(ccntr_frozen_map_iter_t iter = ccntr_frozen_map_get_last(frozen);
+        ccntr_frozen_map_iter_have_value(&iter);
+        ccntr_frozen_map_iter_move_prev(&iter))
+    {
+        key -= 2;
+        assert_int_equal( key_to_int(ccntr_frozen_map_iter_get_key(&iter)), key );
+    }
+    assert_int_equal( key, 0 );
+
+    for(key = -1; key <= 2 * count; ++key)
+    {
+        ccntr_frozen_map_iter_t iter = ccntr_frozen_map_find(frozen, key_from_int(key));
+        if( key >= 0 && key < 2 * count && key % 2 == 0 )
+            assert_int_equal( key_to_int(ccntr_frozen_map_iter_get_key(&iter)), key );
+        else
+            assert_false( ccntr_frozen_map_iter_have_value(&iter) );
+
+        int less = key % 2 ? key - 1 : key;
+        iter = ccntr_frozen_map_find_nearest_less(frozen, key_from_int(key));
+        if( less > 2 * count - 2 ) less = 2 * count - 2;
+        if( less >= 0 )
+            assert_int_equal( key_to_int(ccntr_frozen_map_iter_get_key(&iter)), less );
+        else
+            assert_false( ccntr_frozen_map_iter_have_value(&iter) );
+
+        int great = key % 2 ? key + 1 : key;
+        iter = ccntr_frozen_map_find_nearest_great(frozen, key_from_int(key));
+        if( great < 2 * count )
+            assert_int_equal( key_to_int(ccntr_frozen_map_iter_get_key(&iter)), great );
+        else
+            assert_false( ccntr_frozen_map_iter_have_value(&iter) );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void frozen_map_from_map_test(void **state)
+{
+    static const int counts[] = { 0, 1, 2, 3, 7, 8, 100, 1000 };
+
+    for(unsigned i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        int count = counts[i];
+
+        ccntr_map_t map;
+        ccntr_map_init(&map, NULL);
+
+        node_t *nodes = malloc(( count + 1 ) * sizeof(node_t));
+        for(int k = count - 1; k >= 0; --k)
+        {
+            nodes[k].key = key_from_int(2 * k);
+            ccntr_map_link(&map, &nodes[k]);
+        }
+
+        ccntr_frozen_map_t frozen;
+        ccntr_map_freeze(&map, &frozen);
+        frozen_map_check(&frozen, count);
+
+        // Values are nodes of the map.
+        if( count )
+            assert_ptr_equal( ccntr_frozen_map_find_value(&frozen, key_from_int(2 * count - 2)), &nodes[ count - 1 ] );
+        assert_null( ccntr_frozen_map_find_value(&frozen, key_from_int(-2)) );
+
+        ccntr_frozen_map_destroy(&frozen);
+        assert_int_equal( ccntr_map_get_count(&map), count );
+
+        ccntr_map_discard_all(&map);
+        free(nodes);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void frozen_map_from_man_map_test(void **state)
+{
+    enum { count = 500 };
+
+    ccntr_man_map_t map;
+    ccntr_man_map_init(&map, NULL, NULL, value_release);
+    released_count = 0;
+
+    for(int k = 0; k < count; ++k)
+    {
+        int *value = malloc(sizeof(int));
+        *value = 3 * k;
+        ccntr_man_map_insert(&map, key_from_int(2 * ( k * 7 % count )), value);
+    }
+
+    // Values are moved to the frozen map.
+    ccntr_frozen_map_t frozen;
+    ccntr_man_map_freeze(&map, &frozen);
+    assert_int_equal( ccntr_man_map_get_count(&map), 0 );
+    assert_int_equal( released_count, 0 );
+
+    frozen_map_check(&frozen, count);
+    for(int k = 0; k < count; ++k)
+    {
+        const int *value = ccntr_frozen_map_find_value(&frozen, key_from_int(2 * ( k * 7 % count )));
+        assert_int_equal( *value, 3 * k );
+    }
+
+    ccntr_frozen_map_destroy(&frozen);
+    assert_int_equal( released_count, count );
+
+    ccntr_man_map_destroy(&map);
+}
+//------------------------------------------------------------------------------
+int test_frozen_map(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(frozen_map_from_map_test),
+        cmocka_unit_test(frozen_map_from_man_map_test),
+    };
+
+    return cmocka_run_group_tests_name("frozen map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
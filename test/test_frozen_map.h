@@ -0,0 +1,6 @@
+#ifndef _TEST_FROZEN_MAP_H_
+#define _TEST_FROZEN_MAP_H_
+
+int test_frozen_map(void);
+
+#endif
@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_hash.h"
+
+typedef ccntr_hash_node_t node_t;
+
+//------------------------------------------------------------------------------
+static
+void node_init(node_t *node, int key)
+{
+    node->key = (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+bool verify_nodes(ccntr_hash_t *hash, const node_t *nodes, unsigned count)
+{
+    // Verify that each of the linked nodes be iterated exactly once.
+
+    if( ccntr_hash_get_count(hash) != count ) return false;
+
+    unsigned iterated = 0;
+    unsigned long long sum = 0;
+    for(const node_t *node = ccntr_hash_get_first_c(hash);
+        node;
+        node = ccntr_hash_get_next_c(hash, node))
+    {
+        if( ccntr_hash_find_c(hash, node->key) != node ) return false;
+
+        sum += node - nodes;
+        ++ iterated;
+    }
+
+    return iterated == count && sum == (unsigned long long) count * ( count - 1 ) / 2;
+}
+//------------------------------------------------------------------------------
+static
+void hash_link_and_find_test(void **state)
+{
+    enum { count = 1000 };
+
+    static node_t nodes[count];
+    node_t duplicated;
+
+    ccntr_hash_t hash;
+    ccntr_hash_init(&hash, NULL, NULL);
+
+    assert_null( ccntr_hash_get_first(&hash) );
+    assert_null( ccntr_hash_find(&hash, (void*)(intptr_t) 0) );
+
+    // Link nodes, and the table will be resized for many times.
+    for(unsigned i = 0; i < count; ++i)
+    {
+        node_init(&nodes[i], 3 * i);
+        assert_null( ccntr_hash_link(&hash, &nodes[i]) );
+        assert_ptr_equal( ccntr_hash_find(&hash, (void*)(intptr_t)( 3 * i )), &nodes[i] );
+        assert_ptr_equal( ccntr_hash_find(&hash, (void*)(intptr_t) 0), &nodes[0] );
+    }
+    assert_true( verify_nodes(&hash, nodes, count) );
+
+    for(unsigned i = 0; i < 3 * count; ++i)
+    {
+        const node_t *node = ccntr_hash_find_c(&hash, (void*)(intptr_t) i);
+        assert_ptr_equal( node, ( i % 3 )?( NULL ):( &nodes[i/3] ) );
+    }
+
+    // Existed node will be replaced.
+    node_init(&duplicated, 3 * 10);
+    assert_ptr_equal( ccntr_hash_link(&hash, &duplicated), &nodes[10] );
+    assert_ptr_equal( ccntr_hash_find(&hash, (void*)(intptr_t) 30), &duplicated );
+    assert_int_equal( ccntr_hash_get_count(&hash), count );
+    assert_ptr_equal( ccntr_hash_link(&hash, &nodes[10]), &duplicated );
+
+    // Unlink nodes, and the table will be shrunk.
+    for(unsigned i = count - 1; i >= 10; --i)
+    {
+        if( i & 1 )
+            ccntr_hash_unlink(&hash, &nodes[i]);
+        else
+            assert_ptr_equal( ccntr_hash_unlink_by_key(&hash, (void*)(intptr_t)( 3 * i )), &nodes[i] );
+
+        assert_null( ccntr_hash_find(&hash, (void*)(intptr_t)( 3 * i )) );
+        assert_ptr_equal( ccntr_hash_find(&hash, (void*)(intptr_t) 0), &nodes[0] );
+    }
+    assert_null( ccntr_hash_unlink_by_key(&hash, (void*)(intptr_t) 30) );
+    assert_true( verify_nodes(&hash, nodes, 10) );
+
+    // Node can be linked again after it be unlinked.
+    assert_null( ccntr_hash_link(&hash, &nodes[10]) );
+    assert_true( verify_nodes(&hash, nodes, 11) );
+
+    ccntr_hash_discard_all(&hash);
+    assert_int_equal( ccntr_hash_get_count(&hash), 0 );
+    assert_null( ccntr_hash_get_first(&hash) );
+    assert_null( ccntr_hash_find(&hash, (void*)(intptr_t) 0) );
+
+    ccntr_hash_destroy(&hash);
+}
+//------------------------------------------------------------------------------
+static
+size_t hash_collided(const void *key)
+{
+    return (intptr_t) key % 2;
+}
+
+static
+void hash_collision_test(void **state)
+{
+    static const unsigned count = 100;
+
+    node_t nodes[count];
+
+    ccntr_hash_t hash;
+    ccntr_hash_init(&hash, hash_collided, NULL);
+
+    // All nodes are placed in two buckets.
+    for(unsigned i = 0; i < count; ++i)
+    {
+        node_init(&nodes[i], i);
+        assert_null( ccntr_hash_link(&hash, &nodes[i]) );
+    }
+    assert_true( verify_nodes(&hash, nodes, count) );
+
+    for(unsigned i = 0; i < count; i += 2)
+        ccntr_hash_unlink(&hash, &nodes[i]);
+    assert_int_equal( ccntr_hash_get_count(&hash), count / 2 );
+
+    for(unsigned i = 0; i < count; ++i)
+    {
+        const node_t *node = ccntr_hash_find_c(&hash, (void*)(intptr_t) i);
+        assert_ptr_equal( node, ( i & 1 )?( &nodes[i] ):( NULL ) );
+    }
+
+    ccntr_hash_destroy(&hash);
+}
+//------------------------------------------------------------------------------
+int test_hash(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(hash_link_and_find_test),
+        cmocka_unit_test(hash_collision_test),
+    };
+
+    return cmocka_run_group_tests_name("hash map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
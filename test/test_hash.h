@@ -0,0 +1,6 @@
+#ifndef _TEST_HASH_H_
+#define _TEST_HASH_H_
+
+int test_hash(void);
+
+#endif
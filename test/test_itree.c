@@ -0,0 +1,150 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_itree.h"
+
+typedef ccntr_itree_node_t node_t;
+
+enum { node_count = 500 };
+
+//------------------------------------------------------------------------------
+static
+void nodes_init(node_t nodes[])
+{
+    // Intervals with pseudo random bounds and lengths, and some of them are duplicated.
+    for(int i = 0; i < node_count; ++i)
+    {
+        int low = ( i * 37 ) % 1000;
+        int len = 1 + ( i * 13 ) % 50;
+        if( i % 10 == 9 )
+        {
+            low = nodes[ i - 1 ].low;
+            len = nodes[ i - 1 ].high - low;
+        }
+
+        ccntr_itree_node_init(&nodes[i], low, low + len);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void overlap_check(ccntr_itree_t *tree, const node_t nodes[], const bool linked[], int low, int high)
+{
+    // Compare the search result with the brute force result,
+    // and an empty range overlaps nothing.
+
+    unsigned expected = 0;
+    for(int i = 0; i < node_count && low < high; ++i)
+    {
+        if( linked[i] && nodes[i].low < high && low < nodes[i].high )
+            ++ expected;
+    }
+
+    unsigned found = 0;
+    const node_t *prev = NULL;
+    for(node_t *node = ccntr_itree_find_first_overlap(tree, low, high);
+        node;
+        node = ccntr_itree_find_next_overlap(tree, node, low, high))
+    {
+        assert_true( node->low < high && low < node->high );
+        assert_true( linked[ node - nodes ] );
+        if( prev ) assert_true( prev->low <= node->low );
+
+        prev = node;
+        ++ found;
+    }
+
+    assert_int_equal( found, expected );
+}
+//------------------------------------------------------------------------------
+static
+void stab_check(ccntr_itree_t *tree, const node_t nodes[], const bool linked[], int point)
+{
+    unsigned expected = 0;
+    for(int i = 0; i < node_count; ++i)
+    {
+        if( linked[i] && nodes[i].low <= point && point < nodes[i].high )
+            ++ expected;
+    }
+
+    unsigned found = 0;
+    for(node_t *node = ccntr_itree_find_first_stab(tree, point);
+        node;
+        node = ccntr_itree_find_next_stab(tree, node, point))
+    {
+        assert_true( node->low <= point && point < node->high );
+        ++ found;
+    }
+
+    assert_int_equal( found, expected );
+}
+//------------------------------------------------------------------------------
+static
+void itree_search_test(void **state)
+{
+    static node_t nodes[node_count];
+    static bool   linked[node_count];
+    nodes_init(nodes);
+
+    ccntr_itree_t tree;
+    ccntr_itree_init(&tree);
+    assert_null( ccntr_itree_find_first_overlap(&tree, 0, 1000) );
+    assert_null( ccntr_itree_find_first_stab(&tree, 0) );
+
+    for(int i = 0; i < node_count; ++i)
+    {
+        ccntr_itree_link(&tree, &nodes[i]);
+        linked[i] = true;
+    }
+    assert_int_equal( ccntr_itree_get_count(&tree), node_count );
+
+    // All nodes are visited in order.
+    unsigned count = 0;
+    for(const node_t *node = ccntr_itree_get_first_c(&tree); node; node = ccntr_itree_node_get_next_c(node))
+    {
+        const node_t *next = ccntr_itree_node_get_next_c(node);
+        if( next ) assert_true( node->low < next->low || ( node->low == next->low && node->high <= next->high ) );
+        ++ count;
+    }
+    assert_int_equal( count, node_count );
+
+    for(int low = -10; low < 1060; low += 7)
+    {
+        overlap_check(&tree, nodes, linked, low, low + 1);
+        overlap_check(&tree, nodes, linked, low, low + 30);
+        stab_check(&tree, nodes, linked, low);
+    }
+    overlap_check(&tree, nodes, linked, -100, 2000);
+    overlap_check(&tree, nodes, linked, 500, 500);
+
+    // Unlink some nodes, and search again.
+    for(int i = 0; i < node_count; i += 3)
+    {
+        ccntr_itree_unlink(&tree, &nodes[i]);
+        linked[i] = false;
+    }
+    assert_int_equal( ccntr_itree_get_count(&tree), node_count - ( node_count + 2 ) / 3 );
+
+    for(int low = -10; low < 1060; low += 11)
+    {
+        overlap_check(&tree, nodes, linked, low, low + 20);
+        stab_check(&tree, nodes, linked, low);
+    }
+
+    ccntr_itree_discard_all(&tree);
+    assert_int_equal( ccntr_itree_get_count(&tree), 0 );
+    assert_null( ccntr_itree_get_first(&tree) );
+}
+//------------------------------------------------------------------------------
+int test_itree(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(itree_search_test),
+    };
+
+    return cmocka_run_group_tests_name("interval tree test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
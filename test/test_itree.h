@@ -0,0 +1,6 @@
+#ifndef _TEST_ITREE_H_
+#define _TEST_ITREE_H_
+
+int test_itree(void);
+
+#endif
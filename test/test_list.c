@@ -203,12 +203,69 @@ void list_erase_test(void **state)
     }
 }
 //------------------------------------------------------------------------------
+static
+int compare_tens(const ccntr_list_node_t *node1, const ccntr_list_node_t *node2, void *arg)
+{
+    const element_t *ele1 = container_of(node1, element_t, node);
+    const element_t *ele2 = container_of(node2, element_t, node);
+
+    return ele1->value / 10 - ele2->value / 10;
+}
+//------------------------------------------------------------------------------
+static
+void list_sort_test(void **state)
+{
+    ccntr_list_t *list = *state;
+
+    assert_true( is_list_empty(list) );
+
+    {
+        ccntr_list_sort(list, compare_tens, NULL);
+        assert_true( is_list_empty(list) );
+    }
+
+    {
+        ccntr_list_link_last(list, &element_create(31)->node);
+        ccntr_list_sort(list, compare_tens, NULL);
+
+        int target[] = { 31 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        // Only the tens digit be compared, so that the sort stability can be checked.
+        int values[] = { 12, 33, 11, 52, 22, 32, 41, 51, 21 };
+        for(unsigned i = 0; i < sizeof(values)/sizeof(values[0]); ++i)
+            ccntr_list_link_last(list, &element_create(values[i])->node);
+
+        ccntr_list_sort(list, compare_tens, NULL);
+
+        int target[] = { 12, 11, 22, 21, 31, 33, 32, 41, 52, 51 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        ccntr_list_node_t *node = ccntr_list_get_first(list);
+        while( node )
+        {
+            element_t *ele = container_of(node, element_t, node);
+            node = node->next;
+
+            element_release(ele);
+        }
+
+        ccntr_list_discard_all(list);
+        assert_true( is_list_empty(list) );
+    }
+}
+//------------------------------------------------------------------------------
 int test_list(void)
 {
     struct CMUnitTest tests[] =
     {
         cmocka_unit_test(list_insert_test),
         cmocka_unit_test(list_erase_test),
+        cmocka_unit_test(list_sort_test),
     };
 
     return cmocka_run_group_tests_name("list test", tests, list_create, list_release);
@@ -0,0 +1,190 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_lru.h"
+
+typedef ccntr_lru_node_t node_t;
+
+//------------------------------------------------------------------------------
+static
+node_t* node_create(int key, size_t weight)
+{
+    node_t *node = malloc(sizeof(node_t));
+    ccntr_lru_node_init(node, (void*)(intptr_t) key, weight);
+
+    return node;
+}
+//------------------------------------------------------------------------------
+static
+void node_release(node_t *node)
+{
+    free(node);
+}
+//------------------------------------------------------------------------------
+static
+int node_get_key(const node_t *node)
+{
+    return (intptr_t) node->map_node.key;
+}
+//------------------------------------------------------------------------------
+#define compare_order(lru, target) compare_order_and_array(lru, target, sizeof(target)/sizeof(target[0]))
+static
+bool compare_order_and_array(ccntr_lru_t *lru, int array[], unsigned count)
+{
+    if( ccntr_lru_get_count(lru) != count ) return false;
+
+    node_t *node = ccntr_lru_get_newest(lru);
+    for(int i = 0; i < (int)count; ++i, node = ccntr_lru_node_get_older(node))
+    {
+        if( !node ) return false;
+        if( node_get_key(node) != array[i] ) return false;
+    }
+    if( node ) return false;
+
+    node = ccntr_lru_get_oldest(lru);
+    for(int i = (int)count - 1; i >= 0; --i, node = ccntr_lru_node_get_newer(node))
+    {
+        if( !node ) return false;
+        if( node_get_key(node) != array[i] ) return false;
+    }
+    if( node ) return false;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+void lru_touch_test(void **state)
+{
+    ccntr_lru_t lru;
+    ccntr_lru_init(&lru, NULL, 0);
+
+    node_t *node_1 = node_create(1, 1);
+    node_t *node_2 = node_create(2, 1);
+    node_t *node_3 = node_create(3, 1);
+
+    assert_null( ccntr_lru_link(&lru, node_1) );
+    assert_null( ccntr_lru_link(&lru, node_2) );
+    assert_null( ccntr_lru_link(&lru, node_3) );
+
+    {
+        int target[] = { 3, 2, 1 };
+        assert_true( compare_order(&lru, target) );
+    }
+
+    {
+        assert_ptr_equal( ccntr_lru_find(&lru, (void*)(intptr_t) 1), node_1 );
+
+        int target[] = { 1, 3, 2 };
+        assert_true( compare_order(&lru, target) );
+    }
+
+    {
+        assert_ptr_equal( ccntr_lru_peek(&lru, (void*)(intptr_t) 2), node_2 );
+
+        int target[] = { 1, 3, 2 };
+        assert_true( compare_order(&lru, target) );
+    }
+
+    {
+        assert_null( ccntr_lru_find(&lru, (void*)(intptr_t) 4) );
+
+        ccntr_lru_stats_t stats = ccntr_lru_get_stats(&lru);
+        assert_int_equal( stats.hits, 1 );
+        assert_int_equal( stats.misses, 1 );
+        assert_int_equal( stats.evictions, 0 );
+    }
+
+    {
+        node_t *node_3_new = node_create(3, 1);
+        assert_ptr_equal( ccntr_lru_link(&lru, node_3_new), node_3 );
+        node_release(node_3);
+
+        int target[] = { 3, 1, 2 };
+        assert_true( compare_order(&lru, target) );
+        assert_int_equal( ccntr_lru_get_weight(&lru), 3 );
+    }
+
+    {
+        assert_ptr_equal( ccntr_lru_unlink_by_key(&lru, (void*)(intptr_t) 1), node_1 );
+        node_release(node_1);
+
+        int target[] = { 3, 2 };
+        assert_true( compare_order(&lru, target) );
+        assert_int_equal( ccntr_lru_get_weight(&lru), 2 );
+    }
+
+    // Clear.
+
+    for(node_t *node = ccntr_lru_get_newest(&lru); node;)
+    {
+        node_t *node_del = node;
+        node = ccntr_lru_node_get_older(node);
+
+        node_release(node_del);
+    }
+
+    ccntr_lru_discard_all(&lru);
+    assert_int_equal( ccntr_lru_get_count(&lru), 0 );
+    assert_int_equal( ccntr_lru_get_weight(&lru), 0 );
+}
+//------------------------------------------------------------------------------
+static
+void lru_eviction_test(void **state)
+{
+    ccntr_lru_t lru;
+    ccntr_lru_init(&lru, NULL, 10);
+
+    assert_null( ccntr_lru_link(&lru, node_create(1, 4)) );
+    assert_null( ccntr_lru_link(&lru, node_create(2, 4)) );
+    assert_null( ccntr_lru_unlink_overflow(&lru) );
+
+    assert_non_null( ccntr_lru_find(&lru, (void*)(intptr_t) 1) );
+
+    assert_null( ccntr_lru_link(&lru, node_create(3, 4)) );
+    assert_int_equal( ccntr_lru_get_weight(&lru), 12 );
+
+    {
+        node_t *node = ccntr_lru_unlink_overflow(&lru);
+        assert_non_null( node );
+        assert_int_equal( node_get_key(node), 2 );
+        node_release(node);
+
+        assert_null( ccntr_lru_unlink_overflow(&lru) );
+
+        int target[] = { 3, 1 };
+        assert_true( compare_order(&lru, target) );
+        assert_int_equal( ccntr_lru_get_weight(&lru), 8 );
+        assert_int_equal( ccntr_lru_get_stats(&lru).evictions, 1 );
+    }
+
+    {
+        ccntr_lru_set_capacity(&lru, 3);
+
+        node_t *node;
+        while(( node = ccntr_lru_unlink_overflow(&lru) ))
+            node_release(node);
+
+        assert_int_equal( ccntr_lru_get_count(&lru), 0 );
+        assert_int_equal( ccntr_lru_get_stats(&lru).evictions, 3 );
+    }
+
+    {
+        ccntr_lru_reset_stats(&lru);
+        assert_int_equal( ccntr_lru_get_stats(&lru).evictions, 0 );
+    }
+}
+//------------------------------------------------------------------------------
+int test_lru(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(lru_touch_test),
+        cmocka_unit_test(lru_eviction_test),
+    };
+
+    return cmocka_run_group_tests_name("lru test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
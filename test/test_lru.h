@@ -0,0 +1,6 @@
+#ifndef _TEST_LRU_H_
+#define _TEST_LRU_H_
+
+int test_lru(void);
+
+#endif
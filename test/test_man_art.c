@@ -0,0 +1,268 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_art.h"
+
+typedef struct element_t
+{
+    // For test purpose, we defined that:
+    // element_value = key_value
+    intptr_t value;
+} element_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+element_t* element_create(intptr_t value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ++ released_count;
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void* key_from_int(intptr_t key)
+{
+    return (void*) key;
+}
+//------------------------------------------------------------------------------
+static
+int compare_ints(const void *int1, const void *int2)
+{
+    intptr_t value1 = *(const intptr_t*) int1;
+    intptr_t value2 = *(const intptr_t*) int2;
+
+    return ( value1 > value2 ) - ( value1 < value2 );
+}
+//------------------------------------------------------------------------------
+static
+intptr_t key_generate(unsigned index)
+{
+    // Keys are dense near zero (both signs) and sparse on other bits,
+    // so that all types of nodes and prefixes are created.
+
+    switch( index % 4 )
+    {
+    case 0:  return index;
+    case 1:  return -(intptr_t) index;
+    case 2:  return (intptr_t)( (uintptr_t)( index * 2654435761u ) << 8 );
+    default: return INTPTR_MAX - (intptr_t) index * 977;
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_art_simple_test(void **state)
+{
+    ccntr_man_art_t map;
+    ccntr_man_art_init(&map, (void(*)(void*)) element_release);
+    released_count = 0;
+
+    assert_int_equal( ccntr_man_art_get_count(&map), 0 );
+    assert_null( ccntr_man_art_find_value(&map, key_from_int(0)) );
+
+    ccntr_man_art_iter_t iter = ccntr_man_art_get_first(&map);
+    assert_false( ccntr_man_art_iter_have_value(&iter) );
+
+    // Keys are ordered as signed integers.
+    const intptr_t keys[] = { 5, -3, 0, INTPTR_MAX, INTPTR_MIN, 256, 255, -256 };
+    const intptr_t sorted[] = { INTPTR_MIN, -256, -3, 0, 5, 255, 256, INTPTR_MAX };
+    const unsigned count = sizeof(keys) / sizeof(keys[0]);
+
+    for(unsigned i = 0; i < count; ++i)
+        ccntr_man_art_insert(&map, key_from_int(keys[i]), element_create(keys[i]));
+    assert_int_equal( ccntr_man_art_get_count(&map), count );
+
+    unsigned index = 0;
+    for(ccntr_man_art_citer_t citer = ccntr_man_art_get_first_c(&map);
+        ccntr_man_art_citer_have_value(&citer);
+        ccntr_man_art_citer_move_next(&citer))
+    {
+        const element_t *ele = ccntr_man_art_citer_get_value(&citer);
+        assert_true( (intptr_t) ccntr_man_art_citer_get_key(&citer) == sorted[index] );
+        assert_true( ele->value == sorted[index] );
+        ++ index;
+    }
+    assert_int_equal( index, count );
+
+    for(iter = ccntr_man_art_get_last(&map);
+        ccntr_man_art_iter_have_value(&iter);
+        ccntr_man_art_iter_move_prev(&iter))
+    {
+        assert_true( (intptr_t) ccntr_man_art_iter_get_key(&iter) == sorted[ -- index ] );
+    }
+    assert_int_equal( index, 0 );
+
+    // Replace value.
+    ccntr_man_art_insert(&map, key_from_int(5), element_create(-1));
+    assert_int_equal( ccntr_man_art_get_count(&map), count );
+    assert_int_equal( released_count, 1 );
+    const element_t *ele = ccntr_man_art_find_value_c(&map, key_from_int(5));
+    assert_int_equal( ele->value, -1 );
+
+    // Erase and pop.
+    assert_true( ccntr_man_art_erase_by_key(&map, key_from_int(-3)) );
+    assert_false( ccntr_man_art_erase_by_key(&map, key_from_int(-3)) );
+    assert_false( ccntr_man_art_erase_by_key(&map, key_from_int(4)) );
+    assert_int_equal( released_count, 2 );
+
+    iter = ccntr_man_art_find(&map, key_from_int(255));
+    element_t *popped = ccntr_man_art_pop(&map, &iter);
+    assert_false( ccntr_man_art_iter_have_value(&iter) );
+    assert_int_equal( popped->value, 255 );
+    free(popped);
+
+    iter = ccntr_man_art_find(&map, key_from_int(INTPTR_MIN));
+    ccntr_man_art_erase(&map, &iter);
+    assert_int_equal( ccntr_man_art_get_count(&map), count - 3 );
+    assert_int_equal( released_count, 3 );
+
+    ccntr_man_art_destroy(&map);
+    assert_int_equal( released_count, count );
+}
+//------------------------------------------------------------------------------
+static
+void man_art_nearest_test(void **state)
+{
+    enum { count = 2000 };
+
+    ccntr_man_art_t map;
+    ccntr_man_art_init(&map, (void(*)(void*)) element_release);
+
+    static intptr_t keys[count];
+    for(unsigned i = 0; i < count; ++i)
+    {
+        keys[i] = key_generate(i);
+        ccntr_man_art_insert(&map, key_from_int(keys[i]), element_create(keys[i]));
+    }
+    qsort(keys, count, sizeof(keys[0]), compare_ints);
+    assert_int_equal( ccntr_man_art_get_count(&map), count );
+
+    // Iterate in order.
+    unsigned index = 0;
+    for(ccntr_man_art_iter_t iter = ccntr_man_art_get_first(&map);
+        ccntr_man_art_iter_have_value(&iter);
+        ccntr_man_art_iter_move_next(&iter))
+    {
+        assert_true( (intptr_t) ccntr_man_art_iter_get_key(&iter) == keys[ index ++ ] );
+    }
+    assert_int_equal( index, count );
+
+    // Search each key and its neighbours.
+    for(unsigned i = 0; i < count; ++i)
+    {
+        const element_t *ele = ccntr_man_art_find_value(&map, key_from_int(keys[i]));
+        assert_non_null( ele );
+        assert_true( ele->value == keys[i] );
+
+        ccntr_man_art_citer_t iter;
+
+        iter = ccntr_man_art_find_nearest_less_c(&map, key_from_int(keys[i]));
+        assert_true( (intptr_t) ccntr_man_art_citer_get_key(&iter) == keys[i] );
+        iter = ccntr_man_art_find_nearest_great_c(&map, key_from_int(keys[i]));
+        assert_true( (intptr_t) ccntr_man_art_citer_get_key(&iter) == keys[i] );
+
+        if( i && keys[i] - 1 != keys[ i - 1 ] )
+        {
+            assert_null( ccntr_man_art_find_value(&map, key_from_int(keys[i] - 1)) );
+
+            iter = ccntr_man_art_find_nearest_less_c(&map, key_from_int(keys[i] - 1));
+            assert_true( (intptr_t) ccntr_man_art_citer_get_key(&iter) == keys[ i - 1 ] );
+            iter = ccntr_man_art_find_nearest_great_c(&map, key_from_int(keys[i] - 1));
+            assert_true( (intptr_t) ccntr_man_art_citer_get_key(&iter) == keys[i] );
+        }
+    }
+
+    ccntr_man_art_citer_t iter;
+
+    iter = ccntr_man_art_find_nearest_less_c(&map, key_from_int(keys[0] - 1));
+    assert_false( ccntr_man_art_citer_have_value(&iter) );
+    iter = ccntr_man_art_find_nearest_great_c(&map, key_from_int(keys[ count - 1 ] + 1));
+    assert_false( ccntr_man_art_citer_have_value(&iter) );
+
+    ccntr_man_art_destroy(&map);
+}
+//------------------------------------------------------------------------------
+static
+void man_art_erase_test(void **state)
+{
+    enum { count = 2000 };
+
+    ccntr_man_art_t map;
+    ccntr_man_art_init(&map, (void(*)(void*)) element_release);
+    released_count = 0;
+
+    for(unsigned i = 0; i < count; ++i)
+        ccntr_man_art_insert(&map, key_from_int(key_generate(i)), element_create(key_generate(i)));
+
+    // Erase most values so that nodes are shrunk and collapsed.
+    for(unsigned i = 0; i < count; ++i)
+    {
+        if( i % 16 )
+            assert_true( ccntr_man_art_erase_by_key(&map, key_from_int(key_generate(i))) );
+    }
+    assert_int_equal( ccntr_man_art_get_count(&map), count / 16 );
+    assert_int_equal( released_count, count - count / 16 );
+
+    for(unsigned i = 0; i < count; ++i)
+    {
+        const element_t *ele = ccntr_man_art_find_value(&map, key_from_int(key_generate(i)));
+        if( i % 16 )
+        {
+            assert_null( ele );
+        }
+        else
+        {
+            assert_non_null( ele );
+            assert_true( ele->value == key_generate(i) );
+        }
+    }
+
+    intptr_t prev  = INTPTR_MIN;
+    unsigned index = 0;
+    for(ccntr_man_art_citer_t iter = ccntr_man_art_get_first_c(&map);
+        ccntr_man_art_citer_have_value(&iter);
+        ccntr_man_art_citer_move_next(&iter))
+    {
+        intptr_t key = (intptr_t) ccntr_man_art_citer_get_key(&iter);
+        if( index ) assert_true( prev < key );
+
+        prev = key;
+        ++ index;
+    }
+    assert_int_equal( index, count / 16 );
+
+    ccntr_man_art_clear(&map);
+    assert_int_equal( ccntr_man_art_get_count(&map), 0 );
+    assert_int_equal( released_count, count );
+
+    ccntr_man_art_insert(&map, key_from_int(1), element_create(2));
+    assert_int_equal( ccntr_man_art_get_count(&map), 1 );
+
+    ccntr_man_art_destroy(&map);
+    assert_int_equal( released_count, count + 1 );
+}
+//------------------------------------------------------------------------------
+int test_man_art(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_art_simple_test),
+        cmocka_unit_test(man_art_nearest_test),
+        cmocka_unit_test(man_art_erase_test),
+    };
+
+    return cmocka_run_group_tests_name("adaptive radix tree map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_ART_H_
+#define _TEST_MAN_ART_H_
+
+int test_man_art(void);
+
+#endif
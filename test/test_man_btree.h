@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_BTREE_H_
+#define _TEST_MAN_BTREE_H_
+
+int test_man_btree(void);
+
+#endif
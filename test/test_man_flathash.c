@@ -0,0 +1,292 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_flathash.h"
+
+typedef struct testkey_t
+{
+    int value;
+} testkey_t;
+
+typedef struct element_t
+{
+    // For test purpose, we defined that:
+    // element_value = 2 * key_value
+    int value;
+} element_t;
+
+//------------------------------------------------------------------------------
+static
+testkey_t* testkey_create(int value)
+{
+    testkey_t *key = malloc(sizeof(testkey_t));
+    key->value = value;
+
+    return key;
+}
+//------------------------------------------------------------------------------
+static
+void testkey_release(testkey_t *key)
+{
+    free(key);
+}
+//------------------------------------------------------------------------------
+static
+size_t testkey_hash(const testkey_t *key)
+{
+    return key->value;
+}
+//------------------------------------------------------------------------------
+static
+int testkey_compare(const testkey_t *key1, const testkey_t *key2)
+{
+    return key1->value - key2->value;
+}
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    free(ele);
+}
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_FLATHASH(hash,
+                       testkey_t*,
+                       element_t*,
+                       (size_t(*)(const void*)) testkey_hash,
+                       (int(*)(const void*,const void*)) testkey_compare,
+                       (void(*)(void*)) testkey_release,
+                       (void(*)(void*)) element_release)
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_FLATHASH(inthash, intptr_t, intptr_t, NULL, NULL, NULL, NULL)
+//------------------------------------------------------------------------------
+static
+int man_flathash_create(void **state)
+{
+    hash_t *hash = malloc(sizeof(hash_t));
+    if( !hash ) return -1;
+
+    hash_init(hash);
+
+    *state = hash;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+int man_flathash_release(void **state)
+{
+    hash_t *hash = *state;
+
+    hash_destroy(hash);
+    free(hash);
+
+    *state = 0;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_insert_test(void **state)
+{
+    hash_t *hash = *state;
+
+    assert_int_equal( hash_get_count(hash), 0 );
+
+    for(int i = 0; i < 100; ++i)
+    {
+        hash_insert(hash, testkey_create(2*i+1), element_create(2*(2*i+1)));
+        assert_int_equal( hash_get_count(hash), i + 1 );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_duplicated_insert_test(void **state)
+{
+    hash_t *hash = *state;
+
+    assert_int_equal( hash_get_count(hash), 100 );
+
+    hash_insert(hash, testkey_create(1), element_create(2*1));
+    assert_int_equal( hash_get_count(hash), 100 );
+
+    hash_insert(hash, testkey_create(99), element_create(2*99));
+    assert_int_equal( hash_get_count(hash), 100 );
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_iterate_test(void **state)
+{
+    hash_t *hash = *state;
+
+    unsigned count = 0;
+    int sum = 0;
+    for(hash_citer_t iter = hash_get_first_c(hash);
+        hash_citer_have_value(&iter);
+        hash_citer_move_next(&iter))
+    {
+        assert_int_equal( hash_citer_get_value(&iter)->value, 2*hash_citer_get_key(&iter)->value );
+
+        sum += hash_citer_get_key(&iter)->value;
+        ++ count;
+    }
+    assert_int_equal( count, 100 );
+    assert_int_equal( sum, 100 * 100 );
+
+    hash_iter_t iter = hash_get_first(hash);
+    assert_true( hash_iter_have_value(&iter) );
+    assert_int_equal( hash_iter_get_value(&iter)->value, 2*hash_iter_get_key(&iter)->value );
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_find_test(void **state)
+{
+    hash_t *hash = *state;
+
+    for(int i = 0; i < 200; ++i)
+    {
+        testkey_t key = {i};
+        const element_t *ele = hash_find_value_c(hash, &key);
+        if( i & 1 )
+        {
+            assert_non_null( ele );
+            assert_int_equal( ele->value, 2*key.value );
+        }
+        else
+        {
+            assert_null( ele );
+        }
+    }
+
+    testkey_t key = {5};
+    hash_iter_t iter = hash_find(hash, &key);
+    assert_true( hash_iter_have_value(&iter) );
+    assert_int_equal( hash_iter_get_key(&iter)->value, 5 );
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_erase_test(void **state)
+{
+    hash_t *hash = *state;
+
+    assert_int_equal( hash_get_count(hash), 100 );
+
+    testkey_t key = {3};
+    hash_erase_by_key(hash, &key);
+    assert_null( hash_find_value_c(hash, &key) );
+    assert_int_equal( hash_get_count(hash), 99 );
+
+    key.value = 5;
+    hash_iter_t iter = hash_find(hash, &key);
+    hash_erase(hash, &iter);
+    assert_false( hash_iter_have_value(&iter) );
+    assert_null( hash_find_value_c(hash, &key) );
+    assert_int_equal( hash_get_count(hash), 98 );
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_pop_test(void **state)
+{
+    hash_t *hash = *state;
+
+    assert_int_equal( hash_get_count(hash), 98 );
+
+    testkey_t target = {7};
+    hash_iter_t pos = hash_find(hash, &target);
+    assert_true( hash_iter_have_value(&pos) );
+
+    testkey_t *key = hash_iter_get_key(&pos);
+    element_t *ele = hash_iter_get_value(&pos);
+    assert_non_null( key );
+    assert_non_null( ele );
+
+    assert_ptr_equal( hash_pop(hash, &pos), ele );
+    assert_null( hash_find_value(hash, &target) );
+    assert_int_equal( hash_get_count(hash), 97 );
+
+    testkey_release(key);
+    element_release(ele);
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_clear_test(void **state)
+{
+    hash_t *hash = *state;
+
+    assert_int_equal( hash_get_count(hash), 97 );
+
+    hash_clear(hash);
+    assert_int_equal( hash_get_count(hash), 0 );
+
+    hash_citer_t iter = hash_get_first_c(hash);
+    assert_false( hash_citer_have_value(&iter) );
+}
+//------------------------------------------------------------------------------
+static
+void man_flathash_churn_test(void **state)
+{
+    inthash_t hash;
+    inthash_init(&hash);
+
+    // Insert and erase values repeatedly,
+    // so that slots will be deleted and reused, and the table will be rehashed.
+    for(intptr_t round = 0; round < 20; ++round)
+    {
+        for(intptr_t i = 0; i < 500; ++i)
+            inthash_insert(&hash, round * 500 + i, i);
+
+        for(intptr_t i = 0; i < 500; ++i)
+        {
+            if( i % 5 ) inthash_erase_by_key(&hash, round * 500 + i);
+        }
+
+        assert_int_equal( inthash_get_count(&hash), ( round + 1 ) * 100 );
+    }
+
+    for(intptr_t key = 0; key < 20 * 500; ++key)
+    {
+        inthash_citer_t iter = inthash_find_c(&hash, key);
+        assert_int_equal( inthash_citer_have_value(&iter), key % 5 == 0 );
+        if( key % 5 == 0 )
+            assert_int_equal( inthash_citer_get_value(&iter), key % 500 );
+    }
+
+    unsigned count = 0;
+    for(inthash_iter_t iter = inthash_get_first(&hash);
+        inthash_iter_have_value(&iter);
+        inthash_iter_move_next(&iter))
+    {
+        assert_int_equal( inthash_iter_get_key(&iter) % 5, 0 );
+        ++ count;
+    }
+    assert_int_equal( count, 20 * 100 );
+
+    inthash_destroy(&hash);
+}
+//------------------------------------------------------------------------------
+int test_man_flathash(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_flathash_insert_test),
+        cmocka_unit_test(man_flathash_duplicated_insert_test),
+        cmocka_unit_test(man_flathash_iterate_test),
+        cmocka_unit_test(man_flathash_find_test),
+        cmocka_unit_test(man_flathash_erase_test),
+        cmocka_unit_test(man_flathash_pop_test),
+        cmocka_unit_test(man_flathash_clear_test),
+        cmocka_unit_test(man_flathash_churn_test),
+    };
+
+    return cmocka_run_group_tests_name("managed open addressing hash map test", tests, man_flathash_create, man_flathash_release);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_FLATHASH_H_
+#define _TEST_MAN_FLATHASH_H_
+
+int test_man_flathash(void);
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_HASH_H_
+#define _TEST_MAN_HASH_H_
+
+int test_man_hash(void);
+
+#endif
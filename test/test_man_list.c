@@ -232,6 +232,36 @@ void man_list_clear_test(void **state)
     }
 }
 //------------------------------------------------------------------------------
+static
+int element_compare(const element_t *ele1, const element_t *ele2)
+{
+    return ele1->value - ele2->value;
+}
+//------------------------------------------------------------------------------
+static
+void man_list_sort_test(void **state)
+{
+    list_t *list = *state;
+
+    assert_true( is_list_empty(list) );
+
+    {
+        int values[] = { 7, 3, 9, 1, 8, 2, 6, 4, 5 };
+        for(unsigned i = 0; i < sizeof(values)/sizeof(values[0]); ++i)
+            list_insert_last(list, element_create(values[i]));
+
+        list_sort(list, (int(*)(const void*,const void*)) element_compare);
+
+        int target[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_clear(list);
+        assert_true( is_list_empty(list) );
+    }
+}
+//------------------------------------------------------------------------------
 int test_man_list(void)
 {
     struct CMUnitTest tests[] =
@@ -240,6 +270,7 @@ int test_man_list(void)
         cmocka_unit_test(man_list_erase_test),
         cmocka_unit_test(man_list_pop_test),
         cmocka_unit_test(man_list_clear_test),
+        cmocka_unit_test(man_list_sort_test),
     };
 
     return cmocka_run_group_tests_name("managed list test", tests, man_list_create, man_list_release);
@@ -0,0 +1,219 @@
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_lru.h"
+
+typedef struct testkey_t
+{
+    int value;
+} testkey_t;
+
+typedef struct element_t
+{
+    // For test purpose, we defined that:
+    // element_value = 2 * key_value
+    int value;
+} element_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+testkey_t* testkey_create(int value)
+{
+    testkey_t *key = malloc(sizeof(testkey_t));
+    key->value = value;
+
+    return key;
+}
+//------------------------------------------------------------------------------
+static
+void testkey_release(testkey_t *key)
+{
+    free(key);
+}
+//------------------------------------------------------------------------------
+static
+int testkey_compare(const testkey_t *key1, const testkey_t *key2)
+{
+    return key1->value - key2->value;
+}
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ++ released_count;
+    free(ele);
+}
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_LRU(cache,
+                  testkey_t*,
+                  element_t*,
+                  (int(*)(const void*,const void*)) testkey_compare,
+                  (void(*)(void*)) testkey_release,
+                  (void(*)(void*)) element_release)
+//------------------------------------------------------------------------------
+static
+int man_lru_create(void **state)
+{
+    cache_t *cache = malloc(sizeof(cache_t));
+    if( !cache ) return -1;
+
+    cache_init(cache, 3);
+
+    *state = cache;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+int man_lru_release(void **state)
+{
+    cache_t *cache = *state;
+
+    cache_destroy(cache);
+    free(cache);
+
+    *state = 0;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+bool cache_have_key(cache_t *cache, int value)
+{
+    testkey_t key = { value };
+    return cache_peek_value(cache, &key);
+}
+//------------------------------------------------------------------------------
+static
+void man_lru_insert_test(void **state)
+{
+    cache_t *cache = *state;
+
+    assert_int_equal( cache_get_count(cache), 0 );
+
+    cache_insert(cache, testkey_create(1), element_create(2*1));
+    cache_insert(cache, testkey_create(2), element_create(2*2));
+    cache_insert(cache, testkey_create(3), element_create(2*3));
+    assert_int_equal( cache_get_count(cache), 3 );
+    assert_int_equal( released_count, 0 );
+
+    // Replace value.
+
+    cache_insert(cache, testkey_create(3), element_create(2*3));
+    assert_int_equal( cache_get_count(cache), 3 );
+    assert_int_equal( released_count, 1 );
+}
+//------------------------------------------------------------------------------
+static
+void man_lru_eviction_test(void **state)
+{
+    cache_t *cache = *state;
+
+    assert_int_equal( cache_get_count(cache), 3 );
+
+    {
+        // Touch key 1, so that key 2 become the least recently used one.
+        testkey_t key = { 1 };
+        element_t *ele = cache_find_value(cache, &key);
+        assert_non_null( ele );
+        assert_int_equal( ele->value, 2*1 );
+    }
+
+    {
+        cache_insert(cache, testkey_create(4), element_create(2*4));
+        assert_int_equal( cache_get_count(cache), 3 );
+        assert_int_equal( released_count, 2 );
+
+        assert_true( cache_have_key(cache, 1) );
+        assert_false( cache_have_key(cache, 2) );
+        assert_true( cache_have_key(cache, 3) );
+        assert_true( cache_have_key(cache, 4) );
+    }
+
+    {
+        testkey_t key = { 2 };
+        assert_null( cache_find_value(cache, &key) );
+
+        ccntr_lru_stats_t stats = cache_get_stats(cache);
+        assert_int_equal( stats.hits, 1 );
+        assert_int_equal( stats.misses, 1 );
+        assert_int_equal( stats.evictions, 1 );
+    }
+
+    {
+        // The weighted value evicts the least recently used ones: 3 and 1.
+        cache_insert_weighted(cache, testkey_create(5), element_create(2*5), 2);
+        assert_int_equal( cache_get_count(cache), 2 );
+        assert_int_equal( cache_get_weight(cache), 3 );
+        assert_int_equal( released_count, 4 );
+
+        assert_true( cache_have_key(cache, 4) );
+        assert_true( cache_have_key(cache, 5) );
+    }
+
+    {
+        cache_set_capacity(cache, 2);
+        assert_int_equal( cache_get_count(cache), 1 );
+        assert_true( cache_have_key(cache, 5) );
+        assert_int_equal( released_count, 5 );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_lru_erase_test(void **state)
+{
+    cache_t *cache = *state;
+
+    assert_int_equal( cache_get_count(cache), 1 );
+
+    {
+        testkey_t key = { 5 };
+        cache_erase_by_key(cache, &key);
+        assert_int_equal( cache_get_count(cache), 0 );
+        assert_int_equal( cache_get_weight(cache), 0 );
+        assert_int_equal( released_count, 6 );
+    }
+
+    {
+        cache_set_capacity(cache, 0);
+        testkey_t *key_7 = testkey_create(7);
+        for(int i = 0; i < 10; ++i)
+            cache_insert(cache, i == 7 ? key_7 : testkey_create(i), element_create(2*i));
+        assert_int_equal( cache_get_count(cache), 10 );
+
+        // Key and value will not be released by pop.
+        element_t *ele = cache_pop_by_key(cache, key_7);
+        assert_non_null( ele );
+        assert_int_equal( ele->value, 2*7 );
+        testkey_release(key_7);
+        element_release(ele);
+
+        cache_clear(cache);
+        assert_int_equal( cache_get_count(cache), 0 );
+        assert_int_equal( released_count, 6 + 10 );
+    }
+}
+//------------------------------------------------------------------------------
+int test_man_lru(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_lru_insert_test),
+        cmocka_unit_test(man_lru_eviction_test),
+        cmocka_unit_test(man_lru_erase_test),
+    };
+
+    return cmocka_run_group_tests_name("managed lru test", tests, man_lru_create, man_lru_release);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_LRU_H_
+#define _TEST_MAN_LRU_H_
+
+int test_man_lru(void);
+
+#endif
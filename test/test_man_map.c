@@ -17,6 +17,8 @@ typedef struct element_t
     int value;
 } element_t;
 
+static int released_count = 0;
+
 //------------------------------------------------------------------------------
 static
 testkey_t* testkey_create(int value)
@@ -61,6 +63,13 @@ CCNTR_DECLARE_MAP(map,
                   (void(*)(void*)) testkey_release,
                   (void(*)(void*)) element_release)
 //------------------------------------------------------------------------------
+CCNTR_DECLARE_MAP_INLINE(intmap,
+                         int,
+                         element_t*,
+                         CCNTR_MAP_COMPARE_INTEGRAL,
+                         NULL,
+                         (void(*)(void*)) element_release)
+//------------------------------------------------------------------------------
 static
 int man_map_create(void **state)
 {
@@ -317,6 +326,239 @@ void man_map_clear_test(void **state)
     assert_int_equal( map_get_count(map), 0 );
 }
 //------------------------------------------------------------------------------
+static
+void man_map_inline_test(void **state)
+{
+    intmap_t map;
+    intmap_init(&map);
+
+    for(int i = 0; i < 10; ++i)
+        intmap_insert(&map, ( i * 7 ) % 10 * 2, element_create(( i * 7 ) % 10 * 4));
+    assert_int_equal( intmap_get_count(&map), 10 );
+
+    // Replace value.
+    intmap_insert(&map, 6, element_create(6*2));
+    assert_int_equal( intmap_get_count(&map), 10 );
+
+    // Iterate values.
+    int key = 0;
+    for(intmap_citer_t iter = intmap_get_first_c(&map);
+        intmap_citer_have_value(&iter);
+        intmap_citer_move_next(&iter), key += 2)
+    {
+        assert_int_equal( intmap_citer_get_key(&iter), key );
+        assert_int_equal( intmap_citer_get_value(&iter)->value, 2*key );
+    }
+    assert_int_equal( key, 20 );
+
+    // Find values.
+    assert_int_equal( intmap_find_value(&map, 8)->value, 2*8 );
+    assert_null( intmap_find_value_c(&map, 9) );
+    assert_null( intmap_find_value(&map, -2) );
+
+    assert_int_equal( intmap_find_value_nearest_less(&map, 9)->value, 2*8 );
+    assert_int_equal( intmap_find_value_nearest_less_c(&map, 8)->value, 2*8 );
+    assert_null( intmap_find_value_nearest_less(&map, -1) );
+
+    assert_int_equal( intmap_find_value_nearest_great(&map, 9)->value, 2*10 );
+    assert_int_equal( intmap_find_value_nearest_great_c(&map, 10)->value, 2*10 );
+    assert_null( intmap_find_value_nearest_great(&map, 19) );
+
+    intmap_iter_t iter = intmap_find_nearest_less(&map, 100);
+    assert_int_equal( intmap_iter_get_key(&iter), 18 );
+
+    // Erase values.
+    intmap_erase_by_key(&map, 8);
+    intmap_erase_by_key(&map, 9);
+    assert_int_equal( intmap_get_count(&map), 9 );
+    assert_null( intmap_find_value(&map, 8) );
+    assert_int_equal( intmap_find_value_nearest_great(&map, 8)->value, 2*10 );
+
+    intmap_destroy(&map);
+}
+//------------------------------------------------------------------------------
+static
+void man_map_build_sorted_test(void **state)
+{
+    enum { count = 100 };
+
+    void *keys[count];
+    void *values[count];
+    for(int i = 0; i < count; ++i)
+    {
+        keys[i]   = testkey_create(2 * i);
+        values[i] = element_create(4 * i);
+    }
+
+    map_t map;
+    map_init(&map);
+
+    // Existing values will be replaced.
+    map_insert(&map, testkey_create(1), element_create(2));
+
+    ccntr_man_map_build_sorted(&map.super, keys, values, count);
+    assert_int_equal( map_get_count(&map), count );
+
+    int key_value = 0;
+    for(map_citer_t iter = map_get_first_c(&map);
+        map_citer_have_value(&iter);
+        map_citer_move_next(&iter), key_value += 2)
+    {
+        assert_int_equal( map_citer_get_key(&iter)->value, key_value );
+        assert_int_equal( map_citer_get_value(&iter)->value, 2*key_value );
+    }
+    assert_int_equal( key_value, 2*count );
+
+    testkey_t key = {1};
+    assert_null( map_find_value(&map, &key) );
+
+    key.value = 3;
+    map_insert(&map, testkey_create(3), element_create(6));
+    assert_int_equal( map_find_value(&map, &key)->value, 6 );
+
+    key.value = 4;
+    map_erase_by_key(&map, &key);
+    assert_null( map_find_value(&map, &key) );
+    assert_int_equal( map_get_count(&map), count );
+
+    // Erase keys in [ 100, 150 ).
+    testkey_t lower = {100}, upper = {150};
+    assert_int_equal( map_count_range(&map, &lower, &upper), 25 );
+    assert_int_equal( map_erase_range(&map, &lower, &upper), 25 );
+    assert_int_equal( map_count_range(&map, &lower, &upper), 0 );
+    assert_int_equal( map_get_count(&map), count - 25 );
+
+    key.value = 98;
+    assert_non_null( map_find_value(&map, &key) );
+    key.value = 100;
+    assert_null( map_find_value(&map, &key) );
+    key.value = 150;
+    assert_non_null( map_find_value(&map, &key) );
+
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    // Keys: 0, 2, 3, 6, 8, 10, ...
+    map_citer_t iter = map_select_c(&map, 2);
+    assert_int_equal( map_citer_get_key(&iter)->value, 3 );
+    map_iter_t mutable_iter = map_select(&map, 3);
+    assert_int_equal( map_iter_get_key(&mutable_iter)->value, 6 );
+
+    key.value = 7;
+    assert_int_equal( map_rank(&map, &key), 4 );
+#endif
+
+    map_destroy(&map);
+}
+//------------------------------------------------------------------------------
+static
+void man_map_upsert_test(void **state)
+{
+    map_t map;
+    map_init(&map);
+
+    // Upsert values.
+    for(int i = 0; i < 10; ++i)
+        assert_true( map_upsert(&map, testkey_create(i), element_create(2*i)) );
+    assert_int_equal( map_get_count(&map), 10 );
+
+    testkey_t key = {4};
+    map_citer_t iter = map_find_c(&map, &key);
+    const testkey_t *key_old = map_citer_get_key(&iter);
+
+    assert_false( map_upsert(&map, testkey_create(4), element_create(100)) );
+    assert_int_equal( map_get_count(&map), 10 );
+    assert_int_equal( map_find_value(&map, &key)->value, 100 );
+
+    // The old key is kept.
+    iter = map_find_c(&map, &key);
+    assert_ptr_equal( map_citer_get_key(&iter), key_old );
+
+    // Find or insert values.
+    bool inserted;
+    void **slot = map_find_or_insert(&map, testkey_create(20), &inserted);
+    assert_true( inserted );
+    assert_null( *slot );
+    *slot = element_create(40);
+    assert_int_equal( map_get_count(&map), 11 );
+
+    key.value = 20;
+    assert_int_equal( map_find_value(&map, &key)->value, 40 );
+
+    slot = map_find_or_insert(&map, &key, &inserted);
+    assert_false( inserted );
+    assert_int_equal( ((element_t*) *slot)->value, 40 );
+    assert_int_equal( map_get_count(&map), 11 );
+
+    element_release(*slot);
+    *slot = element_create(41);
+    assert_int_equal( map_find_value(&map, &key)->value, 41 );
+
+    map_destroy(&map);
+}
+//------------------------------------------------------------------------------
+static
+void value_release_counted(void *value)
+{
+    ++ released_count;
+}
+//------------------------------------------------------------------------------
+static
+void man_map_arena_test(void **state)
+{
+    enum { count = 3000 };
+
+    ccntr_man_map_t map;
+    ccntr_man_map_init(&map, NULL, NULL, value_release_counted);
+    released_count = 0;
+
+    // Elements are drawn from slabs.
+    for(intptr_t i = 0; i < count; ++i)
+        ccntr_man_map_insert(&map, (void*) i, (void*)( 2 * i ));
+    assert_int_equal( ccntr_man_map_get_count(&map), count );
+
+    // An erased element is reused by the next insertion.
+    ccntr_man_map_iter_t iter = ccntr_man_map_find(&map, (void*)(intptr_t) 100);
+    ccntr_map_node_t *node = iter.node;
+    ccntr_man_map_erase(&map, &iter);
+    assert_int_equal( released_count, 1 );
+
+    ccntr_man_map_insert(&map, (void*)(intptr_t) count, (void*)(intptr_t)( 2 * count ));
+    iter = ccntr_man_map_find(&map, (void*)(intptr_t) count);
+    assert_ptr_equal( iter.node, node );
+
+    // Erase and reinsert a lot of values.
+    for(intptr_t i = 1; i < count; i += 2)
+        ccntr_man_map_erase_by_key(&map, (void*) i);
+    assert_int_equal( ccntr_man_map_erase_range(&map, (void*)(intptr_t) 1000, (void*)(intptr_t) 2000), 500 );
+    assert_int_equal( released_count, 1 + count / 2 + 500 );
+
+    for(intptr_t i = 1; i < count; i += 2)
+        ccntr_man_map_insert(&map, (void*) i, (void*)( 2 * i ));
+
+    for(intptr_t i = 0; i <= count; ++i)
+    {
+        bool exist = i % 2 || ( i != 100 && ( i < 1000 || i >= 2000 ) );
+        ccntr_man_map_citer_t citer = ccntr_man_map_find_c(&map, (void*) i);
+        if( exist )
+            assert_int_equal( (intptr_t) ccntr_man_map_citer_get_value(&citer), 2 * i );
+        else
+            assert_false( ccntr_man_map_citer_have_value(&citer) );
+    }
+
+    // Values are released before slabs be released.
+    unsigned remain = ccntr_man_map_get_count(&map);
+    released_count = 0;
+    ccntr_man_map_clear(&map);
+    assert_int_equal( released_count, remain );
+    assert_int_equal( ccntr_man_map_get_count(&map), 0 );
+
+    // The container is still usable after cleared.
+    ccntr_man_map_insert(&map, (void*)(intptr_t) 1, (void*)(intptr_t) 2);
+    assert_int_equal( (intptr_t) ccntr_man_map_find_value(&map, (void*)(intptr_t) 1), 2 );
+
+    ccntr_man_map_destroy(&map);
+    assert_int_equal( released_count, remain + 1 );
+}
+//------------------------------------------------------------------------------
 int test_man_map(void)
 {
     struct CMUnitTest tests[] =
@@ -328,6 +570,10 @@ int test_man_map(void)
         cmocka_unit_test(man_map_erase_test),
         cmocka_unit_test(man_map_pop_test),
         cmocka_unit_test(man_map_clear_test),
+        cmocka_unit_test(man_map_inline_test),
+        cmocka_unit_test(man_map_build_sorted_test),
+        cmocka_unit_test(man_map_upsert_test),
+        cmocka_unit_test(man_map_arena_test),
     };
 
     return cmocka_run_group_tests_name("managed map test", tests, man_map_create, man_map_release);
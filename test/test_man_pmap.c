@@ -0,0 +1,249 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_pmap.h"
+
+#ifdef CCNTR_THREAD_SAFE
+#include <pthread.h>
+#endif
+
+typedef struct element_t
+{
+    // For test purpose, we defined that:
+    // element_value = 2 * key_value
+    int value;
+} element_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ++ released_count;
+    free(ele);
+}
+//------------------------------------------------------------------------------
+static
+void* key_from_int(int key)
+{
+    return (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+bool snapshot_verify(const ccntr_man_pmap_snap_t *snap, int first, int step, unsigned count)
+{
+    // Verify that the snapshot contains keys (first + step * i) in order.
+
+    if( ccntr_man_pmap_snap_get_count(snap) != count ) return false;
+
+    unsigned visited = 0;
+    for(ccntr_man_pmap_citer_t iter = ccntr_man_pmap_snap_get_first(snap);
+        ccntr_man_pmap_citer_have_value(&iter);
+        ccntr_man_pmap_citer_move_next(&iter))
+    {
+        int              key = (intptr_t) ccntr_man_pmap_citer_get_key(&iter);
+        const element_t *ele = ccntr_man_pmap_citer_get_value(&iter);
+        if( key != first + step * (int) visited ) return false;
+        if( ele->value != 2 * key ) return false;
+        ++ visited;
+    }
+
+    return visited == count;
+}
+//------------------------------------------------------------------------------
+static
+void man_pmap_snapshot_test(void **state)
+{
+    enum { count = 1000 };
+
+    ccntr_man_pmap_t map;
+    ccntr_man_pmap_init(&map, NULL, NULL, (void(*)(void*)) element_release);
+    released_count = 0;
+
+    // Insert values in a shuffled order.
+    for(int i = 0; i < count; ++i)
+    {
+        int key = i * 7 % count;
+        ccntr_man_pmap_insert(&map, key_from_int(key), element_create(2 * key));
+    }
+    assert_int_equal( ccntr_man_pmap_get_count(&map), count );
+
+    ccntr_man_pmap_snap_t *snap_full = ccntr_man_pmap_get_snapshot(&map);
+    assert_true( snapshot_verify(snap_full, 0, 1, count) );
+
+    // Erase odd keys, and values are still held by the snapshot.
+    for(int i = 1; i < count; i += 2)
+        assert_true( ccntr_man_pmap_erase_by_key(&map, key_from_int(i)) );
+    assert_false( ccntr_man_pmap_erase_by_key(&map, key_from_int(1)) );
+    assert_int_equal( ccntr_man_pmap_get_count(&map), count / 2 );
+    assert_int_equal( released_count, 0 );
+
+    ccntr_man_pmap_snap_t *snap_even = ccntr_man_pmap_get_snapshot(&map);
+    assert_true( snapshot_verify(snap_even, 0, 2, count / 2) );
+    assert_true( snapshot_verify(snap_full, 0, 1, count) );
+
+    // Search in different versions.
+    assert_null( ccntr_man_pmap_snap_find_value(snap_even, key_from_int(11)) );
+    const element_t *ele = ccntr_man_pmap_snap_find_value(snap_full, key_from_int(11));
+    assert_non_null( ele );
+    assert_int_equal( ele->value, 22 );
+
+    ccntr_man_pmap_citer_t iter = ccntr_man_pmap_snap_find_nearest_great(snap_even, key_from_int(11));
+    assert_true( snapshot_verify(snap_even, 0, 2, count / 2) );
+    for(int key = 12; key < count; key += 2)
+    {
+        assert_true( ccntr_man_pmap_citer_have_value(&iter) );
+        assert_int_equal( (intptr_t) ccntr_man_pmap_citer_get_key(&iter), key );
+        ccntr_man_pmap_citer_move_next(&iter);
+    }
+    assert_false( ccntr_man_pmap_citer_have_value(&iter) );
+
+    iter = ccntr_man_pmap_snap_find_nearest_great(snap_even, key_from_int(count));
+    assert_false( ccntr_man_pmap_citer_have_value(&iter) );
+
+    // Odd values are released with the last version which contains them.
+    ccntr_man_pmap_snap_release(snap_full);
+    ccntr_man_pmap_clear(&map);
+    assert_int_equal( ccntr_man_pmap_get_count(&map), 0 );
+    assert_true( snapshot_verify(snap_even, 0, 2, count / 2) );
+    assert_int_equal( released_count, count / 2 );
+
+    ccntr_man_pmap_snap_release(snap_even);
+    ccntr_man_pmap_destroy(&map);
+    assert_int_equal( released_count, count );
+}
+//------------------------------------------------------------------------------
+static
+void man_pmap_replace_test(void **state)
+{
+    ccntr_man_pmap_t map;
+    ccntr_man_pmap_init(&map, NULL, NULL, (void(*)(void*)) element_release);
+    released_count = 0;
+
+    for(int i = 0; i < 100; ++i)
+        ccntr_man_pmap_insert(&map, key_from_int(i), element_create(0));
+
+    ccntr_man_pmap_snap_t *snap_old = ccntr_man_pmap_get_snapshot(&map);
+
+    // Replace all values in a new version.
+    for(int i = 99; i >= 0; --i)
+        ccntr_man_pmap_insert(&map, key_from_int(i), element_create(2 * i));
+    assert_int_equal( ccntr_man_pmap_get_count(&map), 100 );
+    assert_int_equal( released_count, 0 );
+
+    ccntr_man_pmap_snap_t *snap_new = ccntr_man_pmap_get_snapshot(&map);
+    assert_true( snapshot_verify(snap_new, 0, 1, 100) );
+
+    const element_t *ele = ccntr_man_pmap_snap_find_value(snap_old, key_from_int(50));
+    assert_int_equal( ele->value, 0 );
+
+    // Old versions which are just replaced are released after the grace periods.
+    ccntr_man_pmap_snap_release(snap_old);
+    ccntr_man_pmap_reclaim(&map);
+    ccntr_man_pmap_reclaim(&map);
+    assert_int_equal( released_count, 100 );
+
+    ccntr_man_pmap_snap_release(snap_new);
+    ccntr_man_pmap_destroy(&map);
+    assert_int_equal( released_count, 200 );
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_THREAD_SAFE
+
+#define READER_COUNT 4
+#define WRITER_ROUNDS 200
+#define WRITER_VALUES 100
+
+typedef struct thread_arg_t
+{
+    ccntr_man_pmap_t *map;
+    bool              stop;
+} thread_arg_t;
+
+static
+void* snapshot_reader(void *param)
+{
+    thread_arg_t *arg = param;
+
+    // Each version contains a range of consecutive keys.
+    while( !__atomic_load_n(&arg->stop, __ATOMIC_ACQUIRE) )
+    {
+        ccntr_man_pmap_snap_t *snap = ccntr_man_pmap_get_snapshot(arg->map);
+
+        unsigned count = ccntr_man_pmap_snap_get_count(snap);
+        int      first = 0;
+        if( count )
+        {
+            ccntr_man_pmap_citer_t iter = ccntr_man_pmap_snap_get_first(snap);
+            first = (intptr_t) ccntr_man_pmap_citer_get_key(&iter);
+        }
+
+        bool valid = snapshot_verify(snap, first, 1, count);
+        ccntr_man_pmap_snap_release(snap);
+
+        if( !valid ) return arg;
+    }
+
+    return NULL;
+}
+
+static
+void man_pmap_concurrent_test(void **state)
+{
+    ccntr_man_pmap_t map;
+    ccntr_man_pmap_init(&map, NULL, NULL, (void(*)(void*)) free);
+
+    thread_arg_t arg = { &map, false };
+    pthread_t    threads[READER_COUNT];
+    for(unsigned i = 0; i < READER_COUNT; ++i)
+        assert_int_equal( pthread_create(&threads[i], NULL, snapshot_reader, &arg), 0 );
+
+    // Slide a window of keys.
+    for(int i = 0; i < WRITER_ROUNDS * WRITER_VALUES; ++i)
+    {
+        ccntr_man_pmap_insert(&map, key_from_int(i), element_create(2 * i));
+        if( i >= WRITER_VALUES )
+            assert_true( ccntr_man_pmap_erase_by_key(&map, key_from_int(i - WRITER_VALUES)) );
+    }
+
+    __atomic_store_n(&arg.stop, true, __ATOMIC_RELEASE);
+    for(unsigned i = 0; i < READER_COUNT; ++i)
+    {
+        void *failed;
+        assert_int_equal( pthread_join(threads[i], &failed), 0 );
+        assert_null( failed );
+    }
+
+    assert_int_equal( ccntr_man_pmap_get_count(&map), WRITER_VALUES );
+    ccntr_man_pmap_destroy(&map);
+}
+
+#endif  // CCNTR_THREAD_SAFE
+//------------------------------------------------------------------------------
+int test_man_pmap(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_pmap_snapshot_test),
+        cmocka_unit_test(man_pmap_replace_test),
+#ifdef CCNTR_THREAD_SAFE
+        cmocka_unit_test(man_pmap_concurrent_test),
+#endif
+    };
+
+    return cmocka_run_group_tests_name("persistent map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
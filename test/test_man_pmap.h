@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_PMAP_H_
+#define _TEST_MAN_PMAP_H_
+
+int test_man_pmap(void);
+
+#endif
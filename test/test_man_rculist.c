@@ -0,0 +1,201 @@
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_rculist.h"
+
+#ifdef CCNTR_THREAD_SAFE
+#include <stdatomic.h>
+#include <pthread.h>
+#endif
+
+typedef struct element_t
+{
+    int value;
+} element_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ++ released_count;
+    free(ele);
+}
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_RCULIST(subscribers, element_t*, (void(*)(void*)) element_release)
+//------------------------------------------------------------------------------
+#define compare_order(list, target) compare_order_and_array(list, target, sizeof(target)/sizeof(target[0]))
+static
+bool compare_order_and_array(subscribers_t *list, int array[], unsigned count)
+{
+    if( subscribers_get_count(list) != count ) return false;
+
+    subscribers_citer_t iter = subscribers_get_first_c(list);
+    for(unsigned i = 0; i < count; ++i, subscribers_citer_move_next(&iter))
+    {
+        if( !subscribers_citer_have_value(&iter) ) return false;
+        if( subscribers_citer_get_value(&iter)->value != array[i] ) return false;
+    }
+
+    return !subscribers_citer_have_value(&iter);
+}
+//------------------------------------------------------------------------------
+static
+void man_rculist_insert_and_erase_test(void **state)
+{
+    released_count = 0;
+
+    subscribers_t list;
+    subscribers_init(&list);
+
+    element_t *ele_2 = element_create(2);
+
+    subscribers_insert_last(&list, element_create(3));
+    subscribers_insert_first(&list, ele_2);
+    subscribers_insert_first(&list, element_create(0));
+    subscribers_insert_last(&list, element_create(4));
+    {
+        subscribers_iter_t iter = subscribers_get_first(&list);
+        subscribers_iter_move_next(&iter);
+        subscribers_insert(&list, &iter, element_create(1));
+
+        int target[] = { 0, 1, 2, 3, 4 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    // Erased values will not be released until readers leave.
+    {
+        unsigned ticket = subscribers_read_lock(&list);
+
+        subscribers_iter_t iter = subscribers_get_first(&list);
+        subscribers_erase(&list, &iter);
+        assert_int_equal( subscribers_iter_get_value(&iter)->value, 1 );
+
+        assert_true( subscribers_erase_value(&list, ele_2) );
+        assert_false( subscribers_erase_value(&list, ele_2) );
+        assert_int_equal( ele_2->value, 2 );
+
+        subscribers_reclaim(&list);
+        subscribers_reclaim(&list);
+        assert_int_equal( released_count, 0 );
+
+        subscribers_read_unlock(&list, ticket);
+
+        subscribers_reclaim(&list);
+        subscribers_reclaim(&list);
+        assert_int_equal( released_count, 2 );
+
+        int target[] = { 1, 3, 4 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    subscribers_clear(&list);
+    assert_int_equal( subscribers_get_count(&list), 0 );
+
+    subscribers_destroy(&list);
+    assert_int_equal( released_count, 5 );
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_THREAD_SAFE
+
+#define READER_COUNT  3
+#define WRITER_ROUNDS 5000
+
+static atomic_bool writer_finished;
+
+static
+void* concurrent_reader(void *param)
+{
+    subscribers_t *list = param;
+
+    // Values are always kept in ascending order by the writer.
+    while( !atomic_load(&writer_finished) )
+    {
+        unsigned ticket = subscribers_read_lock(list);
+
+        int prev = -1;
+        for(subscribers_iter_t iter = subscribers_get_first(list);
+            subscribers_iter_have_value(&iter);
+            subscribers_iter_move_next(&iter))
+        {
+            int value = subscribers_iter_get_value(&iter)->value;
+            if( value <= prev )
+            {
+                subscribers_read_unlock(list, ticket);
+                return iter.super.node;
+            }
+
+            prev = value;
+        }
+
+        subscribers_read_unlock(list, ticket);
+    }
+
+    return NULL;
+}
+
+static
+void man_rculist_concurrent_test(void **state)
+{
+    released_count = 0;
+    atomic_store(&writer_finished, false);
+
+    subscribers_t list;
+    subscribers_init(&list);
+
+    for(int i = 0; i < 8; ++i)
+        subscribers_insert_last(&list, element_create(i));
+
+    pthread_t readers[READER_COUNT];
+    for(unsigned i = 0; i < READER_COUNT; ++i)
+        assert_int_equal( pthread_create(&readers[i], NULL, concurrent_reader, &list), 0 );
+
+    // Rotate values: erase the first one, and insert a greater one at the end.
+    for(int i = 8; i < 8 + WRITER_ROUNDS; ++i)
+    {
+        subscribers_iter_t iter = subscribers_get_first(&list);
+        subscribers_erase(&list, &iter);
+        subscribers_insert_last(&list, element_create(i));
+    }
+
+    atomic_store(&writer_finished, true);
+    for(unsigned i = 0; i < READER_COUNT; ++i)
+    {
+        void *failed;
+        assert_int_equal( pthread_join(readers[i], &failed), 0 );
+        assert_null( failed );
+    }
+
+    assert_int_equal( subscribers_get_count(&list), 8 );
+
+    subscribers_destroy(&list);
+    assert_int_equal( released_count, 8 + WRITER_ROUNDS );
+}
+
+#endif  // CCNTR_THREAD_SAFE
+//------------------------------------------------------------------------------
+int test_man_rculist(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_rculist_insert_and_erase_test),
+#ifdef CCNTR_THREAD_SAFE
+        cmocka_unit_test(man_rculist_concurrent_test),
+#endif
+    };
+
+    return cmocka_run_group_tests_name("managed read-mostly list test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
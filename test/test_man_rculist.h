@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_RCULIST_H_
+#define _TEST_MAN_RCULIST_H_
+
+int test_man_rculist(void);
+
+#endif
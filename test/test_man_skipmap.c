@@ -0,0 +1,216 @@
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_skipmap.h"
+
+typedef struct testkey_t
+{
+    int value;
+} testkey_t;
+
+typedef struct element_t
+{
+    // For test purpose, we defined that:
+    // element_value = 2 * key_value
+    int value;
+} element_t;
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+testkey_t* testkey_create(int value)
+{
+    testkey_t *key = malloc(sizeof(testkey_t));
+    key->value = value;
+
+    return key;
+}
+//------------------------------------------------------------------------------
+static
+void testkey_release(testkey_t *key)
+{
+    free(key);
+}
+//------------------------------------------------------------------------------
+static
+int testkey_compare(const testkey_t *key1, const testkey_t *key2)
+{
+    return key1->value - key2->value;
+}
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    ++ released_count;
+    free(ele);
+}
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_SKIPMAP(skipmap,
+                      testkey_t*,
+                      element_t*,
+                      (int(*)(const void*,const void*)) testkey_compare,
+                      (void(*)(void*)) testkey_release,
+                      (void(*)(void*)) element_release)
+//------------------------------------------------------------------------------
+static
+int man_skipmap_create(void **state)
+{
+    skipmap_t *map = malloc(sizeof(skipmap_t));
+    if( !map ) return -1;
+
+    skipmap_init(map);
+
+    *state = map;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+int man_skipmap_release(void **state)
+{
+    skipmap_t *map = *state;
+
+    skipmap_destroy(map);
+    free(map);
+
+    *state = 0;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+void man_skipmap_insert_test(void **state)
+{
+    skipmap_t *map = *state;
+
+    assert_int_equal( skipmap_get_count(map), 0 );
+
+    skipmap_insert(map, testkey_create(3), element_create(2*3));
+    skipmap_insert(map, testkey_create(1), element_create(2*1));
+    skipmap_insert(map, testkey_create(5), element_create(2*5));
+    skipmap_insert(map, testkey_create(2), element_create(2*2));
+    skipmap_insert(map, testkey_create(4), element_create(2*4));
+    assert_int_equal( skipmap_get_count(map), 5 );
+
+    // Replace value, and the old one will be released after reclaimed.
+
+    skipmap_insert(map, testkey_create(4), element_create(2*4));
+    assert_int_equal( skipmap_get_count(map), 5 );
+
+    skipmap_reclaim(map);
+    skipmap_reclaim(map);
+    assert_int_equal( released_count, 1 );
+
+    // Iterate values.
+
+    int expected = 1;
+    for(skipmap_iter_t iter = skipmap_get_first(map);
+        skipmap_iter_have_value(&iter);
+        skipmap_iter_move_next(&iter), ++expected)
+    {
+        assert_int_equal( skipmap_iter_get_key(&iter)->value, expected );
+        assert_int_equal( skipmap_iter_get_value(&iter)->value, 2 * expected );
+    }
+    assert_int_equal( expected, 6 );
+
+    for(skipmap_citer_t iter = skipmap_get_last_c(map);
+        skipmap_citer_have_value(&iter);
+        skipmap_citer_move_prev(&iter))
+    {
+        assert_int_equal( skipmap_citer_get_key(&iter)->value, -- expected );
+    }
+    assert_int_equal( expected, 1 );
+}
+//------------------------------------------------------------------------------
+static
+void man_skipmap_find_test(void **state)
+{
+    skipmap_t *map = *state;
+
+    unsigned ticket = skipmap_read_lock(map);
+
+    testkey_t key = { 3 };
+    assert_int_equal( skipmap_find_value(map, &key)->value, 2*3 );
+
+    skipmap_iter_t iter = skipmap_find(map, &key);
+    assert_int_equal( skipmap_iter_get_key(&iter)->value, 3 );
+
+    key.value = 0;
+    assert_null( skipmap_find_value(map, &key) );
+
+    skipmap_citer_t citer = skipmap_find_nearest_less_c(map, &key);
+    assert_false( skipmap_citer_have_value(&citer) );
+    citer = skipmap_find_nearest_great_c(map, &key);
+    assert_int_equal( skipmap_citer_get_key(&citer)->value, 1 );
+
+    key.value = 6;
+    iter = skipmap_find_nearest_less(map, &key);
+    assert_int_equal( skipmap_iter_get_key(&iter)->value, 5 );
+    iter = skipmap_find_nearest_great(map, &key);
+    assert_false( skipmap_iter_have_value(&iter) );
+
+    skipmap_read_unlock(map, ticket);
+}
+//------------------------------------------------------------------------------
+static
+void man_skipmap_erase_test(void **state)
+{
+    skipmap_t *map = *state;
+
+    testkey_t key = { 2 };
+    skipmap_erase_by_key(map, &key);
+    assert_int_equal( skipmap_get_count(map), 4 );
+    assert_null( skipmap_find_value(map, &key) );
+
+    skipmap_iter_t iter = skipmap_get_first(map);
+    skipmap_erase(map, &iter);
+    assert_int_equal( skipmap_get_count(map), 3 );
+    assert_int_equal( skipmap_iter_get_key(&iter)->value, 3 );
+
+    skipmap_reclaim(map);
+    skipmap_reclaim(map);
+    assert_int_equal( released_count, 3 );
+
+    // Values erased in a read section will not be released before leaving it.
+
+    unsigned ticket = skipmap_read_lock(map);
+
+    key.value = 3;
+    skipmap_erase_by_key(map, &key);
+    skipmap_reclaim(map);
+    skipmap_reclaim(map);
+    assert_int_equal( released_count, 3 );
+
+    skipmap_read_unlock(map, ticket);
+
+    skipmap_reclaim(map);
+    skipmap_reclaim(map);
+    assert_int_equal( released_count, 4 );
+
+    skipmap_clear(map);
+    assert_int_equal( skipmap_get_count(map), 0 );
+    assert_int_equal( released_count, 6 );
+}
+//------------------------------------------------------------------------------
+int test_man_skipmap(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_skipmap_insert_test),
+        cmocka_unit_test(man_skipmap_find_test),
+        cmocka_unit_test(man_skipmap_erase_test),
+    };
+
+    return cmocka_run_group_tests_name("managed skip list map test", tests, man_skipmap_create, man_skipmap_release);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_SKIPMAP_H_
+#define _TEST_MAN_SKIPMAP_H_
+
+int test_man_skipmap(void);
+
+#endif
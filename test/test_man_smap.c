@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_smap.h"
+
+enum { key_count = 600 };
+
+static int released_count = 0;
+
+//------------------------------------------------------------------------------
+static
+char* key_create(const char *str)
+{
+    char *key = malloc(strlen(str) + 1);
+    strcpy(key, str);
+
+    return key;
+}
+//------------------------------------------------------------------------------
+static
+void key_release(char *key)
+{
+    ++ released_count;
+    free(key);
+}
+//------------------------------------------------------------------------------
+static
+int compare_strs(const void *str1, const void *str2)
+{
+    return strcmp(*(const char *const*) str1, *(const char *const*) str2);
+}
+//------------------------------------------------------------------------------
+static
+void keys_generate(char keys[key_count][32])
+{
+    // Keys are short, or have long common prefixes,
+    // and some of them are prefixes of others.
+
+    for(int i = 0; i < key_count; ++i)
+    {
+        switch( i % 4 )
+        {
+        case 0:  sprintf(keys[i], "%d", i); break;
+        case 1:  sprintf(keys[i], "common_prefix_%d", i); break;
+        case 2:  sprintf(keys[i], i < 52 ? "common_p%c" : "common_p%c_%d", 'A' + i % 26, i); break;
+        default: sprintf(keys[i], "common_prefix_%d\xff", i - 2); break;
+        }
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_smap_order_test(void **state)
+{
+    static char keys[key_count][32];
+    keys_generate(keys);
+
+    ccntr_man_smap_t map;
+    ccntr_man_smap_init(&map, (void(*)(void*)) key_release, NULL);
+    released_count = 0;
+
+    for(int i = 0; i < key_count; ++i)
+        ccntr_man_smap_insert(&map, key_create(keys[i]), keys[i]);
+
+    // Short keys which are equal in prefixes but different in lengths.
+    ccntr_man_smap_insert(&map, key_create(""), NULL);
+    ccntr_man_smap_insert(&map, key_create("common_p"), NULL);
+    assert_int_equal( ccntr_man_smap_get_count(&map), key_count + 2 );
+    assert_int_equal( released_count, 0 );
+
+    const char *sorted[ key_count + 2 ];
+    for(int i = 0; i < key_count; ++i)
+        sorted[i] = keys[i];
+    sorted[ key_count ] = "";
+    sorted[ key_count + 1 ] = "common_p";
+    qsort(sorted, key_count + 2, sizeof(sorted[0]), compare_strs);
+
+    // Values are visited in the order of strcmp.
+    int index = 0;
+    for(ccntr_man_smap_citer_t iter = ccntr_man_smap_get_first_c(&map);
+        ccntr_man_smap_citer_have_value(&iter);
+        ccntr_man_smap_citer_move_next(&iter))
+    {
+        assert_string_equal( ccntr_man_smap_citer_get_key(&iter), sorted[ index ++ ] );
+    }
+    assert_int_equal( index, key_count + 2 );
+
+    for(ccntr_man_smap_iter_t iter = ccntr_man_smap_get_last(&map);
+        ccntr_man_smap_iter_have_value(&iter);
+        ccntr_man_smap_iter_move_prev(&iter))
+    {
+        assert_string_equal( ccntr_man_smap_iter_get_key(&iter), sorted[ -- index ] );
+    }
+    assert_int_equal( index, 0 );
+
+    // Search by keys which are not the same objects.
+    for(int i = 0; i < key_count; ++i)
+    {
+        char query[32];
+        strcpy(query, keys[i]);
+        assert_ptr_equal( ccntr_man_smap_find_value(&map, query), keys[i] );
+    }
+    assert_null( ccntr_man_smap_find_value(&map, "common") );
+    assert_null( ccntr_man_smap_find_value(&map, "common_prefix_") );
+    assert_null( ccntr_man_smap_find_value_c(&map, "zzz") );
+
+    // Compare nearest search results with the sorted keys.
+    const char *queries[] = { "", "1", "5\xff", "common", "common_p", "common_pB", "common_prefix_", "\xff" };
+    for(unsigned i = 0; i < sizeof(queries) / sizeof(queries[0]); ++i)
+    {
+        int great = 0;
+        while( great < key_count + 2 && strcmp(sorted[great], queries[i]) < 0 ) ++ great;
+        int less = great < key_count + 2 && !strcmp(sorted[great], queries[i]) ? great : great - 1;
+
+        ccntr_man_smap_citer_t iter;
+
+        iter = ccntr_man_smap_find_nearest_great_c(&map, queries[i]);
+        if( great < key_count + 2 )
+            assert_string_equal( ccntr_man_smap_citer_get_key(&iter), sorted[great] );
+        else
+            assert_false( ccntr_man_smap_citer_have_value(&iter) );
+
+        iter = ccntr_man_smap_find_nearest_less_c(&map, queries[i]);
+        if( less >= 0 )
+            assert_string_equal( ccntr_man_smap_citer_get_key(&iter), sorted[less] );
+        else
+            assert_false( ccntr_man_smap_citer_have_value(&iter) );
+    }
+
+    ccntr_man_smap_destroy(&map);
+    assert_int_equal( released_count, key_count + 2 );
+}
+//------------------------------------------------------------------------------
+static
+void man_smap_modify_test(void **state)
+{
+    ccntr_man_smap_t map;
+    ccntr_man_smap_init(&map, (void(*)(void*)) key_release, NULL);
+    released_count = 0;
+
+    static int values[4];
+
+    ccntr_man_smap_insert(&map, key_create("a long key for test"), &values[0]);
+    ccntr_man_smap_insert(&map, key_create("a long key"), &values[1]);
+    ccntr_man_smap_insert(&map, key_create("short"), &values[2]);
+    assert_int_equal( ccntr_man_smap_get_count(&map), 3 );
+
+    // Replace and update.
+    ccntr_man_smap_insert(&map, key_create("a long key"), &values[3]);
+    assert_int_equal( released_count, 1 );
+    assert_ptr_equal( ccntr_man_smap_find_value(&map, "a long key"), &values[3] );
+
+    assert_false( ccntr_man_smap_upsert(&map, key_create("short"), &values[1]) );
+    assert_int_equal( released_count, 2 );
+    assert_ptr_equal( ccntr_man_smap_find_value(&map, "short"), &values[1] );
+    assert_true( ccntr_man_smap_upsert(&map, key_create("shorter"), &values[2]) );
+    assert_int_equal( ccntr_man_smap_get_count(&map), 4 );
+
+    bool inserted;
+    void **storage = ccntr_man_smap_find_or_insert(&map, key_create("new"), &inserted);
+    assert_true( inserted );
+    assert_null( *storage );
+    *storage = &values[0];
+    char *key = key_create("new");
+    assert_ptr_equal( ccntr_man_smap_find_or_insert(&map, key, &inserted), storage );
+    assert_false( inserted );
+    key_release(key);
+
+    // Erase and pop.
+    ccntr_man_smap_erase_by_key(&map, "short");
+    ccntr_man_smap_erase_by_key(&map, "short");
+    assert_null( ccntr_man_smap_find_value(&map, "short") );
+    assert_int_equal( ccntr_man_smap_get_count(&map), 4 );
+
+    ccntr_man_smap_iter_t iter = ccntr_man_smap_find(&map, "a long key for test");
+    key = ccntr_man_smap_iter_get_key(&iter);
+    assert_ptr_equal( ccntr_man_smap_pop(&map, &iter), &values[0] );
+    assert_false( ccntr_man_smap_iter_have_value(&iter) );
+    free(key);
+
+    iter = ccntr_man_smap_find(&map, "new");
+    ccntr_man_smap_erase(&map, &iter);
+    assert_int_equal( ccntr_man_smap_get_count(&map), 2 );
+
+    ccntr_man_smap_clear(&map);
+    assert_int_equal( ccntr_man_smap_get_count(&map), 0 );
+    assert_int_equal( released_count, 7 );
+
+    ccntr_man_smap_destroy(&map);
+}
+//------------------------------------------------------------------------------
+int test_man_smap(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_smap_order_test),
+        cmocka_unit_test(man_smap_modify_test),
+    };
+
+    return cmocka_run_group_tests_name("managed string map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
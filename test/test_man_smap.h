@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_SMAP_H_
+#define _TEST_MAN_SMAP_H_
+
+int test_man_smap(void);
+
+#endif
@@ -0,0 +1,356 @@
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_man_ulist.h"
+
+typedef struct element_t
+{
+    int value;
+} element_t;
+
+//------------------------------------------------------------------------------
+static
+element_t* element_create(int value)
+{
+    element_t *ele = malloc(sizeof(element_t));
+    ele->value = value;
+
+    return ele;
+}
+//------------------------------------------------------------------------------
+static
+void element_release(element_t *ele)
+{
+    free(ele);
+}
+//------------------------------------------------------------------------------
+CCNTR_DECLARE_ULIST(list, element_t*, (void(*)(void*))element_release)
+//------------------------------------------------------------------------------
+#define compare_list(list, target) compare_list_and_array(list, target, sizeof(target)/sizeof(target[0]))
+static
+bool compare_list_and_array(const list_t *list, int array[], unsigned count)
+{
+    // Compare elements count.
+    if( list_get_count(list) != count ) return false;
+
+    // Access forward and compare elements.
+    list_citer_t iter = list_get_first_c(list);
+    for(int i = 0; i < (int)count; ++i, list_citer_move_next(&iter))
+    {
+        if( !list_citer_have_value(&iter) ) return false;
+
+        const element_t *ele = list_citer_get_value(&iter);
+        if( ele->value != array[i] ) return false;
+    }
+    if( list_citer_have_value(&iter) ) return false;
+
+    // Access backward and compare elements.
+    iter = list_get_last_c(list);
+    for(int i = (int)count - 1; i >= 0; --i, list_citer_move_prev(&iter))
+    {
+        if( !list_citer_have_value(&iter) ) return false;
+
+        const element_t *ele = list_citer_get_value(&iter);
+        if( ele->value != array[i] ) return false;
+    }
+    if( list_citer_have_value(&iter) ) return false;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+bool is_list_empty(const list_t *list)
+{
+    return !list_get_count(list);
+}
+//------------------------------------------------------------------------------
+static
+int man_ulist_create(void **state)
+{
+    list_t *list = malloc(sizeof(*list));
+    if( !list ) return -1;
+
+    list_init(list);
+
+    *state = list;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+int man_ulist_release(void **state)
+{
+    list_t *list = *state;
+
+    list_destroy(list);
+    free(list);
+
+    *state = NULL;
+    return 0;
+}
+//------------------------------------------------------------------------------
+static
+void man_ulist_insert_test(void **state)
+{
+    list_t *list = *state;
+
+    assert_true( is_list_empty(list) );
+
+    element_t *ele_1 = element_create(1);
+    element_t *ele_2 = element_create(2);
+    element_t *ele_3 = element_create(3);
+    element_t *ele_4 = element_create(4);
+    element_t *ele_5 = element_create(5);
+    element_t *ele_6 = element_create(6);
+
+    {
+        list_insert_last(list, ele_5);
+
+        int target[] = { 5 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_insert_last(list, ele_6);
+
+        int target[] = { 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_insert_first(list, ele_2);
+
+        int target[] = { 2, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_insert_first(list, ele_1);
+
+        int target[] = { 1, 2, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_iter_t pos = list_get_last(list);
+        list_iter_move_prev(&pos);
+        assert_true( list_iter_have_value(&pos) );
+
+        list_insert(list, &pos, ele_3);
+
+        int target[] = { 1, 2, 3, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_iter_t pos = list_get_last(list);
+        list_iter_move_prev(&pos);
+        assert_true( list_iter_have_value(&pos) );
+
+        list_insert(list, &pos, ele_4);
+
+        int target[] = { 1, 2, 3, 4, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_ulist_erase_test(void **state)
+{
+    list_t *list = *state;
+
+    {
+        int target[] = { 1, 2, 3, 4, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_erase_first(list);
+
+        int target[] = { 2, 3, 4, 5, 6 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_erase_last(list);
+
+        int target[] = { 2, 3, 4, 5 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_iter_t pos = list_get_first(list);
+        list_iter_move_next(&pos);
+        assert_true( list_iter_have_value(&pos) );
+
+        list_erase(list, &pos);
+
+        int target[] = { 2, 4, 5 };
+        assert_true( compare_list(list, target) );
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_ulist_pop_test(void **state)
+{
+    list_t *list = *state;
+
+    {
+        int target[] = { 2, 4, 5 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_iter_t pos = list_get_first(list);
+        list_iter_move_next(&pos);
+        assert_true( list_iter_have_value(&pos) );
+
+        element_t *ele = list_pop(list, &pos);
+        assert_non_null( ele );
+
+        int target[] = { 2, 5 };
+        assert_true( compare_list(list, target) );
+
+        element_release(ele);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void man_ulist_clear_test(void **state)
+{
+    list_t *list = *state;
+
+    {
+        int target[] = { 2, 5 };
+        assert_true( compare_list(list, target) );
+    }
+
+    {
+        list_clear(list);
+        assert_true( is_list_empty(list) );
+    }
+}
+//------------------------------------------------------------------------------
+static
+bool compare_ulist_and_array(const ccntr_man_ulist_t *list, const int array[], unsigned count)
+{
+    if( ccntr_man_ulist_get_count(list) != count ) return false;
+
+    ccntr_man_ulist_citer_t iter = ccntr_man_ulist_get_first_c(list);
+    for(unsigned i = 0; i < count; ++i, ccntr_man_ulist_citer_move_next(&iter))
+    {
+        if( !ccntr_man_ulist_citer_have_value(&iter) ) return false;
+        if( (intptr_t) ccntr_man_ulist_citer_get_value(&iter) != array[i] ) return false;
+    }
+    if( ccntr_man_ulist_citer_have_value(&iter) ) return false;
+
+    iter = ccntr_man_ulist_get_last_c(list);
+    for(int i = (int)count - 1; i >= 0; --i, ccntr_man_ulist_citer_move_prev(&iter))
+    {
+        if( !ccntr_man_ulist_citer_have_value(&iter) ) return false;
+        if( (intptr_t) ccntr_man_ulist_citer_get_value(&iter) != array[i] ) return false;
+    }
+    if( ccntr_man_ulist_citer_have_value(&iter) ) return false;
+
+    return true;
+}
+//------------------------------------------------------------------------------
+static
+ccntr_man_ulist_iter_t ulist_get_iter_at(ccntr_man_ulist_t *list, unsigned index)
+{
+    ccntr_man_ulist_iter_t iter = ccntr_man_ulist_get_first(list);
+    while( index-- )
+        ccntr_man_ulist_iter_move_next(&iter);
+
+    return iter;
+}
+//------------------------------------------------------------------------------
+static
+void man_ulist_chunk_test(void **state)
+{
+    // Use a tiny chunk capacity to make chunks be split and merged frequently.
+    ccntr_man_ulist_t list;
+    ccntr_man_ulist_init(&list, 4, NULL);
+
+    int      array[256];
+    unsigned count = 0;
+
+    srand(1);
+    for(unsigned round = 0; round < 2000; ++round)
+    {
+        int      op    = rand() % 5;
+        unsigned index = count ? rand() % count : 0;
+
+        if( count < 200 && op < 3 )
+        {
+            int value = rand();
+
+            if( op == 0 )
+            {
+                ccntr_man_ulist_iter_t pos = ulist_get_iter_at(&list, index);
+                ccntr_man_ulist_insert(&list, &pos, (void*)(intptr_t) value);
+                if( index < count )
+                    assert_int_equal( (intptr_t) ccntr_man_ulist_iter_get_value(&pos), array[index] );
+                else
+                    assert_false( ccntr_man_ulist_iter_have_value(&pos) );
+            }
+            else if( op == 1 )
+            {
+                ccntr_man_ulist_insert_first(&list, (void*)(intptr_t) value);
+                index = 0;
+            }
+            else
+            {
+                ccntr_man_ulist_insert_last(&list, (void*)(intptr_t) value);
+                index = count;
+            }
+
+            for(unsigned i = count; i > index; --i)
+                array[i] = array[i-1];
+            array[index] = value;
+            ++ count;
+        }
+        else if( count )
+        {
+            if( op == 3 )
+            {
+                ccntr_man_ulist_iter_t pos = ulist_get_iter_at(&list, index);
+                assert_int_equal( (intptr_t) ccntr_man_ulist_pop(&list, &pos), array[index] );
+                assert_false( ccntr_man_ulist_iter_have_value(&pos) );
+            }
+            else
+            {
+                index = ( rand() % 2 )?( 0 ):( count - 1 );
+                if( index )
+                    ccntr_man_ulist_erase_last(&list);
+                else
+                    ccntr_man_ulist_erase_first(&list);
+            }
+
+            -- count;
+            for(unsigned i = index; i < count; ++i)
+                array[i] = array[i+1];
+        }
+
+        assert_true( compare_ulist_and_array(&list, array, count) );
+    }
+
+    ccntr_man_ulist_destroy(&list);
+}
+//------------------------------------------------------------------------------
+int test_man_ulist(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(man_ulist_insert_test),
+        cmocka_unit_test(man_ulist_erase_test),
+        cmocka_unit_test(man_ulist_pop_test),
+        cmocka_unit_test(man_ulist_clear_test),
+        cmocka_unit_test(man_ulist_chunk_test),
+    };
+
+    return cmocka_run_group_tests_name("managed unrolled list test", tests, man_ulist_create, man_ulist_release);
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,6 @@
+#ifndef _TEST_MAN_ULIST_H_
+#define _TEST_MAN_ULIST_H_
+
+int test_man_ulist(void);
+
+#endif
@@ -7,6 +7,10 @@
 #include "ccntr.h"
 #include "test_list.h"
 
+#ifdef CCNTR_THREAD_SAFE
+#include <pthread.h>
+#endif
+
 typedef ccntr_map_node_t node_t;
 
 //------------------------------------------------------------------------------
@@ -288,6 +292,67 @@ void map_search_test(void **state)
 }
 //------------------------------------------------------------------------------
 static
+void map_find_many_test(void **state)
+{
+    enum { count = 300, query_count = 2 * count + 2 };
+
+    // Build container with even keys.
+
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_keys);
+
+    for(int i = 0; i < count; ++i)
+        assert_null( ccntr_map_link(&map, node_create(2 * i)) );
+
+    // Search sorted keys (both present and missing), from -1 to ( 2 * count ).
+
+    const void *keys[query_count];
+    node_t     *nodes[query_count];
+
+    for(int i = 0; i < query_count; ++i)
+        keys[i] = (void*)(intptr_t)( i - 1 );
+
+    assert_int_equal( ccntr_map_find_many(&map, keys, query_count, nodes), count );
+    for(int i = 0; i < query_count; ++i)
+        assert_ptr_equal( nodes[i], ccntr_map_find(&map, keys[i]) );
+
+    // Search keys in descending order.
+
+    for(int i = 0; i < query_count; ++i)
+        keys[i] = (void*)(intptr_t)( 2 * count - i );
+
+    assert_int_equal( ccntr_map_find_many(&map, keys, query_count, nodes), count );
+    for(int i = 0; i < query_count; ++i)
+        assert_ptr_equal( nodes[i], ccntr_map_find(&map, keys[i]) );
+
+    // Search unsorted keys.
+
+    for(int i = 0; i < query_count; ++i)
+        keys[i] = (void*)(intptr_t)( i * 37 % query_count - 1 );
+
+    assert_int_equal( ccntr_map_find_many(&map, keys, query_count, nodes), count );
+    for(int i = 0; i < query_count; ++i)
+        assert_ptr_equal( nodes[i], ccntr_map_find(&map, keys[i]) );
+
+    assert_int_equal( ccntr_map_find_many(&map, keys, 0, nodes), 0 );
+
+    // Clear.
+
+    for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(&map); node;)
+    {
+        ccntr_map_node_t *node_del = node;
+        node = ccntr_map_node_get_next_postorder(node);
+
+        node_release(node_del);
+    }
+
+    ccntr_map_discard_all(&map);
+
+    assert_int_equal( ccntr_map_find_many(&map, keys, 1, nodes), 0 );
+    assert_null( nodes[0] );
+}
+//------------------------------------------------------------------------------
+static
 void map_search_nearest_test(void **state)
 {
     // Build container base.
@@ -398,13 +463,13 @@ void rbtree_check_link(node_t *node)
 {
     if( node && node->left )
     {
-        assert_ptr_equal( node->left->parent, node );
+        assert_ptr_equal( ccntr_map_node_get_parent(node->left), node );
         rbtree_check_link(node->left);
     }
 
     if( node && node->right )
     {
-        assert_ptr_equal( node->right->parent, node );
+        assert_ptr_equal( ccntr_map_node_get_parent(node->right), node );
         rbtree_check_link(node->right);
     }
 }
@@ -428,7 +493,7 @@ void rbtree_check_tags_order(node_t *node)
 static
 void rbtree_check_root(node_t *root)
 {
-    assert_true( !root || !root->is_red );
+    assert_true( !root || !ccntr_map_node_is_red(root) );
 }
 //------------------------------------------------------------------------------
 static
@@ -436,10 +501,10 @@ void rbtree_check_reds(node_t *node)
 {
     if( !node ) return;
 
-    if( node->is_red )
+    if( ccntr_map_node_is_red(node) )
     {
-        assert_true( !node->left || !node->left->is_red );
-        assert_true( !node->right || !node->right->is_red );
+        assert_true( !node->left || !ccntr_map_node_is_red(node->left) );
+        assert_true( !node->right || !ccntr_map_node_is_red(node->right) );
     }
 
     rbtree_check_reds(node->left);
@@ -455,7 +520,7 @@ unsigned rbtree_check_and_count_black_level(node_t *node)
     size_t count_right = rbtree_check_and_count_black_level(node->right);
     assert_int_equal( count_left, count_right );
 
-    return count_left + ( node->is_red ? 0 : 1 );
+    return count_left + ( ccntr_map_node_is_red(node) ? 0 : 1 );
 }
 //------------------------------------------------------------------------------
 static
@@ -483,10 +548,29 @@ void rbtree_count_check(node_t *root, unsigned count)
 }
 //------------------------------------------------------------------------------
 static
+void rbtree_size_check(node_t *node)
+{
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+    if( !node ) return;
+
+    assert_int_equal( node->size, rbtree_count_nodes(node) );
+    rbtree_size_check(node->left);
+    rbtree_size_check(node->right);
+#else
+    (void) node;
+#endif
+}
+//------------------------------------------------------------------------------
+static
 void rbtree_total_condition_check(ccntr_map_t *map)
 {
     rbtree_condition_check(map->root);
     rbtree_count_check(map->root, map->count);
+    rbtree_size_check(map->root);
+
+    node_t *last = map->root;
+    while( last && last->right ) last = last->right;
+    assert_ptr_equal( map->last, last );
 }
 //------------------------------------------------------------------------------
 static
@@ -574,6 +658,498 @@ void map_rbtree_condition_test(void **state)
     }
 }
 //------------------------------------------------------------------------------
+static
+void map_build_sorted_test(void **state)
+{
+    static const unsigned counts[] = {0, 1, 2, 3, 4, 7, 8, 15, 16, 31, 33, 100, 1000};
+
+    for(unsigned i = 0; i < sizeof(counts)/sizeof(counts[0]); ++i)
+    {
+        unsigned count = counts[i];
+
+        node_t **nodes = malloc(( count + 1 ) * sizeof(node_t*));
+        assert_non_null( nodes );
+        for(unsigned k = 0; k < count; ++k)
+            nodes[k] = node_create(2 * k);
+
+        ccntr_map_t map;
+        ccntr_map_init(&map, compare_keys);
+
+        ccntr_map_build_sorted(&map, nodes, count);
+        assert_int_equal( ccntr_map_get_count(&map), count );
+        rbtree_total_condition_check(&map);
+
+        for(unsigned k = 0; k < count; ++k)
+        {
+            assert_ptr_equal( ccntr_map_find(&map, (void*)(intptr_t)( 2 * k )), nodes[k] );
+            assert_null( ccntr_map_find(&map, (void*)(intptr_t)( 2 * k + 1 )) );
+        }
+
+        // The tree can still be modified normally.
+
+        assert_null( ccntr_map_link(&map, node_create(2 * count + 1)) );
+        rbtree_total_condition_check(&map);
+
+        for(unsigned k = 0; k < count; k += 3)
+        {
+            ccntr_map_unlink(&map, nodes[k]);
+            rbtree_total_condition_check(&map);
+            node_release(nodes[k]);
+        }
+
+        // Clear.
+
+        for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(&map); node;)
+        {
+            ccntr_map_node_t *node_del = node;
+            node = ccntr_map_node_get_next_postorder(node);
+
+            node_release(node_del);
+        }
+
+        ccntr_map_discard_all(&map);
+        free(nodes);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void map_unlink_range_test_in_single_case(int count, int lower, int upper)
+{
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_keys);
+
+    // Link keys 0, 2, 4, ... in a shuffled order.
+    for(int i = 0; i < count; ++i)
+        assert_null( ccntr_map_link(&map, node_create(( i * 41 ) % count * 2)) );
+
+    int expected = 0;
+    for(int key = 0; key < 2 * count; key += 2)
+        expected += ( lower <= key && key < upper ) ? 1 : 0;
+
+    assert_int_equal( ccntr_map_count_range(&map, (void*)(intptr_t) lower, (void*)(intptr_t) upper),
+                      expected );
+
+    ccntr_map_t removed;
+    ccntr_map_init(&removed, compare_keys);
+    assert_int_equal( ccntr_map_unlink_range(&map, (void*)(intptr_t) lower, (void*)(intptr_t) upper, &removed),
+                      expected );
+
+    assert_int_equal( ccntr_map_get_count(&map), count - expected );
+    assert_int_equal( ccntr_map_get_count(&removed), expected );
+    rbtree_total_condition_check(&map);
+    rbtree_total_condition_check(&removed);
+
+    for(int key = 0; key < 2 * count; key += 2)
+    {
+        bool in_range = lower <= key && key < upper;
+        assert_true( !!ccntr_map_find(&map, (void*)(intptr_t) key) == !in_range );
+        assert_true( !!ccntr_map_find(&removed, (void*)(intptr_t) key) == in_range );
+    }
+
+    // The remaining tree can still be modified normally.
+    assert_null( ccntr_map_link(&map, node_create(-1)) );
+    rbtree_total_condition_check(&map);
+
+    // Clear.
+
+    ccntr_map_t *maps[] = { &map, &removed };
+    for(unsigned i = 0; i < 2; ++i)
+    {
+        for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(maps[i]); node;)
+        {
+            ccntr_map_node_t *node_del = node;
+            node = ccntr_map_node_get_next_postorder(node);
+
+            node_release(node_del);
+        }
+
+        ccntr_map_discard_all(maps[i]);
+    }
+}
+//------------------------------------------------------------------------------
+static
+void map_unlink_range_test(void **state)
+{
+    static const int counts[] = {0, 1, 2, 3, 5, 8, 13, 64, 100, 333};
+
+    for(unsigned i = 0; i < sizeof(counts)/sizeof(counts[0]); ++i)
+    {
+        int count = counts[i];
+        int max = 2 * count;
+
+        map_unlink_range_test_in_single_case(count, 0, max);
+        map_unlink_range_test_in_single_case(count, -5, 1);
+        map_unlink_range_test_in_single_case(count, max - 1, max + 5);
+        map_unlink_range_test_in_single_case(count, 3, 3);
+        map_unlink_range_test_in_single_case(count, 7, 2);
+
+        for(int lower = 0; lower < max; lower += 1 + max / 7)
+        {
+            for(int upper = lower + 1; upper <= max + 1; upper += 1 + max / 5)
+                map_unlink_range_test_in_single_case(count, lower, upper);
+        }
+    }
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_THREAD_SAFE
+
+#define UNLINK_RANGE_TIMES 100000
+
+typedef struct unlink_range_arg_t
+{
+    ccntr_map_t *src;
+    ccntr_map_t *dest;
+} unlink_range_arg_t;
+
+static
+void* unlink_range_worker(void *param)
+{
+    unlink_range_arg_t *arg = param;
+
+    // Both containers are empty, and only their locks are contended.
+    for(unsigned i = 0; i < UNLINK_RANGE_TIMES; ++i)
+        ccntr_map_unlink_range(arg->src, (void*)(intptr_t) 0, (void*)(intptr_t) 10, arg->dest);
+
+    return NULL;
+}
+
+static
+void map_unlink_range_concurrent_test(void **state)
+{
+    // Ranges are moved between two containers in both directions,
+    // and that must not be dead locked.
+
+    ccntr_map_t map1, map2;
+    ccntr_map_init(&map1, compare_keys);
+    ccntr_map_init(&map2, compare_keys);
+
+    unlink_range_arg_t args[2] = { { &map1, &map2 }, { &map2, &map1 } };
+    pthread_t          threads[2];
+    for(unsigned i = 0; i < 2; ++i)
+        assert_int_equal( pthread_create(&threads[i], NULL, unlink_range_worker, &args[i]), 0 );
+
+    for(unsigned i = 0; i < 2; ++i)
+        assert_int_equal( pthread_join(threads[i], NULL), 0 );
+
+    assert_int_equal( ccntr_map_get_count(&map1), 0 );
+    assert_int_equal( ccntr_map_get_count(&map2), 0 );
+}
+
+#endif  // CCNTR_THREAD_SAFE
+//------------------------------------------------------------------------------
+static
+void map_link_hint_test(void **state)
+{
+    enum { count = 300 };
+
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_keys);
+
+    // Ascending keys with the automatic appending.
+    for(int i = 0; i < count; i += 3)
+        assert_null( ccntr_map_link(&map, node_create(i)) );
+    rbtree_total_condition_check(&map);
+
+    // Descending keys with the previous linked node as the hint.
+    node_t *hint = NULL;
+    for(int i = count - 2; i >= 0; i -= 3)
+    {
+        node_t *node = node_create(i);
+        assert_null( ccntr_map_link_hint(&map, hint, node) );
+        hint = node;
+    }
+    rbtree_total_condition_check(&map);
+
+    // Hints which are not adjacent to the new nodes.
+    for(int i = 2; i < count; i += 3)
+    {
+        node_t *node = node_create(i);
+        assert_null( ccntr_map_link_hint(&map, ccntr_map_find(&map, (void*)(intptr_t)( count - 1 - i )), node) );
+        rbtree_total_condition_check(&map);
+    }
+    assert_int_equal( ccntr_map_get_count(&map), count );
+
+    // Duplicated keys around the hint.
+    for(int i = 0; i < count; ++i)
+    {
+        node_t *near = ccntr_map_find(&map, (void*)(intptr_t)( i + i % 3 - 1 ));
+        node_t *old  = ccntr_map_find(&map, (void*)(intptr_t) i);
+        assert_ptr_equal( ccntr_map_link_hint(&map, near, node_create(i)), old );
+        node_release(old);
+    }
+    rbtree_total_condition_check(&map);
+    assert_int_equal( ccntr_map_get_count(&map), count );
+
+    int key = 0;
+    for(node_t *node = ccntr_map_get_first(&map); node; node = ccntr_map_node_get_next(node), ++key)
+        assert_int_equal( (intptr_t) node->key, key );
+    assert_int_equal( key, count );
+
+    // Clear.
+
+    for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(&map); node;)
+    {
+        ccntr_map_node_t *node_del = node;
+        node = ccntr_map_node_get_next_postorder(node);
+
+        node_release(node_del);
+    }
+
+    ccntr_map_discard_all(&map);
+}
+//------------------------------------------------------------------------------
+typedef struct augmented_t
+{
+    node_t node;
+    int    bytes;
+    int    sum;     // Sum of bytes of the subtree.
+    int    max;     // Maximum of bytes of the subtree.
+} augmented_t;
+
+static
+augmented_t* augmented_create(int key, int bytes)
+{
+    augmented_t *item = malloc(sizeof(augmented_t));
+    item->node.key = (void*)(intptr_t) key;
+    item->bytes    = bytes;
+
+    return item;
+}
+
+static
+void augmented_update(node_t *node)
+{
+    augmented_t *item = container_of(node, augmented_t, node);
+    item->sum = item->bytes;
+    item->max = item->bytes;
+
+    if( node->left )
+    {
+        const augmented_t *left = container_of(node->left, augmented_t, node);
+        item->sum += left->sum;
+        if( item->max < left->max ) item->max = left->max;
+    }
+
+    if( node->right )
+    {
+        const augmented_t *right = container_of(node->right, augmented_t, node);
+        item->sum += right->sum;
+        if( item->max < right->max ) item->max = right->max;
+    }
+}
+
+static
+void augmented_check(node_t *node)
+{
+    if( !node ) return;
+
+    augmented_check(node->left);
+    augmented_check(node->right);
+
+    augmented_t *item = container_of(node, augmented_t, node);
+    int sum = item->sum;
+    int max = item->max;
+
+    augmented_update(node);
+    assert_int_equal( item->sum, sum );
+    assert_int_equal( item->max, max );
+}
+
+typedef struct aggregation_t
+{
+    int sum;
+    int max;
+} aggregation_t;
+
+static
+void augmented_aggregate(void *result, const node_t *node, bool subtree)
+{
+    aggregation_t     *aggr = result;
+    const augmented_t *item = container_of(node, const augmented_t, node);
+
+    int sum = subtree ? item->sum : item->bytes;
+    int max = subtree ? item->max : item->bytes;
+
+    aggr->sum += sum;
+    if( aggr->max < max ) aggr->max = max;
+}
+
+static
+void augmented_range_check(ccntr_map_t *map, int lower, int upper)
+{
+    aggregation_t expected = {0, 0};
+    for(const node_t *node = ccntr_map_get_first_c(map); node; node = ccntr_map_node_get_next_c(node))
+    {
+        int key = (intptr_t) node->key;
+        if( key < lower || upper <= key ) continue;
+
+        aggregation_t single = {0, 0};
+        augmented_aggregate(&single, node, false);
+        expected.sum += single.sum;
+        if( expected.max < single.max ) expected.max = single.max;
+    }
+
+    aggregation_t result = {0, 0};
+    ccntr_map_aggregate_range(map,
+                              (void*)(intptr_t) lower,
+                              (void*)(intptr_t) upper,
+                              augmented_aggregate,
+                              &result);
+    assert_int_equal( result.sum, expected.sum );
+    assert_int_equal( result.max, expected.max );
+}
+
+static
+void augmented_release_all(ccntr_map_t *map)
+{
+    for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(map); node;)
+    {
+        ccntr_map_node_t *node_del = node;
+        node = ccntr_map_node_get_next_postorder(node);
+
+        free(container_of(node_del, augmented_t, node));
+    }
+
+    ccntr_map_discard_all(map);
+}
+
+static
+void map_augment_test(void **state)
+{
+    enum { count = 300 };
+
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_keys);
+
+    // Link some nodes before the augmentation be set.
+    for(int i = 0; i < count / 2; ++i)
+    {
+        int key = ( i * 41 ) % count;
+        assert_null( ccntr_map_link(&map, &augmented_create(key, key % 17)->node) );
+    }
+    ccntr_map_set_augment(&map, augmented_update);
+    augmented_check(map.root);
+
+    for(int i = count / 2; i < count; ++i)
+    {
+        int key = ( i * 41 ) % count;
+        assert_null( ccntr_map_link(&map, &augmented_create(key, key % 17)->node) );
+    }
+    augmented_check(map.root);
+    augmented_range_check(&map, 0, count);
+    augmented_range_check(&map, 17, 18);
+    augmented_range_check(&map, 33, 250);
+    augmented_range_check(&map, 250, 33);
+
+    // Unlink nodes.
+    for(int key = 0; key < count; key += 5)
+        free(container_of(ccntr_map_unlink_by_key(&map, (void*)(intptr_t) key), augmented_t, node));
+    augmented_check(map.root);
+    augmented_range_check(&map, 1, 299);
+
+    // Replace a node, and change data of a node.
+    augmented_t *item = augmented_create(7, 100);
+    node_t *old = ccntr_map_link(&map, &item->node);
+    assert_non_null( old );
+    free(container_of(old, augmented_t, node));
+    augmented_check(map.root);
+
+    item->bytes = 3;
+    ccntr_map_refresh_augment(&map, &item->node);
+    augmented_check(map.root);
+    augmented_range_check(&map, 0, 100);
+
+    // Unlink a range.
+    ccntr_map_t removed;
+    ccntr_map_init(&removed, compare_keys);
+    ccntr_map_set_augment(&removed, augmented_update);
+
+    ccntr_map_unlink_range(&map, (void*)(intptr_t) 100, (void*)(intptr_t) 200, &removed);
+    augmented_check(map.root);
+    augmented_check(removed.root);
+    augmented_range_check(&map, 50, 250);
+    augmented_range_check(&removed, 120, 180);
+
+    // Append nodes after the last node, and unlink the last nodes,
+    // ancestors must still be updated with the augmentation.
+    for(int key = count; key < 2 * count; ++key)
+        assert_null( ccntr_map_link(&map, &augmented_create(key, key % 13)->node) );
+    augmented_check(map.root);
+    augmented_range_check(&map, 250, 2 * count);
+
+    for(int key = 2 * count - 1; key >= 3 * count / 2; --key)
+        free(container_of(ccntr_map_unlink_by_key(&map, (void*)(intptr_t) key), augmented_t, node));
+    augmented_check(map.root);
+    augmented_range_check(&map, 0, 2 * count);
+
+    augmented_release_all(&removed);
+    augmented_release_all(&map);
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+static
+void map_order_statistics_test(void **state)
+{
+    enum { count = 200 };
+
+    ccntr_map_t map;
+    ccntr_map_init(&map, compare_keys);
+
+    // Link keys 0, 3, 6, ... in a shuffled order.
+    for(int i = 0; i < count; ++i)
+        assert_null( ccntr_map_link(&map, node_create(( i * 77 ) % count * 3)) );
+    rbtree_total_condition_check(&map);
+
+    for(unsigned i = 0; i < count; ++i)
+    {
+        const node_t *node = ccntr_map_select_c(&map, i);
+        assert_non_null( node );
+        assert_int_equal( (intptr_t) node->key, 3 * i );
+
+        assert_int_equal( ccntr_map_rank(&map, (void*)(intptr_t)( 3 * i     )), i     );
+        assert_int_equal( ccntr_map_rank(&map, (void*)(intptr_t)( 3 * i + 1 )), i + 1 );
+    }
+    assert_null( ccntr_map_select(&map, count) );
+    assert_int_equal( ccntr_map_rank(&map, (void*)(intptr_t) -1), 0 );
+
+    // Unlink the even indexed keys, and check orders again.
+    for(int i = 0; i < count; i += 2)
+    {
+        node_t *node = ccntr_map_unlink_by_key(&map, (void*)(intptr_t)( 3 * i ));
+        assert_non_null( node );
+        node_release(node);
+    }
+    rbtree_total_condition_check(&map);
+
+    for(unsigned i = 0; i < count / 2; ++i)
+    {
+        assert_int_equal( (intptr_t) ccntr_map_select(&map, i)->key, 3 * ( 2 * i + 1 ) );
+        assert_int_equal( ccntr_map_rank(&map, (void*)(intptr_t)( 3 * ( 2 * i + 1 ) )), i );
+    }
+    assert_null( ccntr_map_select(&map, count / 2) );
+
+    // Clear.
+
+    for(ccntr_map_node_t *node = ccntr_map_get_first_postorder(&map); node;)
+    {
+        ccntr_map_node_t *node_del = node;
+        node = ccntr_map_node_get_next_postorder(node);
+
+        node_release(node_del);
+    }
+
+    ccntr_map_discard_all(&map);
+}
+#endif
+//------------------------------------------------------------------------------
+#if defined(CCNTR_MAP_COMPACT_NODE) && !defined(CCNTR_MAP_ORDER_STATISTICS)
+static
+void map_compact_node_test(void **state)
+{
+    assert_int_equal( sizeof(ccntr_map_node_t), 4 * sizeof(void*) );
+}
+#endif
+//------------------------------------------------------------------------------
 int test_map(void)
 {
     struct CMUnitTest tests[] =
@@ -583,9 +1159,23 @@ int test_map(void)
         cmocka_unit_test(map_unlink_test),
         cmocka_unit_test(map_unlink_by_key_test),
         cmocka_unit_test(map_search_test),
+        cmocka_unit_test(map_find_many_test),
         cmocka_unit_test(map_search_nearest_test),
         cmocka_unit_test(map_duplicated_link_test),
         cmocka_unit_test(map_rbtree_condition_test),
+        cmocka_unit_test(map_build_sorted_test),
+        cmocka_unit_test(map_unlink_range_test),
+#ifdef CCNTR_THREAD_SAFE
+        cmocka_unit_test(map_unlink_range_concurrent_test),
+#endif
+        cmocka_unit_test(map_link_hint_test),
+        cmocka_unit_test(map_augment_test),
+#ifdef CCNTR_MAP_ORDER_STATISTICS
+        cmocka_unit_test(map_order_statistics_test),
+#endif
+#if defined(CCNTR_MAP_COMPACT_NODE) && !defined(CCNTR_MAP_ORDER_STATISTICS)
+        cmocka_unit_test(map_compact_node_test),
+#endif
     };
 
     return cmocka_run_group_tests_name("map test", tests, NULL, NULL);
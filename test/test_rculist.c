@@ -0,0 +1,96 @@
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_rculist.h"
+
+typedef struct element_t
+{
+    ccntr_rculist_node_t node;
+    int                  value;
+} element_t;
+
+//------------------------------------------------------------------------------
+static
+int node_get_value(const ccntr_rculist_node_t *node)
+{
+    return ((const element_t*) node)->value;
+}
+//------------------------------------------------------------------------------
+#define compare_order(list, target) compare_order_and_array(list, target, sizeof(target)/sizeof(target[0]))
+static
+bool compare_order_and_array(ccntr_rculist_t *list, int array[], unsigned count)
+{
+    if( ccntr_rculist_get_count(list) != count ) return false;
+
+    const ccntr_rculist_node_t *node = ccntr_rculist_get_first(list);
+    for(unsigned i = 0; i < count; ++i, node = ccntr_rculist_node_get_next_c(node))
+    {
+        if( !node ) return false;
+        if( node_get_value(node) != array[i] ) return false;
+    }
+
+    return !node;
+}
+//------------------------------------------------------------------------------
+static
+void rculist_link_and_unlink_test(void **state)
+{
+    element_t elements[5];
+    for(int i = 0; i < 5; ++i)
+        elements[i].value = i;
+
+    ccntr_rculist_t list;
+    ccntr_rculist_init(&list);
+
+    ccntr_rculist_link_last(&list, &elements[2].node);
+    ccntr_rculist_link_first(&list, &elements[0].node);
+    ccntr_rculist_link(&list, &elements[2].node, &elements[1].node);
+    ccntr_rculist_link_last(&list, &elements[4].node);
+    ccntr_rculist_link(&list, &elements[4].node, &elements[3].node);
+    {
+        int target[] = { 0, 1, 2, 3, 4 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    // Unlinked node still be able to go to the next one.
+    assert_true( ccntr_rculist_unlink(&list, &elements[2].node) );
+    assert_false( ccntr_rculist_unlink(&list, &elements[2].node) );
+    assert_ptr_equal( ccntr_rculist_node_get_next(&elements[2].node), &elements[3].node );
+    {
+        int target[] = { 0, 1, 3, 4 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    assert_true( ccntr_rculist_unlink(&list, &elements[0].node) );
+    assert_true( ccntr_rculist_unlink(&list, &elements[4].node) );
+    {
+        int target[] = { 1, 3 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    ccntr_rculist_link_last(&list, &elements[4].node);
+    {
+        int target[] = { 1, 3, 4 };
+        assert_true( compare_order(&list, target) );
+    }
+
+    // Discarded nodes can still be traversed, but can not be unlinked again.
+    assert_ptr_equal( ccntr_rculist_discard_all(&list), &elements[1].node );
+    assert_int_equal( ccntr_rculist_get_count(&list), 0 );
+    assert_null( ccntr_rculist_get_first(&list) );
+    assert_ptr_equal( ccntr_rculist_node_get_next(&elements[1].node), &elements[3].node );
+    assert_false( ccntr_rculist_unlink(&list, &elements[3].node) );
+}
+//------------------------------------------------------------------------------
+int test_rculist(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(rculist_link_and_unlink_test),
+    };
+
+    return cmocka_run_group_tests_name("read-mostly list test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
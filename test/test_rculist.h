@@ -0,0 +1,6 @@
+#ifndef _TEST_RCULIST_H_
+#define _TEST_RCULIST_H_
+
+int test_rculist(void);
+
+#endif
@@ -0,0 +1,193 @@
+#include <stdint.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_sharded_map.h"
+
+#ifdef CCNTR_THREAD_SAFE
+#include <pthread.h>
+#endif
+
+typedef ccntr_map_node_t node_t;
+
+//------------------------------------------------------------------------------
+static
+void node_init(node_t *node, int key)
+{
+    node->key = (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+int node_get_key(const node_t *node)
+{
+    return (intptr_t) node->key;
+}
+//------------------------------------------------------------------------------
+static
+bool verify_order(ccntr_sharded_map_t *map, unsigned count)
+{
+    // Verify that the scan visits all nodes in key order.
+
+    if( ccntr_sharded_map_get_count(map) != count ) return false;
+
+    ccntr_sharded_map_scan_t scan;
+    ccntr_sharded_map_scan_init(&scan, map);
+
+    bool     ordered = true;
+    unsigned visited = 0;
+    int      prev    = 0;
+    for(node_t *node = ccntr_sharded_map_scan_get_next(&scan);
+        node;
+        node = ccntr_sharded_map_scan_get_next(&scan))
+    {
+        if( visited && prev >= node_get_key(node) ) ordered = false;
+        prev = node_get_key(node);
+        ++ visited;
+    }
+
+    ccntr_sharded_map_scan_destroy(&scan);
+
+    return ordered && visited == count;
+}
+//------------------------------------------------------------------------------
+static
+void sharded_map_link_and_find_test(void **state)
+{
+    enum { count = 1000 };
+    static node_t nodes[count];
+
+    ccntr_sharded_map_t map;
+    // Too many shards are limited.
+    ccntr_sharded_map_init(&map, NULL, NULL, UINT_MAX);
+    assert_int_equal( ccntr_sharded_map_get_shard_count(&map), CCNTR_SHARDED_MAP_MAX_SHARDS );
+    ccntr_sharded_map_destroy(&map);
+
+    ccntr_sharded_map_init(&map, NULL, NULL, 5);
+    assert_int_equal( ccntr_sharded_map_get_shard_count(&map), 8 );
+    assert_true( verify_order(&map, 0) );
+
+    // The shards are aligned to cache lines.
+    assert_int_equal( (uintptr_t) map.shards % CCNTR_SHARDED_MAP_CACHE_LINE_SIZE, 0 );
+    assert_int_equal( sizeof(ccntr_sharded_map_shard_t) % CCNTR_SHARDED_MAP_CACHE_LINE_SIZE, 0 );
+
+    // Link nodes in a shuffled order.
+    for(int i = 0; i < count; ++i)
+    {
+        node_t *node = &nodes[ i * 7 % count ];
+        node_init(node, i * 7 % count);
+        assert_null( ccntr_sharded_map_link(&map, node) );
+    }
+    assert_true( verify_order(&map, count) );
+
+    for(int i = 0; i < count; ++i)
+        assert_ptr_equal( ccntr_sharded_map_find_c(&map, (void*)(intptr_t) i), &nodes[i] );
+    assert_null( ccntr_sharded_map_find(&map, (void*)(intptr_t) count) );
+
+    // Link a node with duplicated key.
+    node_t node;
+    node_init(&node, 10);
+    assert_ptr_equal( ccntr_sharded_map_link(&map, &node), &nodes[10] );
+    assert_ptr_equal( ccntr_sharded_map_find(&map, (void*)(intptr_t) 10), &node );
+    assert_true( verify_order(&map, count) );
+
+    // Unlink nodes.
+    ccntr_sharded_map_unlink(&map, &node);
+    assert_ptr_equal( ccntr_sharded_map_unlink_by_key(&map, (void*)(intptr_t) 20), &nodes[20] );
+    assert_null( ccntr_sharded_map_unlink_by_key(&map, (void*)(intptr_t) 20) );
+    assert_null( ccntr_sharded_map_find(&map, (void*)(intptr_t) 10) );
+    assert_true( verify_order(&map, count - 2) );
+
+    ccntr_sharded_map_discard_all(&map);
+    assert_true( verify_order(&map, 0) );
+
+    ccntr_sharded_map_destroy(&map);
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_THREAD_SAFE
+
+#define THREAD_COUNT 4
+#define THREAD_NODES 2000
+
+typedef struct thread_arg_t
+{
+    ccntr_sharded_map_t *map;
+    node_t              *nodes;
+    unsigned             index;
+} thread_arg_t;
+
+static
+void* concurrent_worker(void *param)
+{
+    thread_arg_t *arg = param;
+
+    // Each thread links interleaved keys, and unlinks half of them.
+    for(unsigned i = 0; i < THREAD_NODES; ++i)
+    {
+        node_t *node = &arg->nodes[i];
+        node_init(node, i * THREAD_COUNT + arg->index);
+        if( ccntr_sharded_map_link(arg->map, node) ) return node;
+    }
+
+    for(unsigned i = 0; i < THREAD_NODES; i += 2)
+    {
+        const void *key = arg->nodes[i].key;
+        if( ccntr_sharded_map_unlink_by_key(arg->map, key) != &arg->nodes[i] ) return &arg->nodes[i];
+    }
+
+    return NULL;
+}
+
+static
+void sharded_map_concurrent_test(void **state)
+{
+    static node_t nodes[THREAD_COUNT][THREAD_NODES];
+
+    ccntr_sharded_map_t map;
+    ccntr_sharded_map_init(&map, NULL, NULL, 0);
+
+    pthread_t    threads[THREAD_COUNT];
+    thread_arg_t args[THREAD_COUNT];
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        args[i] = (thread_arg_t){ &map, nodes[i], i };
+        assert_int_equal( pthread_create(&threads[i], NULL, concurrent_worker, &args[i]), 0 );
+    }
+
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        void *failed;
+        assert_int_equal( pthread_join(threads[i], &failed), 0 );
+        assert_null( failed );
+    }
+
+    assert_true( verify_order(&map, THREAD_COUNT * THREAD_NODES / 2) );
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        for(unsigned j = 0; j < THREAD_NODES; ++j)
+        {
+            const void *key = (void*)(intptr_t)( j * THREAD_COUNT + i );
+            assert_ptr_equal( ccntr_sharded_map_find(&map, key), ( j & 1 )?( &nodes[i][j] ):( NULL ) );
+        }
+    }
+
+    ccntr_sharded_map_destroy(&map);
+}
+
+#endif  // CCNTR_THREAD_SAFE
+//------------------------------------------------------------------------------
+int test_sharded_map(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(sharded_map_link_and_find_test),
+#ifdef CCNTR_THREAD_SAFE
+        cmocka_unit_test(sharded_map_concurrent_test),
+#endif
+    };
+
+    return cmocka_run_group_tests_name("sharded map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
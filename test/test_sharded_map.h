@@ -0,0 +1,6 @@
+#ifndef _TEST_SHARDED_MAP_H_
+#define _TEST_SHARDED_MAP_H_
+
+int test_sharded_map(void);
+
+#endif
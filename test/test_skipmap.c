@@ -0,0 +1,228 @@
+#include <stdint.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+#include "ccntr.h"
+#include "test_skipmap.h"
+
+#ifdef CCNTR_THREAD_SAFE
+#include <pthread.h>
+#endif
+
+typedef ccntr_skipmap_node_t node_t;
+
+//------------------------------------------------------------------------------
+static
+void node_init(node_t *node, int key)
+{
+    node->key = (void*)(intptr_t) key;
+}
+//------------------------------------------------------------------------------
+static
+int node_get_key(const node_t *node)
+{
+    return (intptr_t) node->key;
+}
+//------------------------------------------------------------------------------
+static
+bool verify_order(ccntr_skipmap_t *map, unsigned count)
+{
+    if( ccntr_skipmap_get_count(map) != count ) return false;
+
+    unsigned iterated = 0;
+    const node_t *prev = NULL;
+    for(const node_t *node = ccntr_skipmap_get_first(map);
+        node;
+        prev = node, node = ccntr_skipmap_node_get_next_c(node))
+    {
+        if( prev && node_get_key(prev) >= node_get_key(node) ) return false;
+        if( ccntr_skipmap_get_prev(map, node) != prev ) return false;
+        ++ iterated;
+    }
+
+    return iterated == count && ccntr_skipmap_get_last(map) == prev;
+}
+//------------------------------------------------------------------------------
+static
+void skipmap_link_and_find_test(void **state)
+{
+    static const unsigned count = 100;
+
+    node_t nodes[count];
+    node_t duplicated;
+
+    ccntr_skipmap_t map;
+    ccntr_skipmap_init(&map, NULL);
+
+    assert_null( ccntr_skipmap_get_first(&map) );
+    assert_null( ccntr_skipmap_get_last(&map) );
+
+    // Link nodes with keys 0, 2, 4, ... in a shuffled order.
+    for(unsigned i = 0; i < count; ++i)
+    {
+        unsigned index = ( i * 37 ) % count;
+        node_init(&nodes[index], 2 * index);
+        assert_null( ccntr_skipmap_link(&map, &nodes[index]) );
+    }
+    assert_true( verify_order(&map, count) );
+
+    // Existed node will not be replaced.
+    node_init(&duplicated, 2 * 10);
+    assert_ptr_equal( ccntr_skipmap_link(&map, &duplicated), &nodes[10] );
+    assert_int_equal( ccntr_skipmap_get_count(&map), count );
+
+    // Search nodes.
+    assert_ptr_equal( ccntr_skipmap_find(&map, (void*)(intptr_t) 20), &nodes[10] );
+    assert_null( ccntr_skipmap_find(&map, (void*)(intptr_t) 21) );
+
+    assert_ptr_equal( ccntr_skipmap_find_nearest_less(&map, (void*)(intptr_t) 20), &nodes[10] );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_less(&map, (void*)(intptr_t) 21), &nodes[10] );
+    assert_null( ccntr_skipmap_find_nearest_less(&map, (void*)(intptr_t) -1) );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_less(&map, (void*)(intptr_t) 1000), &nodes[count-1] );
+
+    assert_ptr_equal( ccntr_skipmap_find_nearest_great(&map, (void*)(intptr_t) 20), &nodes[10] );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_great(&map, (void*)(intptr_t) 19), &nodes[10] );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_great(&map, (void*)(intptr_t) -1), &nodes[0] );
+    assert_null( ccntr_skipmap_find_nearest_great(&map, (void*)(intptr_t) 1000) );
+
+    // Unlink nodes.
+    assert_true( ccntr_skipmap_unlink(&map, &nodes[0]) );
+    assert_false( ccntr_skipmap_unlink(&map, &nodes[0]) );
+    assert_ptr_equal( ccntr_skipmap_unlink_by_key(&map, (void*)(intptr_t) 20), &nodes[10] );
+    assert_null( ccntr_skipmap_unlink_by_key(&map, (void*)(intptr_t) 20) );
+    assert_true( ccntr_skipmap_unlink(&map, &nodes[count-1]) );
+    assert_true( verify_order(&map, count - 3) );
+
+    assert_ptr_equal( ccntr_skipmap_get_first(&map), &nodes[1] );
+    assert_ptr_equal( ccntr_skipmap_get_last(&map), &nodes[count-2] );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_less(&map, (void*)(intptr_t) 21), &nodes[9] );
+    assert_ptr_equal( ccntr_skipmap_find_nearest_great(&map, (void*)(intptr_t) 19), &nodes[11] );
+
+    // Node can be linked again after it be unlinked.
+    assert_null( ccntr_skipmap_link(&map, &nodes[10]) );
+    assert_true( verify_order(&map, count - 2) );
+
+    ccntr_skipmap_discard_all(&map);
+    assert_int_equal( ccntr_skipmap_get_count(&map), 0 );
+    assert_null( ccntr_skipmap_get_first(&map) );
+}
+//------------------------------------------------------------------------------
+static
+void skipmap_wide_keys_test(void **state)
+{
+    // Keys differ by more than the range of int.
+    static const intptr_t keys[] = { INTPTR_MIN, -( (intptr_t) 1 << 40 ), 0, (intptr_t) 1 << 40, INTPTR_MAX };
+    enum { count = sizeof(keys) / sizeof(keys[0]) };
+
+    node_t nodes[count];
+
+    ccntr_skipmap_t map;
+    ccntr_skipmap_init(&map, NULL);
+
+    for(unsigned i = 0; i < count; ++i)
+    {
+        unsigned index = ( i * 3 ) % count;
+        nodes[index].key = (void*) keys[index];
+        assert_null( ccntr_skipmap_link(&map, &nodes[index]) );
+    }
+    assert_int_equal( ccntr_skipmap_get_count(&map), count );
+
+    unsigned index = 0;
+    for(const node_t *node = ccntr_skipmap_get_first(&map);
+        node;
+        node = ccntr_skipmap_node_get_next_c(node))
+    {
+        assert_ptr_equal( node, &nodes[ index ++ ] );
+    }
+    assert_int_equal( index, count );
+
+    for(unsigned i = 0; i < count; ++i)
+        assert_ptr_equal( ccntr_skipmap_find(&map, (void*) keys[i]), &nodes[i] );
+
+    ccntr_skipmap_discard_all(&map);
+}
+//------------------------------------------------------------------------------
+#ifdef CCNTR_THREAD_SAFE
+
+#define THREAD_COUNT 4
+#define THREAD_NODES 2000
+
+typedef struct thread_arg_t
+{
+    ccntr_skipmap_t *map;
+    node_t          *nodes;
+    unsigned         index;
+} thread_arg_t;
+
+static
+void* concurrent_worker(void *param)
+{
+    thread_arg_t *arg = param;
+
+    // Each thread links interleaved keys, and unlinks half of them.
+    for(unsigned i = 0; i < THREAD_NODES; ++i)
+    {
+        node_t *node = &arg->nodes[i];
+        node_init(node, i * THREAD_COUNT + arg->index);
+        if( ccntr_skipmap_link(arg->map, node) ) return node;
+    }
+
+    for(unsigned i = 0; i < THREAD_NODES; i += 2)
+    {
+        if( !ccntr_skipmap_unlink(arg->map, &arg->nodes[i]) ) return &arg->nodes[i];
+    }
+
+    return NULL;
+}
+
+static
+void skipmap_concurrent_test(void **state)
+{
+    static node_t nodes[THREAD_COUNT][THREAD_NODES];
+
+    ccntr_skipmap_t map;
+    ccntr_skipmap_init(&map, NULL);
+
+    pthread_t    threads[THREAD_COUNT];
+    thread_arg_t args[THREAD_COUNT];
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        args[i] = (thread_arg_t){ &map, nodes[i], i };
+        assert_int_equal( pthread_create(&threads[i], NULL, concurrent_worker, &args[i]), 0 );
+    }
+
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        void *failed;
+        assert_int_equal( pthread_join(threads[i], &failed), 0 );
+        assert_null( failed );
+    }
+
+    assert_true( verify_order(&map, THREAD_COUNT * THREAD_NODES / 2) );
+    for(unsigned i = 0; i < THREAD_COUNT; ++i)
+    {
+        for(unsigned j = 0; j < THREAD_NODES; ++j)
+        {
+            const void *key = (void*)(intptr_t)( j * THREAD_COUNT + i );
+            assert_ptr_equal( ccntr_skipmap_find(&map, key), ( j & 1 )?( &nodes[i][j] ):( NULL ) );
+        }
+    }
+}
+
+#endif  // CCNTR_THREAD_SAFE
+//------------------------------------------------------------------------------
+int test_skipmap(void)
+{
+    struct CMUnitTest tests[] =
+    {
+        cmocka_unit_test(skipmap_link_and_find_test),
+        cmocka_unit_test(skipmap_wide_keys_test),
+#ifdef CCNTR_THREAD_SAFE
+        cmocka_unit_test(skipmap_concurrent_test),
+#endif
+    };
+
+    return cmocka_run_group_tests_name("skip list map test", tests, NULL, NULL);
+}
+//------------------------------------------------------------------------------
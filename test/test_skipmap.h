@@ -0,0 +1,6 @@
+#ifndef _TEST_SKIPMAP_H_
+#define _TEST_SKIPMAP_H_
+
+int test_skipmap(void);
+
+#endif